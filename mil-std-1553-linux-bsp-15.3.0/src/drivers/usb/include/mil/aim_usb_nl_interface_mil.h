@@ -58,7 +58,7 @@ enum aim_mil_nl_ops
 enum aim_mil_nl_attributes
 {
     AIM_MIL_NL_A_UNSPEC,         /*!< AIM_MIL_NL_A_UNSPEC */
-    AIM_MIL_NL_A_LOGLIST_ENTRY,  /*!< Attribute for receive events */
+    AIM_MIL_NL_A_LOGLIST_ENTRY,  /*!< Attribute for receive events. Holds one or more consecutive loglist entries */
     __AIM_MIL_NL_A_MAX,          /*!< __AIM_MIL_NL_A_MAX */
 };
 
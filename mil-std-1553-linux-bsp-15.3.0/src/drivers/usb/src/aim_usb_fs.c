@@ -414,9 +414,10 @@ ssize_t aim_usb_interface_read(struct file* file , char __user * buffer, size_t
 {
     struct aim_usb_interface* intf;
     struct aim_data_transaction_user params;
-    void* usb_buffer;
     int err;
     size_t read_size;
+    size_t done;
+    size_t chunk;
 
     intf = file->private_data;
 
@@ -439,37 +440,34 @@ ssize_t aim_usb_interface_read(struct file* file , char __user * buffer, size_t
 
     read_size = params.size * params.numObjects;
 
-    usb_buffer = kmalloc(read_size, GFP_KERNEL);
-    if(!usb_buffer)
-    {
-        aim_usb_intf_err(intf, "Failed to allocate read buffer");
-        return -ENOMEM;
-    }
-
+    /* Stream the data through the interface's transfer buffer.
+     * The I/O mutex is held for the whole transfer so it stays atomic
+     * with respect to other users of the device.
+     */
     err = 0;
-    do
-    {
-        mutex_lock(&intf->io_mutex);
 
-        err = aim_usb_hw_read(intf, usb_buffer, read_size, params.memType, params.offset);
+    mutex_lock(&intf->io_mutex);
 
-        mutex_unlock(&intf->io_mutex);
+    for(done = 0; done < read_size; done += chunk)
+    {
+        chunk = min_t(size_t, read_size - done, AIM_USB_TRANSFER_BUFFER_SIZE);
 
+        err = aim_usb_hw_read(intf, intf->transfer_buffer, chunk, params.memType, params.offset + done);
         if(err)
         {
             aim_usb_intf_err(intf, "Failed to read data from hardware");
             break;
         }
 
-        if(copy_to_user(params.dataBuffer, usb_buffer, read_size))
+        if(copy_to_user((char __user*) params.dataBuffer + done, intf->transfer_buffer, chunk))
         {
             aim_usb_intf_err(intf, "Failed to copy data to user space");
             err = -EFAULT;
             break;
         }
-    }while(0);
+    }
 
-    kfree(usb_buffer);
+    mutex_unlock(&intf->io_mutex);
 
     return err ? err : read_size;
 }
@@ -479,9 +477,10 @@ ssize_t aim_usb_interface_write(struct file* file, const char __user * buffer, s
 {
     struct aim_usb_interface* intf;
     struct aim_data_transaction_user params;
-    void* usb_buffer;
     int err;
     size_t write_size;
+    size_t done;
+    size_t chunk;
 
     intf = file->private_data;
 
@@ -504,37 +503,30 @@ ssize_t aim_usb_interface_write(struct file* file, const char __user * buffer, s
 
     write_size = params.size * params.numObjects;
 
-    usb_buffer = kmalloc(write_size, GFP_KERNEL);
-    if(!usb_buffer)
-    {
-        aim_usb_intf_err(intf, "Failed to allocate write buffer");
-        return -ENOMEM;
-    }
-
     err = 0;
-    do
+
+    mutex_lock(&intf->io_mutex);
+
+    for(done = 0; done < write_size; done += chunk)
     {
-        if(copy_from_user(usb_buffer, params.dataBuffer, write_size))
+        chunk = min_t(size_t, write_size - done, AIM_USB_TRANSFER_BUFFER_SIZE);
+
+        if(copy_from_user(intf->transfer_buffer, (const char __user*) params.dataBuffer + done, chunk))
         {
             aim_usb_intf_err(intf, "Failed to copy data from user space");
             err = -EFAULT;
             break;
         }
 
-        mutex_lock(&intf->io_mutex);
-
-        err = aim_usb_hw_write(intf, usb_buffer, write_size, params.memType, params.offset);
-
-        mutex_unlock(&intf->io_mutex);
-
+        err = aim_usb_hw_write(intf, intf->transfer_buffer, chunk, params.memType, params.offset + done);
         if(err)
         {
             aim_usb_intf_err(intf, "Failed to write data to hardware");
             break;
         }
-    }while(0);
+    }
 
-    kfree(usb_buffer);
+    mutex_unlock(&intf->io_mutex);
 
     return err ? err : write_size;
 }
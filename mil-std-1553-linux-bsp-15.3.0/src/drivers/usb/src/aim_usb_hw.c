@@ -6,9 +6,23 @@
  */
 
 
+#include <linux/moduleparam.h>
 #include "aim_usb_hw.h"
 #include "aim_usb_ays.h"
 #include "aim_usb_apu.h"
+#include "aim_usb_loopback.h"
+
+
+
+
+/*! loopback
+ * If set, APU devices probed from now on use the RAM based loopback model
+ * instead of the APU USB transport. Devices keep the transport they were
+ * initialized with.
+ */
+static bool loopback;
+module_param(loopback, bool, 0644);
+MODULE_PARM_DESC(loopback, "Use the RAM based loopback model instead of the APU USB transport for new APU devices");
 
 
 
@@ -24,6 +38,10 @@ int aim_usb_hw_init(struct aim_usb_interface* aim_intf)
             return aim_usb_ays_hw_init(aim_intf);
 
         case AI_DEVICE_USB:
+            if(loopback)
+            {
+                return aim_usb_loopback_hw_init(aim_intf);
+            }
             return aim_usb_apu_hw_init(aim_intf);
 
         default:
@@ -54,7 +72,14 @@ int aim_usb_hw_start(struct aim_usb_interface* aim_intf)
         switch(aim_intf->platform)
         {
             case AI_DEVICE_USB:
-                err = aim_usb_apu_hw_start(aim_intf);
+                if(aim_usb_loopback_enabled(aim_intf))
+                {
+                    err = aim_usb_loopback_hw_start(aim_intf);
+                }
+                else
+                {
+                    err = aim_usb_apu_hw_start(aim_intf);
+                }
                 break;
 
             case AI_DEVICE_AYS_ASP:
@@ -85,7 +110,14 @@ void aim_usb_hw_stop(struct aim_usb_interface* aim_intf)
     switch(aim_intf->platform)
     {
         case AI_DEVICE_USB:
-            aim_usb_apu_hw_stop(aim_intf);
+            if(aim_usb_loopback_enabled(aim_intf))
+            {
+                aim_usb_loopback_hw_stop(aim_intf);
+            }
+            else
+            {
+                aim_usb_apu_hw_stop(aim_intf);
+            }
             break;
 
         default:
@@ -108,6 +140,9 @@ int aim_usb_hw_read(struct aim_usb_interface* aim_intf, void* buffer, size_t len
         return 0;
     }
 
+    /* Trace line that can be replayed on the loopback model */
+    aim_usb_intf_dbg(aim_intf, AIM_USB_LOOPBACK_TRACE_TAG "r %d %lld %zu", mem_type, (long long) offset, len);
+
     switch(aim_intf->platform)
     {
         case AI_DEVICE_AYS_ASP:
@@ -115,6 +150,10 @@ int aim_usb_hw_read(struct aim_usb_interface* aim_intf, void* buffer, size_t len
             return aim_usb_ays_hw_read(aim_intf, buffer, len, mem_type, offset);
 
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(aim_intf))
+            {
+                return aim_usb_loopback_hw_read(aim_intf, buffer, len, mem_type, offset);
+            }
             return aim_usb_apu_hw_read(aim_intf, buffer, len, mem_type, offset);
 
         default:
@@ -134,6 +173,8 @@ int aim_usb_hw_write(struct aim_usb_interface* aim_intf, const void* buffer, siz
         return 0;
     }
 
+    aim_usb_intf_dbg(aim_intf, AIM_USB_LOOPBACK_TRACE_TAG "w %d %lld %zu", mem_type, (long long) offset, len);
+
     switch(aim_intf->platform)
     {
         case AI_DEVICE_AYS_ASP:
@@ -141,6 +182,10 @@ int aim_usb_hw_write(struct aim_usb_interface* aim_intf, const void* buffer, siz
             return aim_usb_ays_hw_write(aim_intf, buffer, len, mem_type, offset);
 
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(aim_intf))
+            {
+                return aim_usb_loopback_hw_write(aim_intf, buffer, len, mem_type, offset);
+            }
             return aim_usb_apu_hw_write(aim_intf, buffer, len, mem_type, offset);
 
         default:
@@ -155,11 +200,21 @@ ssize_t aim_usb_hw_com_channel_cmd(struct aim_usb_com_channel* channel, const vo
 {
     BUG_ON(!channel || !channel->intf || !command);
 
+    aim_usb_intf_dbg(channel->intf, AIM_USB_LOOPBACK_TRACE_TAG "c %zu %zu", cmd_len, response ? resp_len : 0);
+
     switch(channel->intf->platform)
     {
         case AI_DEVICE_AYS_ASP:
         case AI_DEVICE_ZYNQMP_ASP:
             return aim_usb_ays_com_channel_cmd(channel, command, cmd_len, response, resp_len);
+
+        case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(channel->intf))
+            {
+                return aim_usb_loopback_com_channel_cmd(channel, command, cmd_len, response, resp_len);
+            }
+            return -EOPNOTSUPP;
+
         default:
             return -EOPNOTSUPP;
     }
@@ -173,6 +228,10 @@ int aim_usb_hw_novram_get(struct aim_usb_interface* intf, AiUInt32 address, AiUI
     switch(intf->platform)
     {
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(intf))
+            {
+                return -EOPNOTSUPP;
+            }
             return aim_usb_apu_novram_get(intf, address, value);
 
         case AI_DEVICE_AYS_ASP:
@@ -192,6 +251,10 @@ int aim_usb_hw_novram_set(struct aim_usb_interface* intf, AiUInt32 address, AiUI
     switch(intf->platform)
     {
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(intf))
+            {
+                return -EOPNOTSUPP;
+            }
             return aim_usb_apu_novram_set(intf, address, value);
 
         default:
@@ -207,6 +270,10 @@ int aim_usb_hw_tcp_reg_read(struct aim_usb_interface* intf, AiUInt32 address, Ai
     switch( intf->platform )
     {
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(intf))
+            {
+                return -EOPNOTSUPP;
+            }
             return aim_usb_apu_tcp_reg_read(intf, address, value);
 
         default:
@@ -222,6 +289,10 @@ int aim_usb_hw_tcp_reg_write(struct aim_usb_interface* intf, AiUInt32 address, A
     switch( intf->platform )
     {
         case AI_DEVICE_USB:
+            if(aim_usb_loopback_enabled(intf))
+            {
+                return -EOPNOTSUPP;
+            }
             return aim_usb_apu_tcp_reg_write(intf, address, value);
 
         default:
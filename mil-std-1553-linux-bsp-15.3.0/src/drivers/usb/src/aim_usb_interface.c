@@ -38,10 +38,20 @@ int aim_usb_interface_init(struct aim_usb_interface* aim_interface, struct aim_u
 
     mutex_init(&aim_interface->io_mutex);
 
+    /* Allocate the transfer buffer first, as the probe error path does not undo the hardware initialization */
+    aim_interface->transfer_buffer = kmalloc(AIM_USB_TRANSFER_BUFFER_SIZE, GFP_KERNEL);
+    if(!aim_interface->transfer_buffer)
+    {
+        aim_usb_intf_err(aim_interface, "Failed to allocate transfer buffer");
+        return -ENOMEM;
+    }
+
     err = aim_usb_hw_init(aim_interface);
     if(err)
     {
         aim_usb_intf_err(aim_interface, "Failed to initialize hardware");
+        kfree(aim_interface->transfer_buffer);
+        aim_interface->transfer_buffer = NULL;
         return err;
     }
 
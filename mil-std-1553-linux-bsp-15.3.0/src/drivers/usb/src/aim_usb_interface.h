@@ -19,6 +19,7 @@
 #include "aim_usb.h"
 #include "aim_ref.h"
 #include "apu/aim_usb_nc.h"
+#include "aim_usb_loopback.h"
 #include "Ai_def.h"
 
 /*! \def AIM_USB_MAX_COM_CHANNELS
@@ -27,6 +28,13 @@
 #define AIM_USB_MAX_COM_CHANNELS 3
 
 
+/*! \def AIM_USB_TRANSFER_BUFFER_SIZE
+ * Size of the persistent per interface buffer in bytes
+ * that memory transfers from and to user space are streamed through
+ */
+#define AIM_USB_TRANSFER_BUFFER_SIZE (256 * 1024)
+
+
 /* Forward declaration */
 struct aim_target_command;
 
@@ -70,6 +78,7 @@ struct aim_usb_interface
     AiUInt32 board_part_no;                 /*!< Board part no value from device NOVRAM */
     AiUInt32 hw_variant;                    /*!< Board hw variant value from device NOVRAM */
     struct mutex io_mutex;                  /*!< Lock board for IOCTL and Memory Access */
+    void* transfer_buffer;                  /*!< Bounce buffer for read/write system calls. Protected by io_mutex */
 
     AiBoolean has_asp;                      /*!< Indicates if board has Application Support Processor (ASP) */
 
@@ -92,6 +101,8 @@ struct aim_usb_interface
 
     struct aim_usb_ncdmac ncdmac;          /*!< DMA Controller for Netchip based devices */
 
+    struct aim_usb_loopback loopback;      /*!< RAM based stand-in for the APU USB transport */
+
     atomic_t ref_count;                    /*!< Reference count */
 };
 
@@ -188,9 +199,14 @@ static __inline__ void aim_usb_interface_free(atomic_t* ref)
         aim_intf->interrupt_ep = NULL;
     }
 
+    kfree(aim_intf->transfer_buffer);
+    aim_intf->transfer_buffer = NULL;
+
     aim_usb_ncdmac_free(&aim_intf->ncdmac);
     aim_usb_ncc_free(&aim_intf->ncc);
 
+    aim_usb_loopback_free(aim_intf);
+
     usb_put_intf(aim_intf->interface);
     aim_intf->interface = NULL;
 
@@ -19,6 +19,8 @@
  *
  *  Will call the interrupt endpoints completion handler
  *  and re-submit the URB.
+ *  As several URBs are queued on the endpoint, the other ones
+ *  stay pending while this one is processed.
  * @param urb The URB that was completed.
  */
 static void aim_usb_int_ep_complete(struct urb* urb)
@@ -39,11 +41,16 @@ static void aim_usb_int_ep_complete(struct urb* urb)
 
         aim_usb_intf_dbg(int_ep->intf, "Interrupt URB successfully completed. Re-submitting it");
 
-        /* Re-submit URB for next interrupt event */
+        /* Re-submit URB for next interrupt event.
+         * It has to be anchored again, as completion removed it from the anchor
+         */
+        usb_anchor_urb(urb, &int_ep->anchor);
+
         err = usb_submit_urb(urb, GFP_ATOMIC);
         if(err)
         {
             aim_usb_intf_dbg(int_ep->intf, "Failed to resubmit interrupt URB with err %d", err);
+            usb_unanchor_urb(urb);
         }
     }
     else
@@ -53,11 +60,37 @@ static void aim_usb_int_ep_complete(struct urb* urb)
 }
 
 
+/*! \brief Releases all URBs and URB buffers of an interrupt endpoint
+ *
+ * @param int_ep the interrupt endpoint to release URBs of
+ */
+static void aim_usb_int_ep_free_urbs(struct aim_usb_int_ep* int_ep)
+{
+    int i;
+
+    for(i = 0; i < AIM_USB_INT_EP_NUM_URBS; i++)
+    {
+        if(int_ep->urbs[i])
+        {
+            usb_free_urb(int_ep->urbs[i]);
+            int_ep->urbs[i] = NULL;
+        }
+
+        if(int_ep->urb_buffers[i])
+        {
+            kfree(int_ep->urb_buffers[i]);
+            int_ep->urb_buffers[i] = NULL;
+        }
+    }
+}
+
+
 
 
 int aim_usb_int_ep_init(struct aim_usb_int_ep* int_ep, struct aim_usb_interface* intf, struct usb_host_endpoint* ep)
 {
     int err;
+    int i;
 
     BUG_ON(!int_ep || !intf || !ep);
 
@@ -65,9 +98,10 @@ int aim_usb_int_ep_init(struct aim_usb_int_ep* int_ep, struct aim_usb_interface*
 
     int_ep->intf = intf;
     int_ep->ep = ep;
-    int_ep->urb = NULL;
-    int_ep->urb_buffer = NULL;
+    memset(int_ep->urbs, 0, sizeof(int_ep->urbs));
+    memset(int_ep->urb_buffers, 0, sizeof(int_ep->urb_buffers));
     int_ep->completion_handler = NULL;
+    init_usb_anchor(&int_ep->anchor);
 
     if(!usb_endpoint_is_int_in(&ep->desc))
     {
@@ -75,42 +109,34 @@ int aim_usb_int_ep_init(struct aim_usb_int_ep* int_ep, struct aim_usb_interface*
         return -EINVAL;
     }
 
+    int_ep->buffer_len = usb_endpoint_maxp(&ep->desc);
+
+    aim_usb_intf_dbg(intf, "Interrupt Endpoint buffer size is %zu with %d URBs", int_ep->buffer_len,
+                     AIM_USB_INT_EP_NUM_URBS);
+
     err = 0;
-    do
+    for(i = 0; i < AIM_USB_INT_EP_NUM_URBS; i++)
     {
-        int_ep->urb = usb_alloc_urb(0, GFP_KERNEL);
-        if(!int_ep->urb)
+        int_ep->urbs[i] = usb_alloc_urb(0, GFP_KERNEL);
+        if(!int_ep->urbs[i])
         {
             aim_usb_intf_err(int_ep->intf, "Failed to allocate URB for interrupt endpoint");
             err = -ENOMEM;
             break;
         }
 
-        int_ep->buffer_len = usb_endpoint_maxp(&ep->desc);
-
-        aim_usb_intf_dbg(intf, "Interrupt Endpoint buffer size is %zu", int_ep->buffer_len);
-
-        int_ep->urb_buffer = kmalloc(int_ep->buffer_len, GFP_KERNEL);
-
-        if(!int_ep->urb_buffer)
+        int_ep->urb_buffers[i] = kmalloc(int_ep->buffer_len, GFP_KERNEL);
+        if(!int_ep->urb_buffers[i])
         {
             aim_usb_intf_err(int_ep->intf, "Failed to allocate URB buffer for interrupt endpoint");
             err = -ENOMEM;
             break;
         }
-    }while(0);
+    }
 
     if(err)
     {
-        if(int_ep->urb)
-        {
-            usb_free_urb(int_ep->urb);
-        }
-
-        if(int_ep->urb_buffer)
-        {
-            kfree(int_ep->urb_buffer);
-        }
+        aim_usb_int_ep_free_urbs(int_ep);
     }
 
     return err;
@@ -123,42 +149,56 @@ void aim_usb_int_ep_free(struct aim_usb_int_ep* int_ep)
 
     aim_usb_intf_dbg(int_ep->intf, "Freeing interrupt endpoint");
 
-    if(int_ep->urb)
-    {
-        usb_free_urb(int_ep->urb);
-    }
-
-    if(int_ep->urb_buffer)
-    {
-        kfree(int_ep->urb_buffer);
-    }
+    aim_usb_int_ep_free_urbs(int_ep);
 }
 
 
 int aim_usb_int_ep_start(struct aim_usb_int_ep* int_ep)
 {
     struct usb_device* usb_dev;
+    int err;
+    int i;
 
-    BUG_ON(!int_ep || !int_ep->urb || !int_ep->urb_buffer || !int_ep->intf);
+    BUG_ON(!int_ep || !int_ep->urbs[0] || !int_ep->urb_buffers[0] || !int_ep->intf);
 
     aim_usb_intf_dbg(int_ep->intf, "Starting interrupt endpoint at address: 0x%x", int_ep->ep->desc.bEndpointAddress);
 
     usb_dev = interface_to_usbdev(int_ep->intf->interface);
 
-    usb_fill_int_urb(int_ep->urb, usb_dev, usb_rcvintpipe(usb_dev, int_ep->ep->desc.bEndpointAddress), int_ep->urb_buffer,
-                     int_ep->buffer_len, aim_usb_int_ep_complete, int_ep, int_ep->ep->desc.bInterval);
+    err = 0;
+    for(i = 0; i < AIM_USB_INT_EP_NUM_URBS; i++)
+    {
+        usb_fill_int_urb(int_ep->urbs[i], usb_dev, usb_rcvintpipe(usb_dev, int_ep->ep->desc.bEndpointAddress),
+                         int_ep->urb_buffers[i], int_ep->buffer_len, aim_usb_int_ep_complete, int_ep,
+                         int_ep->ep->desc.bInterval);
+
+        usb_anchor_urb(int_ep->urbs[i], &int_ep->anchor);
 
-    return usb_submit_urb(int_ep->urb, GFP_KERNEL);
+        err = usb_submit_urb(int_ep->urbs[i], GFP_KERNEL);
+        if(err)
+        {
+            aim_usb_intf_err(int_ep->intf, "Failed to submit interrupt URB %d with err %d", i, err);
+            usb_unanchor_urb(int_ep->urbs[i]);
+            break;
+        }
+    }
+
+    if(err)
+    {
+        usb_kill_anchored_urbs(&int_ep->anchor);
+    }
+
+    return err;
 }
 
 
 void aim_usb_int_ep_stop(struct aim_usb_int_ep* int_ep)
 {
-    BUG_ON(!int_ep || !int_ep->urb || !int_ep->intf);
+    BUG_ON(!int_ep || !int_ep->intf);
 
     aim_usb_intf_dbg(int_ep->intf, "Stopping interrupt endpoint at address: 0x%x", int_ep->ep->desc.bEndpointAddress);
 
-    usb_kill_urb(int_ep->urb);
+    usb_kill_anchored_urbs(&int_ep->anchor);
 }
 
 
@@ -17,6 +17,17 @@ struct aim_usb_int_ep;
 
 
 
+/*! \def AIM_USB_INT_EP_NUM_URBS
+ * Number of URBs that are kept queued on an interrupt endpoint.
+ * While one completion is processed, the remaining URBs are still
+ * pending, so the device does not have to wait for the re-submission
+ * before it can report the next interrupt event.
+ */
+#define AIM_USB_INT_EP_NUM_URBS 4
+
+
+
+
 /*! \typedef aim_usb_int_ep_completion
  *
  * Function pointers that are called on interrupt endpoint completion
@@ -30,15 +41,16 @@ typedef void (*aim_usb_int_ep_completion)(struct aim_usb_int_ep*, void*, size_t)
  *
  * This structure encapsulates handling of one specific interrupt endpoint.
  * A specific handler function can be assigned to the endpoint.
- * This one is called when the corresponding URB is completed
+ * This one is called each time one of the endpoint's URBs is completed
  */
 struct aim_usb_int_ep
 {
     struct aim_usb_interface* intf;     /*!< The AIM USB interface the endpoint belongs to */
     struct usb_host_endpoint* ep;       /*!< The actual interrupt endpoint of the device */
-    struct urb* urb;                    /*!< The URB to use for receiving interrupts from the endpoint */
-    void* urb_buffer;                   /*!< The URB transfer buffer were interrupt data will be stored */
-    size_t buffer_len;                  /*!< size of URB transfer buffer in bytes */
+    struct urb* urbs[AIM_USB_INT_EP_NUM_URBS];        /*!< The URBs to use for receiving interrupts from the endpoint */
+    void* urb_buffers[AIM_USB_INT_EP_NUM_URBS];       /*!< The URB transfer buffers were interrupt data will be stored */
+    size_t buffer_len;                  /*!< size of one URB transfer buffer in bytes */
+    struct usb_anchor anchor;           /*!< Anchor that tracks all URBs currently submitted on the endpoint */
     aim_usb_int_ep_completion completion_handler; /*!< handler function for the endpoint that is called when interrupt was received */
 };
 
@@ -65,7 +77,7 @@ extern void aim_usb_int_ep_free(struct aim_usb_int_ep* int_ep);
 /*! \brief Start an interrupt endpoint
  *
  * Will start interrupt reception on a specific interrupt endpoint.
- * Submits an URB on the underlying device endpoint to poll for interrupts
+ * Submits all URBs of the endpoint on the underlying device endpoint to poll for interrupts
  * @param int_ep the interrupt endpoint to start
  * @return 0 on success, errno code on failure
  */
@@ -75,7 +87,8 @@ extern int aim_usb_int_ep_start(struct aim_usb_int_ep* int_ep);
 /*! \brief Stop an interrupt endpoint
  *
  * Will stop reception of interrupts on a specific interrupt endpoint.
- * Must not be called in interrupt context as the URB cancellation might sleep
+ * Must not be called in interrupt context as the URB cancellation might sleep.
+ * All URBs still queued on the endpoint are cancelled
  * @param int_ep the interrupt endpoint to stop
  */
 extern void aim_usb_int_ep_stop(struct aim_usb_int_ep* int_ep);
@@ -0,0 +1,429 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file aim_usb_loopback.c
+ *
+ */
+
+
+#include <linux/vmalloc.h>
+#include <linux/slab.h>
+#include <linux/delay.h>
+#include "aim_usb_loopback.h"
+#include "aim_usb_interface.h"
+
+
+/*! \def LOOPBACK_CHECK_SIZE
+ * Number of bytes written and read back per memory type by the self check
+ */
+#define LOOPBACK_CHECK_SIZE 4096
+
+
+
+
+/*! \brief Resets transfer statistics
+ *
+ * @param stats the statistics to reset
+ */
+static void loopback_stats_reset(struct aim_usb_loopback_stats* stats)
+{
+    atomic64_set(&stats->commands, 0);
+    atomic64_set(&stats->bytes, 0);
+    atomic64_set(&stats->delay_us, 0);
+}
+
+
+/*! \brief Emulates the transfer time of one Netchip command
+ *
+ * Sleeps for the command latency plus the time needed to
+ * transfer the given number of bytes with the emulated bandwidth.
+ * @param loopback the loopback transport to emulate transfer on
+ * @param stats the statistics to account the transfer to
+ * @param len number of bytes transferred
+ */
+static void loopback_transfer_delay(struct aim_usb_loopback* loopback, struct aim_usb_loopback_stats* stats,
+                                    size_t len)
+{
+    unsigned long delay_us;
+
+    delay_us = loopback->cmd_latency_us;
+
+    if(loopback->bytes_per_us)
+    {
+        delay_us += DIV_ROUND_UP(len, loopback->bytes_per_us);
+    }
+
+    atomic64_inc(&stats->commands);
+    atomic64_add(len, &stats->bytes);
+    atomic64_add(delay_us, &stats->delay_us);
+
+    if(delay_us < 10)
+    {
+        udelay(delay_us);
+    }
+    else
+    {
+        usleep_range(delay_us, delay_us + delay_us / 8);
+    }
+}
+
+
+/*! \brief Logs transfer statistics of one direction
+ *
+ * @param intf the interface the statistics belong to
+ * @param name name of the transfer direction
+ * @param stats the statistics to log
+ */
+static void loopback_stats_log(struct aim_usb_interface* intf, const char* name,
+                               struct aim_usb_loopback_stats* stats)
+{
+    aim_usb_intf_info(intf, "Loopback %s: %lld commands, %lld bytes, %lld us", name,
+                      (long long) atomic64_read(&stats->commands), (long long) atomic64_read(&stats->bytes),
+                      (long long) atomic64_read(&stats->delay_us));
+}
+
+
+/*! \brief Echoes a com channel command as response
+ *
+ * @param loopback the loopback transport to emulate transfer on
+ * @param command the command to echo
+ * @param cmd_len size of command in bytes
+ * @param response buffer to store the response in
+ * @param resp_len size of response buffer in bytes
+ * @return number of response bytes
+ */
+static ssize_t loopback_echo(struct aim_usb_loopback* loopback, const void* command, size_t cmd_len,
+                             void* response, size_t resp_len)
+{
+    size_t echo_len;
+
+    echo_len = response ? min(cmd_len, resp_len) : 0;
+
+    loopback_transfer_delay(loopback, &loopback->cmd, cmd_len + echo_len);
+
+    if(echo_len)
+    {
+        memcpy(response, command, echo_len);
+    }
+
+    return echo_len;
+}
+
+
+/*! \brief Writes a pattern to the end of one device memory and reads it back
+ *
+ * The previous memory content is restored afterwards.
+ * @param intf the interface to check
+ * @param mem_type memory type to check
+ * @param size size of the memory in bytes
+ * @param pattern LOOPBACK_CHECK_SIZE bytes to write
+ * @param buffer 2 * LOOPBACK_CHECK_SIZE bytes of scratch memory
+ * @return 0 on success, errno code on failure
+ */
+static int loopback_check_memory(struct aim_usb_interface* intf, TY_E_MEM_TYPE mem_type, size_t size,
+                                 const void* pattern, void* buffer)
+{
+    void* saved = buffer;
+    void* readback = buffer + LOOPBACK_CHECK_SIZE;
+    loff_t offset = size - LOOPBACK_CHECK_SIZE;
+    int err;
+
+    err = aim_usb_loopback_hw_read(intf, saved, LOOPBACK_CHECK_SIZE, mem_type, offset);
+    if(err)
+    {
+        return err;
+    }
+
+    err = aim_usb_loopback_hw_write(intf, pattern, LOOPBACK_CHECK_SIZE, mem_type, offset);
+    if(!err)
+    {
+        err = aim_usb_loopback_hw_read(intf, readback, LOOPBACK_CHECK_SIZE, mem_type, offset);
+    }
+
+    if(!err && memcmp(pattern, readback, LOOPBACK_CHECK_SIZE))
+    {
+        aim_usb_intf_err(intf, "Loopback memory type %d does not return the written pattern", mem_type);
+        err = -EIO;
+    }
+
+    aim_usb_loopback_hw_write(intf, saved, LOOPBACK_CHECK_SIZE, mem_type, offset);
+
+    return err;
+}
+
+
+/*! \brief Checks that the loopback transport returns what was sent
+ *
+ * A pattern is written to and read back from global and I/O memory,
+ * then sent as com channel command and compared with the echo.
+ * @param intf the interface to check
+ * @return 0 on success, errno code on failure
+ */
+static int loopback_self_check(struct aim_usb_interface* intf)
+{
+    AiUInt32* pattern;
+    void* buffer;
+    size_t i;
+    int err;
+
+    pattern = kmalloc(3 * LOOPBACK_CHECK_SIZE, GFP_KERNEL);
+    if(!pattern)
+    {
+        return -ENOMEM;
+    }
+
+    buffer = (void*) pattern + LOOPBACK_CHECK_SIZE;
+
+    for(i = 0; i < LOOPBACK_CHECK_SIZE / sizeof(AiUInt32); i++)
+    {
+        pattern[i] = (AiUInt32) i * 0x9E3779B9;
+    }
+
+    err = loopback_check_memory(intf, AI_MEMTYPE_GLOBAL_DIRECT, intf->global_memory.size, pattern, buffer);
+
+    if(!err)
+    {
+        err = loopback_check_memory(intf, AI_MEMTYPE_IO, intf->io_memory.size, pattern, buffer);
+    }
+
+    if(!err)
+    {
+        memset(buffer, 0, LOOPBACK_CHECK_SIZE);
+
+        if(loopback_echo(&intf->loopback, pattern, LOOPBACK_CHECK_SIZE, buffer, LOOPBACK_CHECK_SIZE) != LOOPBACK_CHECK_SIZE
+           || memcmp(pattern, buffer, LOOPBACK_CHECK_SIZE))
+        {
+            aim_usb_intf_err(intf, "Loopback com channel does not echo the command");
+            err = -EIO;
+        }
+    }
+
+    if(!err)
+    {
+        aim_usb_intf_info(intf, "Loopback self check passed");
+    }
+
+    kfree(pattern);
+
+    return err;
+}
+
+
+int aim_usb_loopback_hw_init(struct aim_usb_interface* intf)
+{
+    struct aim_usb_loopback* loopback;
+
+    BUG_ON(!intf);
+
+    aim_usb_intf_info(intf, "Initializing loopback transport (%u us/command, %u bytes/us)",
+                      AIM_USB_LOOPBACK_CMD_LATENCY_US, AIM_USB_LOOPBACK_BYTES_PER_US);
+
+    loopback = &intf->loopback;
+
+    intf->has_asp = AiFalse;
+
+    loopback->cmd_latency_us = AIM_USB_LOOPBACK_CMD_LATENCY_US;
+    loopback->bytes_per_us = AIM_USB_LOOPBACK_BYTES_PER_US;
+
+    loopback->global_memory = vzalloc(AIM_USB_LOOPBACK_GLOBAL_MEM_SIZE);
+    loopback->io_memory = vzalloc(AIM_USB_LOOPBACK_IO_MEM_SIZE);
+    if(!loopback->global_memory || !loopback->io_memory)
+    {
+        aim_usb_intf_err(intf, "Failed to allocate loopback memory");
+        aim_usb_loopback_free(intf);
+        return -ENOMEM;
+    }
+
+    intf->global_memory.size = AIM_USB_LOOPBACK_GLOBAL_MEM_SIZE;
+    intf->global_memory.bus_address = 0;
+    intf->io_memory.size = AIM_USB_LOOPBACK_IO_MEM_SIZE;
+    intf->io_memory.bus_address = 0;
+
+    loopback->enabled = AiTrue;
+
+    return 0;
+}
+
+
+int aim_usb_loopback_hw_start(struct aim_usb_interface* intf)
+{
+    struct aim_usb_loopback* loopback;
+    int err;
+
+    BUG_ON(!intf || intf->global_memory.base);
+
+    loopback = &intf->loopback;
+
+    /* Runs before the mirror exists, so it only touches the emulated device memory */
+    err = loopback_self_check(intf);
+    if(err)
+    {
+        aim_usb_intf_err(intf, "Loopback self check failed");
+        return err;
+    }
+
+    loopback_stats_reset(&loopback->read);
+    loopback_stats_reset(&loopback->write);
+    loopback_stats_reset(&loopback->cmd);
+
+    intf->global_memory.base = vmalloc(intf->global_memory.size);
+    if(!intf->global_memory.base)
+    {
+        aim_usb_intf_err(intf, "Failed to allocate loopback memory mirror");
+        return -ENOMEM;
+    }
+
+    /* Initial mirror read is accounted like on real hardware */
+    loopback_transfer_delay(loopback, &loopback->read, intf->global_memory.size);
+    memcpy(intf->global_memory.base, loopback->global_memory, intf->global_memory.size);
+
+    return 0;
+}
+
+
+void aim_usb_loopback_hw_stop(struct aim_usb_interface* intf)
+{
+    BUG_ON(!intf);
+
+    loopback_stats_log(intf, "read", &intf->loopback.read);
+    loopback_stats_log(intf, "write", &intf->loopback.write);
+    loopback_stats_log(intf, "command", &intf->loopback.cmd);
+
+    if(intf->global_memory.base)
+    {
+        vfree(intf->global_memory.base);
+        intf->global_memory.base = NULL;
+    }
+}
+
+
+void aim_usb_loopback_free(struct aim_usb_interface* intf)
+{
+    BUG_ON(!intf);
+
+    vfree(intf->loopback.global_memory);
+    intf->loopback.global_memory = NULL;
+
+    vfree(intf->loopback.io_memory);
+    intf->loopback.io_memory = NULL;
+}
+
+
+int aim_usb_loopback_hw_read(struct aim_usb_interface* intf, void* buffer, size_t len, TY_E_MEM_TYPE mem_type,
+                             loff_t offset)
+{
+    struct aim_usb_loopback* loopback;
+
+    BUG_ON(!intf || !buffer);
+
+    loopback = &intf->loopback;
+
+    switch (mem_type)
+    {
+        case AI_MEMTYPE_SHARED:
+            if(len + offset > intf->shared_memory.size)
+            {
+                aim_usb_intf_err(intf, "Shared memory read out of bounds");
+                return -ESPIPE;
+            }
+            memcpy(buffer, intf->shared_memory.base + offset, len);
+            return 0;
+
+        case AI_MEMTYPE_GLOBAL:
+            if(len + offset > intf->global_memory.size)
+            {
+                aim_usb_intf_err(intf, "Global memory read out of bounds");
+                return -ESPIPE;
+            }
+
+            intf->ioctl_ops->sync_active_memory( intf, offset, len );
+
+            memcpy(buffer, intf->global_memory.base + offset, len);
+            return 0;
+
+        case AI_MEMTYPE_IO:
+            if(len + offset > intf->io_memory.size)
+            {
+                aim_usb_intf_err(intf, "I/O memory read out of bounds");
+                return -ESPIPE;
+            }
+            loopback_transfer_delay(loopback, &loopback->read, len);
+            memcpy(buffer, loopback->io_memory + offset, len);
+            return 0;
+
+        case AI_MEMTYPE_GLOBAL_DIRECT:
+            if(len + offset > intf->global_memory.size)
+            {
+                aim_usb_intf_err(intf, "Global memory read out of bounds");
+                return -ESPIPE;
+            }
+            loopback_transfer_delay(loopback, &loopback->read, len);
+            memcpy(buffer, loopback->global_memory + offset, len);
+            return 0;
+
+        default:
+            aim_usb_intf_err(intf, "No valid memory type specified");
+            return -EINVAL;
+    }
+}
+
+
+int aim_usb_loopback_hw_write(struct aim_usb_interface* intf, const void* buffer, size_t len,
+                              TY_E_MEM_TYPE mem_type, loff_t offset)
+{
+    struct aim_usb_loopback* loopback;
+
+    BUG_ON(!intf || !buffer);
+
+    loopback = &intf->loopback;
+
+    switch (mem_type)
+    {
+        case AI_MEMTYPE_SHARED:
+            if(len + offset > intf->shared_memory.size)
+            {
+                aim_usb_intf_err(intf, "Shared memory write out of bounds");
+                return -ESPIPE;
+            }
+            memcpy(intf->shared_memory.base + offset, buffer, len);
+            return 0;
+
+        case AI_MEMTYPE_IO:
+            if(len + offset > intf->io_memory.size)
+            {
+                aim_usb_intf_err(intf, "I/O memory write out of bounds");
+                return -ESPIPE;
+            }
+            loopback_transfer_delay(loopback, &loopback->write, len);
+            memcpy(loopback->io_memory + offset, buffer, len);
+            return 0;
+
+        case AI_MEMTYPE_GLOBAL:
+        case AI_MEMTYPE_GLOBAL_DIRECT:
+            if(len + offset > intf->global_memory.size)
+            {
+                aim_usb_intf_err(intf, "Global memory write out of bounds");
+                return -ESPIPE;
+            }
+            if(intf->global_memory.base)
+            {
+                memcpy(intf->global_memory.base + offset, buffer, len);
+            }
+            loopback_transfer_delay(loopback, &loopback->write, len);
+            memcpy(loopback->global_memory + offset, buffer, len);
+            return 0;
+
+        default:
+            aim_usb_intf_err(intf, "No valid memory type specified");
+            return -EINVAL;
+    }
+}
+
+
+ssize_t aim_usb_loopback_com_channel_cmd(struct aim_usb_com_channel* channel, const void* command,
+                                         size_t cmd_len, void* response, size_t resp_len)
+{
+    BUG_ON(!channel || !channel->intf || !command);
+
+    return loopback_echo(&channel->intf->loopback, command, cmd_len, response, resp_len);
+}
@@ -0,0 +1,184 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file aim_usb_loopback.h
+ *
+ * RAM based stand-in for the APU USB transport.
+ * APU devices use it when they are probed while the 'loopback' module parameter is set.
+ * The transport can also be run in user space with the replay harness in tools/loopback.
+ */
+
+#ifndef AIM_USB_LOOPBACK_H_
+#define AIM_USB_LOOPBACK_H_
+
+
+#include <linux/types.h>
+#include <linux/atomic.h>
+#include "Ai_types.h"
+#include "Ai_def.h"
+
+
+
+/*! \def AIM_USB_LOOPBACK_CMD_LATENCY_US
+ * Emulated latency of a single Netchip command in microseconds.
+ * Can be overridden at build time.
+ */
+#ifndef AIM_USB_LOOPBACK_CMD_LATENCY_US
+#define AIM_USB_LOOPBACK_CMD_LATENCY_US 125
+#endif
+
+
+/*! \def AIM_USB_LOOPBACK_BYTES_PER_US
+ * Emulated USB transfer bandwidth in bytes per microsecond.
+ * 0 disables bandwidth emulation. Can be overridden at build time.
+ */
+#ifndef AIM_USB_LOOPBACK_BYTES_PER_US
+#define AIM_USB_LOOPBACK_BYTES_PER_US 32
+#endif
+
+
+/*! \def AIM_USB_LOOPBACK_GLOBAL_MEM_SIZE
+ * Size of emulated global memory in bytes
+ */
+#ifndef AIM_USB_LOOPBACK_GLOBAL_MEM_SIZE
+#define AIM_USB_LOOPBACK_GLOBAL_MEM_SIZE (16 * 1024 * 1024)
+#endif
+
+
+/*! \def AIM_USB_LOOPBACK_IO_MEM_SIZE
+ * Size of emulated I/O memory in bytes
+ */
+#ifndef AIM_USB_LOOPBACK_IO_MEM_SIZE
+#define AIM_USB_LOOPBACK_IO_MEM_SIZE (64 * 1024)
+#endif
+
+
+/*! \def AIM_USB_LOOPBACK_TRACE_TAG
+ * Tag of the debug lines logged for each transport call.
+ * The replay harness reads the lines following this tag.
+ */
+#define AIM_USB_LOOPBACK_TRACE_TAG "trace: "
+
+
+/*! \def aim_usb_loopback_enabled
+ * Checks if an interface uses the loopback transport
+ */
+#define aim_usb_loopback_enabled(intf) \
+    ((intf)->loopback.enabled)
+
+
+/* Forward declarations */
+struct aim_usb_interface;
+struct aim_usb_com_channel;
+
+
+/*! \struct aim_usb_loopback_stats
+ *
+ * Transfer statistics of one direction of the loopback transport
+ */
+struct aim_usb_loopback_stats
+{
+    atomic64_t commands;    /*!< Number of emulated Netchip commands */
+    atomic64_t bytes;       /*!< Number of bytes transferred */
+    atomic64_t delay_us;    /*!< Accumulated emulated transfer time in microseconds */
+};
+
+
+/*! \struct aim_usb_loopback
+ *
+ * This structure holds the emulated device memory
+ * and the transfer statistics of a loopback interface
+ */
+struct aim_usb_loopback
+{
+    AiBoolean enabled;                      /*!< Interface uses the loopback transport */
+    void* global_memory;                    /*!< Emulated on-device global memory */
+    void* io_memory;                        /*!< Emulated on-device I/O memory */
+    AiUInt32 cmd_latency_us;                /*!< Emulated latency per command in microseconds */
+    AiUInt32 bytes_per_us;                  /*!< Emulated bandwidth in bytes per microsecond */
+    struct aim_usb_loopback_stats read;     /*!< Statistics of device to host transfers */
+    struct aim_usb_loopback_stats write;    /*!< Statistics of host to device transfers */
+    struct aim_usb_loopback_stats cmd;      /*!< Statistics of com channel commands */
+};
+
+
+
+
+/*! \brief Initializes the loopback transport of an interface
+ *
+ * Allocates the emulated device memory. No USB endpoints are required.
+ * @param intf the interface to initialize
+ * @return 0 on success, errno code on failure
+ */
+extern int aim_usb_loopback_hw_init(struct aim_usb_interface* intf);
+
+
+/*! \brief Starts the loopback transport of an interface
+ *
+ * Checks that a pattern written to global and I/O memory and sent as
+ * command comes back unchanged, then creates the global memory mirror
+ * and resets the transfer statistics
+ * @param intf the interface to start
+ * @return 0 on success, errno code on failure
+ */
+extern int aim_usb_loopback_hw_start(struct aim_usb_interface* intf);
+
+
+/*! \brief Stops the loopback transport of an interface
+ *
+ * Logs the transfer statistics and destroys the global memory mirror
+ * @param intf the interface to stop
+ */
+extern void aim_usb_loopback_hw_stop(struct aim_usb_interface* intf);
+
+
+/*! \brief Releases the emulated device memory of an interface
+ *
+ * @param intf the interface to free loopback resources of
+ */
+extern void aim_usb_loopback_free(struct aim_usb_interface* intf);
+
+
+/*! \brief Loopback device memory read function
+ *
+ * @param intf The interface to read from
+ * @param buffer the buffer to read data into
+ * @param len number of bytes to read
+ * @param mem_type memory type to read from
+ * @param offset offset in bytes to read from
+ * @return 0 on success, errno code on failure
+ */
+extern int aim_usb_loopback_hw_read(struct aim_usb_interface* intf, void* buffer, size_t len, TY_E_MEM_TYPE mem_type,
+                                    loff_t offset);
+
+
+/*! \brief Loopback device memory write function
+ *
+ * @param intf The interface to write to
+ * @param buffer the buffer to write data from
+ * @param len number of bytes to write
+ * @param mem_type memory type to write to
+ * @param offset offset in bytes to write to
+ * @return 0 on success, errno code on failure
+ */
+extern int aim_usb_loopback_hw_write(struct aim_usb_interface* intf, const void* buffer, size_t len,
+                                     TY_E_MEM_TYPE mem_type, loff_t offset);
+
+
+/*! \brief Loopback com channel command
+ *
+ * The command is echoed back as response after the emulated transfer time.
+ * @param channel the channel to send command on
+ * @param command the command to send
+ * @param cmd_len size of command in bytes
+ * @param response buffer to store the response in
+ * @param resp_len size of response buffer in bytes
+ * @return number of response bytes on success, errno code on failure
+ */
+extern ssize_t aim_usb_loopback_com_channel_cmd(struct aim_usb_com_channel* channel, const void* command,
+                                                size_t cmd_len, void* response, size_t resp_len);
+
+
+
+
+#endif /* AIM_USB_LOOPBACK_H_ */
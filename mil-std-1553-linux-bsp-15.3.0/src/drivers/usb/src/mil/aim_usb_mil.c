@@ -23,6 +23,13 @@
 #define SHARED_MEM_SIZE 0x1000000
 
 
+/*! \def LOGLIST_EVENT_BATCH_MAX
+ * Maximum number of interrupt loglist entries that are
+ * coalesced into one netlink message
+ */
+#define LOGLIST_EVENT_BATCH_MAX 16
+
+
 
 
 /*! \struct aim_usb_mil_interface
@@ -111,6 +118,8 @@ static void aim_usb_interface_mil_free(struct aim_usb_interface* intf)
 
 /*! \brief Interrupt endpoint completion handler for ASC1553
  *
+ * The device may report several consecutive loglist entries
+ * with one interrupt transfer. They are forwarded as one netlink message.
  * @param ep endpoint that issued interrupt
  * @param buffer buffer that contains interrupt data
  * @param len length of interrupt data in bytes
@@ -119,6 +128,12 @@ static __inline__ void mil_ays_irq_completion(struct aim_usb_int_ep* ep, void* b
 {
     BUG_ON(!ep || !buffer);
 
+    if(!len || (len % sizeof(struct ty_api_intr_loglist_entry)))
+    {
+        aim_usb_intf_err(ep->intf, "Received interrupt with invalid data length %zu", len);
+        return;
+    }
+
     if(aim_usb_nl_mc_send_sba(ep->intf, AIM_MIL_NL_GRP_ID_IRQ_EVENT, AIM_MIL_NL_OP_LOGLIST_EVENT,
                               AIM_MIL_NL_A_LOGLIST_ENTRY, len, buffer))
     {
@@ -226,11 +241,14 @@ static __inline__ bool get_loglist_entry(struct aim_usb_mil_interface* mil_intf,
 
 /*! \brief Forwards all interrupt currently in device's loglist to user space
  *
+ * Entries are coalesced into batches of up to \ref LOGLIST_EVENT_BATCH_MAX
+ * entries, each batch is sent as one netlink message.
  * @param mil_intf the 1553 USB interface to forward interrupts of
  */
 static void forward_interrupts(struct aim_usb_mil_interface* mil_intf)
 {
-    struct ty_api_intr_loglist_entry entry;
+    struct ty_api_intr_loglist_entry entries[LOGLIST_EVENT_BATCH_MAX];
+    size_t num_entries;
     bool entries_left;
 
     BUG_ON(!mil_intf);
@@ -239,12 +257,24 @@ static void forward_interrupts(struct aim_usb_mil_interface* mil_intf)
 
     do
     {
-        entries_left = get_loglist_entry(mil_intf, &entry);
+        num_entries = 0;
 
-        if(entries_left)
+        do
         {
+            entries_left = get_loglist_entry(mil_intf, &entries[num_entries]);
+
+            if(entries_left)
+            {
+                num_entries++;
+            }
+        }while(entries_left && num_entries < LOGLIST_EVENT_BATCH_MAX);
+
+        if(num_entries)
+        {
+            aim_usb_intf_dbg(&mil_intf->intf, "Sending batch of %zu loglist entries", num_entries);
+
             if(aim_usb_nl_mc_send_sba(&mil_intf->intf, AIM_MIL_NL_GRP_ID_IRQ_EVENT, AIM_MIL_NL_OP_LOGLIST_EVENT,
-                                      AIM_MIL_NL_A_LOGLIST_ENTRY, sizeof(entry), &entry))
+                                      AIM_MIL_NL_A_LOGLIST_ENTRY, num_entries * sizeof(entries[0]), entries))
             {
                 aim_usb_intf_err(&mil_intf->intf, "Failed to send interrupt loglist entry");
             }
@@ -0,0 +1,358 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file aim_usb_loopback_replay.c
+ *
+ * User space harness that replays transport traces on the loopback model
+ * of the APU USB transport.
+ *
+ * The driver logs one debug line per aim_usb_hw_read/write/com_channel_cmd
+ * call. Enable them with dynamic debug, e.g.
+ *     echo 'file aim_usb_hw.c +p' > /sys/kernel/debug/dynamic_debug/control
+ * and save the kernel log of a test run as trace. The harness builds
+ * src/aim_usb_loopback.c unchanged, replays every trace line on it and
+ * prints the command, byte and emulated time counters. Comparing these
+ * counters of traces recorded before and after a change shows its effect
+ * on mirror synchronization and com channel traffic without hardware.
+ *
+ * Usage: aim_usb_loopback_replay [-l latency_us] [-b bytes_per_us] [-r] [trace]
+ *     -l  emulated latency per command in microseconds
+ *     -b  emulated bandwidth in bytes per microsecond, 0 disables it
+ *     -r  really sleep for the emulated transfer time
+ * The trace is read from stdin if no file is given.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/types.h>
+#include "aim_usb_loopback.h"
+
+
+
+
+/*! \def LOOPBACK_REPLAY_SHARED_MEM_SIZE
+ * Size of the shared memory that the driver allocates for devices without ASP
+ */
+#define LOOPBACK_REPLAY_SHARED_MEM_SIZE 0x1000000
+
+
+/*! \def LOOPBACK_REPLAY_LINE_MAX
+ * Maximum length of a trace line in bytes
+ */
+#define LOOPBACK_REPLAY_LINE_MAX 512
+
+
+
+
+/* Minimal user space versions of the driver definitions the loopback model uses.
+ * They replace aim_usb_interface.h, which depends on the kernel USB stack. */
+#define AIM_USB_INTERFACE_H_
+
+#define BUG_ON(condition)           do { if(condition) abort(); } while(0)
+#define DIV_ROUND_UP(n, d)          (((n) + (d) - 1) / (d))
+#define min(a, b)                   ((a) < (b) ? (a) : (b))
+
+#define aim_usb_intf_info(intf, fmt, ...)  printf(fmt "\n", ##__VA_ARGS__)
+#define aim_usb_intf_err(intf, fmt, ...)   fprintf(stderr, "error: " fmt "\n", ##__VA_ARGS__)
+
+
+struct aim_usb_memory_space
+{
+    size_t size;
+    void* base;
+    AiUInt64 bus_address;
+};
+
+
+struct aim_usb_ioctl_ops
+{
+    int (*sync_active_memory)(struct aim_usb_interface*, size_t offset, size_t size);
+};
+
+
+struct aim_usb_interface
+{
+    AiBoolean has_asp;
+    struct aim_usb_ioctl_ops* ioctl_ops;
+    struct aim_usb_memory_space global_memory;
+    struct aim_usb_memory_space io_memory;
+    struct aim_usb_memory_space shared_memory;
+    struct aim_usb_loopback loopback;
+};
+
+
+struct aim_usb_com_channel
+{
+    struct aim_usb_interface* intf;
+};
+
+
+#include "aim_usb_loopback.c"
+
+
+
+
+/*! loopback_replay_sleep
+ * If set, emulated delays are really slept
+ */
+static int loopback_replay_sleep;
+
+
+void loopback_replay_delay(unsigned long us)
+{
+    if(loopback_replay_sleep)
+    {
+        usleep(us);
+    }
+}
+
+
+/*! \brief Mirror synchronization of global memory reads
+ *
+ * The target software synchronizes the mirror with direct global memory
+ * reads, which are part of the trace already. So nothing is done here.
+ */
+static int loopback_replay_sync(struct aim_usb_interface* intf, size_t offset, size_t size)
+{
+    return 0;
+}
+
+
+static struct aim_usb_ioctl_ops loopback_replay_ioctl_ops = {
+        .sync_active_memory = loopback_replay_sync,
+};
+
+
+/*! \brief Makes sure the scratch buffer can hold a transfer
+ *
+ * @param buffer the scratch buffer
+ * @param size current size of the scratch buffer in bytes
+ * @param len required size in bytes
+ * @return 0 on success, errno code on failure
+ */
+static int loopback_replay_buffer(void** buffer, size_t* size, size_t len)
+{
+    void* larger;
+
+    if(len <= *size)
+    {
+        return 0;
+    }
+
+    larger = realloc(*buffer, len);
+    if(!larger)
+    {
+        return -ENOMEM;
+    }
+
+    *buffer = larger;
+    *size = len;
+
+    return 0;
+}
+
+
+/*! \brief Replays one trace line
+ *
+ * Lines without trace tag are ignored, so a complete kernel log can be replayed.
+ * @param intf the loopback interface to replay on
+ * @param channel the com channel to replay commands on
+ * @param line the trace line
+ * @param buffer scratch buffer for the transferred data
+ * @param size size of the scratch buffer in bytes
+ * @return 1 if a transfer was replayed, 0 if the line was ignored, errno code on failure
+ */
+static int loopback_replay_line(struct aim_usb_interface* intf, struct aim_usb_com_channel* channel,
+                                const char* line, void** buffer, size_t* size)
+{
+    const char* trace;
+    char op;
+    int mem_type;
+    long long offset;
+    size_t len;
+    size_t resp_len;
+    ssize_t ret;
+    int err;
+
+    trace = strstr(line, AIM_USB_LOOPBACK_TRACE_TAG);
+    if(!trace)
+    {
+        return 0;
+    }
+
+    trace += strlen(AIM_USB_LOOPBACK_TRACE_TAG);
+
+    switch(trace[0])
+    {
+        case 'r':
+        case 'w':
+            if(sscanf(trace, "%c %d %lld %zu", &op, &mem_type, &offset, &len) != 4 || offset < 0)
+            {
+                return -EINVAL;
+            }
+
+            err = loopback_replay_buffer(buffer, size, len);
+            if(err)
+            {
+                return err;
+            }
+
+            if(op == 'r')
+            {
+                err = aim_usb_loopback_hw_read(intf, *buffer, len, (TY_E_MEM_TYPE) mem_type, offset);
+            }
+            else
+            {
+                err = aim_usb_loopback_hw_write(intf, *buffer, len, (TY_E_MEM_TYPE) mem_type, offset);
+            }
+
+            return err ? err : 1;
+
+        case 'c':
+            if(sscanf(trace, "%c %zu %zu", &op, &len, &resp_len) != 3)
+            {
+                return -EINVAL;
+            }
+
+            err = loopback_replay_buffer(buffer, size, len + resp_len);
+            if(err)
+            {
+                return err;
+            }
+
+            ret = aim_usb_loopback_com_channel_cmd(channel, *buffer, len, resp_len ? *buffer + len : NULL, resp_len);
+
+            return ret < 0 ? (int) ret : 1;
+
+        default:
+            return -EINVAL;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    struct aim_usb_interface intf;
+    struct aim_usb_com_channel channel;
+    char line[LOOPBACK_REPLAY_LINE_MAX];
+    struct timespec start, end;
+    unsigned long line_no;
+    unsigned long replayed;
+    long latency_us;
+    long bytes_per_us;
+    void* buffer;
+    size_t size;
+    FILE* trace;
+    int err;
+    int opt;
+
+    latency_us = AIM_USB_LOOPBACK_CMD_LATENCY_US;
+    bytes_per_us = AIM_USB_LOOPBACK_BYTES_PER_US;
+
+    while((opt = getopt(argc, argv, "l:b:r")) != -1)
+    {
+        switch(opt)
+        {
+            case 'l':
+                latency_us = strtol(optarg, NULL, 0);
+                break;
+
+            case 'b':
+                bytes_per_us = strtol(optarg, NULL, 0);
+                break;
+
+            case 'r':
+                loopback_replay_sleep = 1;
+                break;
+
+            default:
+                fprintf(stderr, "Usage: %s [-l latency_us] [-b bytes_per_us] [-r] [trace]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if(latency_us < 0 || bytes_per_us < 0)
+    {
+        fprintf(stderr, "error: latency and bandwidth must not be negative\n");
+        return 2;
+    }
+
+    trace = stdin;
+    if(optind < argc)
+    {
+        trace = fopen(argv[optind], "r");
+        if(!trace)
+        {
+            perror(argv[optind]);
+            return 2;
+        }
+    }
+
+    memset(&intf, 0, sizeof(intf));
+    intf.ioctl_ops = &loopback_replay_ioctl_ops;
+    channel.intf = &intf;
+
+    intf.shared_memory.size = LOOPBACK_REPLAY_SHARED_MEM_SIZE;
+    intf.shared_memory.base = calloc(1, intf.shared_memory.size);
+    if(!intf.shared_memory.base || aim_usb_loopback_hw_init(&intf))
+    {
+        fprintf(stderr, "error: failed to set up loopback transport\n");
+        return 1;
+    }
+
+    intf.loopback.cmd_latency_us = latency_us;
+    intf.loopback.bytes_per_us = bytes_per_us;
+
+    /* Runs the self check of the model and resets the counters */
+    err = aim_usb_loopback_hw_start(&intf);
+    if(err)
+    {
+        fprintf(stderr, "error: failed to start loopback transport (%d)\n", err);
+        return 1;
+    }
+
+    buffer = NULL;
+    size = 0;
+    line_no = 0;
+    replayed = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while(fgets(line, sizeof(line), trace))
+    {
+        line_no++;
+
+        err = loopback_replay_line(&intf, &channel, line, &buffer, &size);
+        if(err < 0)
+        {
+            fprintf(stderr, "error: line %lu: replay failed (%d): %s", line_no, err, line);
+            break;
+        }
+
+        replayed += err;
+        err = 0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("Replayed %lu transfers in %.3f ms (%ld us/command, %ld bytes/us)\n", replayed,
+           (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6, latency_us, bytes_per_us);
+
+    aim_usb_loopback_hw_stop(&intf);
+    aim_usb_loopback_free(&intf);
+
+    free(intf.shared_memory.base);
+    free(buffer);
+
+    if(trace != stdin)
+    {
+        fclose(trace);
+    }
+
+    return err ? 1 : 0;
+}
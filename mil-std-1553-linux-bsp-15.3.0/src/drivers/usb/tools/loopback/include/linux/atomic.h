@@ -0,0 +1,25 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file atomic.h
+ *
+ * User space stand-in for <linux/atomic.h> used by the loopback replay harness
+ */
+
+#ifndef LOOPBACK_REPLAY_LINUX_ATOMIC_H_
+#define LOOPBACK_REPLAY_LINUX_ATOMIC_H_
+
+
+typedef struct
+{
+    long long counter;
+} atomic64_t;
+
+
+#define atomic64_set(v, i)  __atomic_store_n(&(v)->counter, (i), __ATOMIC_SEQ_CST)
+#define atomic64_read(v)    __atomic_load_n(&(v)->counter, __ATOMIC_SEQ_CST)
+#define atomic64_add(i, v)  ((void) __atomic_add_fetch(&(v)->counter, (i), __ATOMIC_SEQ_CST))
+#define atomic64_inc(v)     atomic64_add(1, v)
+
+
+#endif /* LOOPBACK_REPLAY_LINUX_ATOMIC_H_ */
@@ -0,0 +1,25 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file delay.h
+ *
+ * User space stand-in for <linux/delay.h> used by the loopback replay harness.
+ * Delays are handed to the harness, which only sleeps if asked to.
+ */
+
+#ifndef LOOPBACK_REPLAY_LINUX_DELAY_H_
+#define LOOPBACK_REPLAY_LINUX_DELAY_H_
+
+
+/*! \brief Emulated transfer delay of the replay harness
+ *
+ * @param us delay in microseconds
+ */
+extern void loopback_replay_delay(unsigned long us);
+
+
+#define udelay(us)                  loopback_replay_delay(us)
+#define usleep_range(min, max)      loopback_replay_delay(min)
+
+
+#endif /* LOOPBACK_REPLAY_LINUX_DELAY_H_ */
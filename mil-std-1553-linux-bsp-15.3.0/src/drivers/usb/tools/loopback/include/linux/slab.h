@@ -0,0 +1,22 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file slab.h
+ *
+ * User space stand-in for <linux/slab.h> used by the loopback replay harness
+ */
+
+#ifndef LOOPBACK_REPLAY_LINUX_SLAB_H_
+#define LOOPBACK_REPLAY_LINUX_SLAB_H_
+
+
+#include <stdlib.h>
+
+
+#define GFP_KERNEL  0
+
+#define kmalloc(size, flags)    malloc(size)
+#define kfree(ptr)              free(ptr)
+
+
+#endif /* LOOPBACK_REPLAY_LINUX_SLAB_H_ */
@@ -0,0 +1,19 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file types.h
+ *
+ * User space stand-in for <linux/types.h> used by the loopback replay harness
+ */
+
+#ifndef LOOPBACK_REPLAY_LINUX_TYPES_H_
+#define LOOPBACK_REPLAY_LINUX_TYPES_H_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+
+#endif /* LOOPBACK_REPLAY_LINUX_TYPES_H_ */
@@ -0,0 +1,21 @@
+/* SPDX-FileCopyrightText: 2017-2021 AIM GmbH <info@aim-online.com> */
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/*! \file vmalloc.h
+ *
+ * User space stand-in for <linux/vmalloc.h> used by the loopback replay harness
+ */
+
+#ifndef LOOPBACK_REPLAY_LINUX_VMALLOC_H_
+#define LOOPBACK_REPLAY_LINUX_VMALLOC_H_
+
+
+#include <stdlib.h>
+
+
+#define vmalloc(size)   malloc(size)
+#define vzalloc(size)   calloc(1, size)
+#define vfree(ptr)      free(ptr)
+
+
+#endif /* LOOPBACK_REPLAY_LINUX_VMALLOC_H_ */
@@ -27,6 +27,7 @@
 #define MIN_API_BC_XFRAME       1   /* Transfers in Minor Frame    */
 #define MAX_API_BC_XFRAME       128 /* Transfers in Minor Frame    */
 #define MAX_API_BC_XACYC        127 /* Transfers in Acyclic Frame  */
+#define MAX_API_BC_XACYC_QUEUE  30  /* Transfers in queued Acyclic Burst */
 #define MIN_API_BC_MFRAME       1
 #define MAX_API_BC_MFRAME       64 /* Minor Frames in Major Frame  */
 #define MAX_API_BC_MFRAME_EX   512 /* Minor Frames in Major Frame for EX function */
@@ -140,6 +141,12 @@
 #define API_BC_ACYC_SEND_ON_TIMETAG      1
 #define API_BC_ACYC_SEND_AT_END_OF_FRAME 2
 
+/* function ApiCmdBCInstrModifyDefineList()
+   MAJOR_FRAME fails with API_ERR_BC_NOT_AVAILABLE if the running Major Frame does not support swapping */
+#define API_BC_MODIFY_LIST_IMMEDIATE     0
+#define API_BC_MODIFY_LIST_MAJOR_FRAME   1
+#define API_BC_MODIFY_LIST_MAX           64
+
 /* function ApiCmdBCInstrTblGen() */
 /* Transfer Descriptor size */
 #define MAX_API_BC_FW_XFER_DESC_SIZE 8
@@ -168,6 +175,17 @@
 #define API_BC_STATUS_HALTED          1
 #define API_BC_STATUS_BUSY            2
 
+/* function ApiCmdBCTimingControl() */
+#define API_BC_TIMING_DISABLE         0
+#define API_BC_TIMING_ENABLE          1
+#define API_BC_TIMING_RESET           2
+
+/* Overrun tolerance of ApiCmdBCTimingControl() in us. A Minor Frame counts as overrun
+   if it starts later than the Minor Frame time plus tolerance after the previous one,
+   a transfer if it starts later than the Minor Frame time plus tolerance after the
+   start of its Minor Frame. Smaller values are raised to the time tag resolution. */
+#define API_BC_TIMING_TOLERANCE_MIN   1
+
 /* function ApiCmdBCXferRead() */
 #define API_DONT_MODIFY_STATUS_BITS   0
 #define API_RESET_STATUS_BITS         1
@@ -249,6 +267,16 @@ typedef struct ty_api_bc_dytag
     AiUInt16 wpos;
 } TY_API_BC_DYTAG;
 
+typedef struct ty_api_bc_dytag_def
+{
+    AiUInt8  con;
+    AiUInt8  padding1;
+    AiUInt16 bc_hid;
+    AiUInt16 mode;
+    AiUInt16 padding2;
+    TY_API_BC_DYTAG dytag[4];
+} TY_API_BC_DYTAG_DEF;
+
 typedef struct ty_api_bc_frame
 {
     AiUInt8 id;
@@ -278,6 +306,40 @@ typedef struct ty_api_bc_acyc
     AiUInt16 xid[MAX_API_BC_XACYC];
 } TY_API_BC_ACYC;
 
+typedef struct ty_api_bc_acyc_queue_status
+{
+    AiUInt32 pending;
+    AiUInt32 running;
+    AiUInt32 free;
+    AiUInt32 done;
+} TY_API_BC_ACYC_QUEUE_STATUS;
+
+typedef struct ty_api_bc_bh_def
+{
+    AiUInt16 hid;
+    AiUInt16 bid;
+    AiUInt16 sid;
+    AiUInt16 eid;
+    AiUInt8  qsize;
+    AiUInt8  bqm;
+    AiUInt8  bsm;
+    AiUInt8  sqm;
+    AiUInt8  eqm;
+    AiUInt8  dbm;
+    AiUInt16 padding1;
+} TY_API_BC_BH_DEF;
+
+typedef struct ty_api_bc_setup_bulk
+{
+    AiUInt32             bh_cnt;
+    TY_API_BC_BH_DEF    *pbh;
+    AiUInt32             xfer_cnt;
+    TY_API_BC_XFER      *pxfer;
+    AiUInt32             frame_cnt;
+    TY_API_BC_FRAME     *pframe;
+    TY_API_BC_MFRAME_EX *pmframe;  /* NULL leaves the major frame unchanged */
+} TY_API_BC_SETUP_BULK;
+
 typedef struct ty_api_bc_status_dsp
 {
     AiUInt8  status;
@@ -289,6 +351,28 @@ typedef struct ty_api_bc_status_dsp
     AiUInt32 mfc;
 } TY_API_BC_STATUS_DSP;
 
+typedef struct ty_api_bc_timing_time
+{
+    AiUInt32 count;
+    AiUInt32 min;
+    AiUInt32 max;
+    AiUInt32 mean;
+} TY_API_BC_TIMING_TIME;
+
+typedef struct ty_api_bc_timing_xfer
+{
+    TY_API_BC_TIMING_TIME offset;         /* transfer start relative to the minor frame start in us */
+    AiUInt32              overrun;        /* transfers started later than ftime plus tolerance */
+} TY_API_BC_TIMING_XFER;
+
+typedef struct ty_api_bc_status_timing
+{
+    TY_API_BC_STATUS_DSP  status;
+    AiUInt32              ftime;          /* programmed minor frame time in us */
+    AiUInt32              frame_overrun;  /* minor frames started later than ftime plus tolerance after the previous one */
+    TY_API_BC_TIMING_TIME interval;       /* minor frame start to start in us */
+} TY_API_BC_STATUS_TIMING;
+
 typedef struct ty_api_bc_xfer_dsp
 {
     AiUInt16 cw1;
@@ -305,6 +389,17 @@ typedef struct ty_api_bc_xfer_dsp
     AiUInt32 srvreq_cnt;
 } TY_API_BC_XFER_DSP;
 
+typedef struct ty_api_bc_xfer_state
+{
+    AiUInt16 st1;
+    AiUInt16 st2;
+    AiUInt16 bid;
+    AiUInt16 brw;
+    AiUInt32 ttag;
+    AiUInt32 msg_cnt;
+    AiUInt32 err_cnt;
+} TY_API_BC_XFER_STATE;
+
 typedef struct ty_api_bc_xfer_status_queue
 {
     AiUInt32 ul_SqCtrlWord;
@@ -412,6 +507,7 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferDescGet     (AiUInt32 bModule, AiU
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferDescMod     (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid, AiUInt32 ulMode, AiUInt32 aulValue[4] );
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDef        (AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
                                                            AiUInt16 bc_hid, AiUInt16 mode, TY_API_BC_DYTAG bc_dytag[4]);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDefList    (AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_BC_DYTAG_DEF *pdefs);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCGetDytagDef     (AiUInt32 bModule, AiUInt8 biu, AiUInt16 bc_hid, AiUInt16 *mode, TY_API_BC_DYTAG *bc_dytag);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameDef        (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_FRAME  *pframe);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCMFrameDef       (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_MFRAME  *pmframe);
@@ -420,10 +516,19 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStart           (AiUInt32 bModule, AiU
                                                            AiUInt32 *maj_frame_addr, AiUInt32 *min_frame_addr);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCHalt            (AiUInt32 bModule, AiUInt8 biu);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStatusRead      (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_STATUS_DSP *pdsp);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCTimingControl   (AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt32 tolerance);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStatusTimingRead(AiUInt32 bModule, AiUInt8 biu, AiUInt32 xid_first, AiUInt32 xid_count, 
+                                                           TY_API_BC_STATUS_TIMING *ptiming, TY_API_BC_TIMING_XFER *pxfer);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferRead        (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid, AiUInt16 clr, TY_API_BC_XFER_DSP *pxfer_dsp);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferReadEx      (AiUInt32 bModule, TY_API_BC_XFER_READ_IN *px_XferReadIn, TY_API_BC_XFER_STATUS_EX *px_XferStat);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferReadBulk    (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid_first, AiUInt16 count, AiUInt16 *pxid_list,
+                                                           AiUInt16 clr, TY_API_BC_XFER_STATE *pxfer_state);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycPrep        (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycSend(AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode, AiUInt32 timetag_high, AiUInt32 timetag_low);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycQueue       (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc, TY_API_BC_ACYC_QUEUE_STATUS *pstatus);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycQueueStatus (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC_QUEUE_STATUS *pstatus);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCSetupBulk       (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_SETUP_BULK *psetup);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameSwap       (AiUInt32 bModule, AiUInt8 biu);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycPrepAndSendTransferBlocking(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_XFER * xfer, AiUInt16 data[32], TY_API_BC_XFER_DSP * transfer_status);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCSrvReqVecStatus(AiUInt32 bModule, AiUInt8 uc_Biu, AiUInt8 uc_RtAddr, TY_API_BC_SRVW *px_SrvReqVecStatus);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCSrvReqVecCon    (AiUInt32 bModule, AiUInt8 uc_Biu, AiUInt8 uc_RtAddr, TY_API_BC_SRVW_CON *px_SrvReqVecCon);
@@ -439,6 +544,8 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCInstrTblGen     (AiUInt32 bModule, AiU
                                                            TY_API_BC_FW_INSTR *tbl, AiUInt32 *ctbl, AiUInt32 *err_line, AiUInt8 *status);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCModeCtrl        (AiUInt32 ul_Module, AiUInt8 uc_Biu, TY_API_BC_MODE_CTRL *px_BcModeCtrl);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCInstrModifyDefine(AiUInt32 bModule, AiUInt8 biu, AiUInt32 id, TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offset);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCInstrModifyDefineList(AiUInt32 bModule, AiUInt8 biu, AiUInt32 mode, AiUInt32 count, AiUInt32 * ids, 
+                                                                TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offsets);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCTrafficOverrideControl(AiUInt32 bModule, AiUInt8 biu, AiUInt32 con);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCTrafficOverrideGet(AiUInt32 bModule, AiUInt8 biu, AiUInt32 * con);
 
@@ -454,16 +561,24 @@ AiInt16 ApiCmdBCXferDef_         (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_XFER
 AiInt16 ApiCmdBCXferDefErr_      (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid, TY_API_BC_ERR * pErrorInjection );
 AiInt16 ApiCmdBCXferCtrl_        (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid, AiUInt8 mode);
 AiInt16 ApiCmdBCDytagDef_        (AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt16 bc_hid, AiUInt16 mode, TY_API_BC_DYTAG bc_dytag[4]);
+AiInt16 ApiCmdBCDytagDefList_    (AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_BC_DYTAG_DEF *pdefs);
 AiInt16 ApiCmdBCGetDytagDef_     (AiUInt32 bModule, AiUInt8 biu, AiUInt16 bc_hid, AiUInt16 *mode, TY_API_BC_DYTAG *bc_dytag);
 AiInt16 ApiCmdBCFrameDef_        (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_FRAME  *pframe);
 AiInt16 ApiCmdBCMFrameDef_       (AiUInt32 bModule, AiUInt8 biu, AiUInt32 frame_cnt, AiUInt8 *frame_ids);
 AiInt16 ApiCmdBCStart_           (AiUInt32 bModule, AiUInt8 biu, AiUInt8 smod, AiUInt32 cnt, AiFloat frame_time, AiUInt32 saddr, AiUInt32 *maj_frame_addr, AiUInt32 *min_frame_addr);
 AiInt16 ApiCmdBCHalt_            (AiUInt32 bModule, AiUInt8 biu);
 AiInt16 ApiCmdBCStatusRead_      (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_STATUS_DSP *pdsp);
+AiInt16 ApiCmdBCTimingControl_   (AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt32 tolerance);
+AiInt16 ApiCmdBCStatusTimingRead_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 xid_first, AiUInt32 xid_count, TY_API_BC_STATUS_TIMING *ptiming, TY_API_BC_TIMING_XFER *pxfer);
 AiInt16 ApiCmdBCXferRead_        (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid, AiUInt16 clr, TY_API_BC_XFER_DSP *pxfer_dsp);
 AiInt16 ApiCmdBCXferReadEx_      (AiUInt32 bModule, TY_API_BC_XFER_READ_IN *px_XferReadIn, TY_API_BC_XFER_STATUS_EX *px_XferStat);
+AiInt16 ApiCmdBCXferReadBulk_    (AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid_first, AiUInt16 count, AiUInt16 *pxid_list, AiUInt16 clr, TY_API_BC_XFER_STATE *pxfer_state);
 AiInt16 ApiCmdBCAcycPrep_        (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc);
 AiInt16 ApiCmdBCAcycSend_        (AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode, AiUInt32 timetag_high, AiUInt32 timetag_low );
+AiInt16 ApiCmdBCAcycQueue_       (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc, TY_API_BC_ACYC_QUEUE_STATUS *pstatus);
+AiInt16 ApiCmdBCAcycQueueStatus_ (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC_QUEUE_STATUS *pstatus);
+AiInt16 ApiCmdBCSetupBulk_       (AiUInt32 bModule, AiUInt8 biu, TY_API_BC_SETUP_BULK *psetup);
+AiInt16 ApiCmdBCFrameSwap_       (AiUInt32 bModule, AiUInt8 biu);
 AiInt16 ApiCmdBCSrvReqVecStatus_ (AiUInt32 bModule, AiUInt8 uc_Biu, AiUInt8 uc_RtAddr, TY_API_BC_SRVW *px_SrvReqVecStatus);
 AiInt16 ApiCmdBCSrvReqVecCon_    (AiUInt32 bModule, AiUInt8 uc_Biu, AiUInt8 uc_RtAddr, TY_API_BC_SRVW_CON *px_SrvReqVecCon);
 AiInt16 ApiCmdBCGetXferBufferHeaderInfo_ (AiUInt32 Module, AiUInt8 Biu,AiUInt32 XferId, AiUInt32 *BufHeaderIndex, AiUInt32 *BufHeaderAddr);
@@ -476,6 +591,7 @@ AiInt16 ApiCmdBCInstrTblGetAddrFromLabel_(AiUInt32 bModule, AiUInt8 biu, AiUInt3
 AiInt16 ApiCmdBCInstrTblGen_     (AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode, AiUInt32 cnt, AiUInt32 dest_cnt, AiUInt32 dest_offset, TY_API_BC_FW_INSTR *tbl, AiUInt32 *ctbl, AiUInt32 *err_line, AiUInt8 *status);
 AiInt16 ApiCmdBCModeCtrl_        (AiUInt32 ul_Module, AiUInt8 uc_Biu, TY_API_BC_MODE_CTRL *px_BcModeCtrl);
 AiReturn ApiCmdBCInstrModifyDefine_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 id, TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offset);
+AiReturn ApiCmdBCInstrModifyDefineList_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 mode, AiUInt32 count, AiUInt32 * ids, TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offsets);
 AiReturn ApiCmdBCTrafficOverrideControl_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 con);
 AiReturn ApiCmdBCTrafficOverrideGet_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 * con);
 
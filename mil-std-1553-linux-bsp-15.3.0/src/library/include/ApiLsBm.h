@@ -103,6 +103,7 @@
 #define API_BM_TIMETAG_DAYS_MASK      0x000FF800
 #define API_BM_TIMETAG_HOURS_MASK     0x000007C0
 #define API_BM_TIMETAG_MIN_MASK       0x0000003F
+#define API_BM_TIMETAG_MASK           0x03FFFFFF
 
 #define API_BM_ENTRY_GAP_MASK         0x01FF0000
 #define API_BM_ENTRY_BUSWORD_MASK     0x0000FFFF
@@ -115,6 +116,7 @@
 #define API_BM_SEARCH_WORDB_MASK      0x0200
 #define API_BM_SEARCH_WORDA_MASK      0x0100
 #define API_BM_SEARCH_ENTRY_TYPE_MASK 0x0003
+#define API_BM_SEARCH_TTAG_MASK       0x8000 /* internal, see ApiCmdBMStackTimeTagFind() */
 
 #define API_BM_ENTRY_BUS_WORD         0
 
@@ -162,6 +164,7 @@
 /* function ApiCmdBMReadMsgFltRec() */
 #define API_BM_FLT_MODE_INDEPENDENT   0
 #define API_BM_FLT_MODE_DEPENDENT     1
+#define API_BM_FLT_MODE_INCREMENTAL   0x10 /* or'ed to mode: a full buffer returns API_BM_MORE_DATA instead of stopping the BM */
 
 #define API_BM_MSG_FLT_FORMAT_0       0
 #define API_BM_MSG_FLT_FORMAT_1       1
@@ -172,6 +175,12 @@
 
 #define API_BM_NO_OVERFLOW            0
 #define API_BM_OVERFLOW               1
+#define API_BM_MORE_DATA              2 /* incremental mode: records pending that did not fit into the buffer */
+
+/* function ApiCmdBMStatisticsControl() */
+#define API_BM_STAT_DISABLE           0
+#define API_BM_STAT_ENABLE            1
+#define API_BM_STAT_RESET             2
 
 #define API_BM_MSG_NO_ERR             0
 #define API_BM_MSG_ERR_NO_RESP        1
@@ -337,6 +346,33 @@ typedef struct ty_api_bm_dytag_mon_act
     AiUInt32 ul_Good;
 } TY_API_BM_DYTAG_MON_ACT;
 
+typedef struct ty_api_bm_statistics_time
+{
+    AiUInt32 count;
+    AiUInt32 min;
+    AiUInt32 max;
+    AiUInt32 mean;
+} TY_API_BM_STATISTICS_TIME;
+
+typedef struct ty_api_bm_statistics_rt_sa
+{
+    AiUInt32 rcv_msg_cnt;
+    AiUInt32 rcv_err_cnt;
+    AiUInt32 xmt_msg_cnt;
+    AiUInt32 xmt_err_cnt;
+} TY_API_BM_STATISTICS_RT_SA;
+
+typedef struct ty_api_bm_statistics
+{
+    AiUInt32                   msg_cnt;
+    AiUInt32                   err_cnt;
+    AiUInt32                   err_hist[16];  /* messages with error word bit n set, see API_BM_ET_xxx_MASK */
+    TY_API_BM_STATISTICS_TIME  gap;           /* intermessage gap in 0.25us */
+    TY_API_BM_STATISTICS_TIME  interval;      /* message start to start in us */
+    TY_API_BM_STATISTICS_TIME  resp[MAX_RT_ADDR + 1];  /* response time per RT in 0.25us */
+    TY_API_BM_STATISTICS_RT_SA rt_sa[MAX_RT_ADDR + 1][MAX_RT_MODECODE + 1];
+} TY_API_BM_STATISTICS;
+
 
 
 
@@ -354,6 +390,8 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMActRead         (AiUInt32 bModule, AiU
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStackpRead      (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STACKP_DSP *pstackp);
 AI_LIB_FUNC AI_DEPRECATED(AiReturn AI_CALL_CONV ApiCmdBMStackEntryRead(AiUInt32 bModule, AiUInt8 biu, AiUInt8 ptype,AiUInt8 sgn, AiUInt32 offset, TY_API_BM_STACK_DSP *pentry));
 AI_LIB_FUNC AI_DEPRECATED(AiReturn AI_CALL_CONV ApiCmdBMStackEntryFind(AiUInt32 bModule, AiUInt8 biu, AiUInt8 ptype,AiUInt8 sgn, AiUInt32 offset,AiUInt16 fspec, AiUInt16 fdata, AiUInt16 fmask,TY_API_BM_STACK_FND *pfnd));
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStackTimeTagFind(AiUInt32 bModule, AiUInt8 biu, AiUInt32 ttag_high, AiUInt32 ttag_low,
+                                                           TY_API_BM_STACK_FND *pfnd);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRecStatusRead   (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_REC *prec);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMCopyRecDat      (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_REC *prec);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMFilterIni       (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_addr,
@@ -370,11 +408,17 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRTActRead       (AiUInt32 bModule, AiU
                                                            TY_API_BM_RT_ACT *pact);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRTSAActRead     (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt, AiUInt8 sa, AiUInt8 sa_type,
                                                            TY_API_BM_RT_ACT *pact);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRTSAActSnapshot (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_first, AiUInt8 rt_count, AiUInt8 sa_type,
+                                                           TY_API_BM_RT_ACT *pact);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStatisticsControl(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStatisticsRead  (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STATISTICS *px_Stat);
 AI_LIB_FUNC AI_DEPRECATED(AiReturn AI_CALL_CONV ApiCmdBMIniMsgFltRec(AiUInt32 bModule, AiUInt8 biu, AiUInt8 cnt,TY_API_BM_INI_MSG_FLT_REC *pmrec));
 AI_LIB_FUNC AI_DEPRECATED(AiReturn AI_CALL_CONV ApiCmdBMReadMsgFltRec(AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode,AiUInt8 con, AiUInt32 max_size, AiUInt16 max_msg,void *lpBuf, AiUInt8 *ovfl, AiUInt32 *lWordsRead));
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMDytagMonDef     (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_DYTAG_MON_DEF *px_DytagMon);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMDytagMonRead    (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_DYTAG_MON_READ_CTRL *px_DytagMonCtrl,
                                                            TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMDytagMonReadBulk(AiUInt32 bModule, AiUInt8 biu, AiUInt8 uc_IdFirst, AiUInt8 uc_Count,
+                                                           AiUInt8 *puc_IdList, TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct);
 
 
 
@@ -394,6 +438,7 @@ AiInt16 ApiCmdBMActRead_         (AiUInt32 bModule, AiUInt8 biu, AiUInt16 entry_
 AiInt16 ApiCmdBMStackpRead_      (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STACKP_DSP *pstackp);
 AiInt16 ApiCmdBMStackEntryRead_  (AiUInt32 bModule, AiUInt8 biu, AiUInt8 ptype, AiUInt8 sgn, AiUInt32 offset, TY_API_BM_STACK_DSP *pentry);
 AiInt16 ApiCmdBMStackEntryFind_  (AiUInt32 bModule, AiUInt8 biu, AiUInt8 ptype, AiUInt8 sgn, AiUInt32 offset, AiUInt16 fspec, AiUInt16 fdata, AiUInt16 fmask, TY_API_BM_STACK_FND *pfnd);
+AiInt16 ApiCmdBMStackTimeTagFind_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 ttag_high, AiUInt32 ttag_low, TY_API_BM_STACK_FND *pfnd);
 AiInt16 ApiCmdBMRecStatusRead_   (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_REC *prec);
 AiInt16 ApiCmdBMCopyRecDat_      (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_REC *prec);
 AiInt16 ApiCmdBMFilterIni_       (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_addr, AiUInt32 rx_sa, AiUInt32 tx_sa, AiUInt32 rx_mc, AiUInt32 tx_mc);
@@ -404,10 +449,14 @@ AiInt16 ApiCmdBMTCIIni_          (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt, AiU
 AiInt16 ApiCmdBMTCBIni_          (AiUInt32 bModule, AiUInt8 biu, AiUInt8 tid, AiUInt8 ten, TY_API_BM_TCB *ptcb);
 AiInt16 ApiCmdBMRTActRead_       (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt, TY_API_BM_RT_ACT *pact);
 AiInt16 ApiCmdBMRTSAActRead_     (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt, AiUInt8 sa, AiUInt8 sa_type, TY_API_BM_RT_ACT *pact);
+AiInt16 ApiCmdBMRTSAActSnapshot_ (AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_first, AiUInt8 rt_count, AiUInt8 sa_type, TY_API_BM_RT_ACT *pact);
+AiInt16 ApiCmdBMStatisticsControl_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con);
+AiInt16 ApiCmdBMStatisticsRead_  (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STATISTICS *px_Stat);
 AiInt16 ApiCmdBMIniMsgFltRec_    (AiUInt32 bModule, AiUInt8 biu, AiUInt8 cnt, TY_API_BM_INI_MSG_FLT_REC *pmrec);
 AiInt16 ApiCmdBMReadMsgFltRec_   (AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode, AiUInt8 con, AiUInt32 max_size, AiUInt16 max_msg, void *lpBuf, AiUInt8 *ovfl, AiUInt32 *lWordsRead);
 AiInt16 ApiCmdBMDytagMonDef_     (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_DYTAG_MON_DEF *px_DytagMon);
 AiInt16 ApiCmdBMDytagMonRead_    (AiUInt32 bModule, AiUInt8 biu, TY_API_BM_DYTAG_MON_READ_CTRL *px_DytagMonCtrl, TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct);
+AiInt16 ApiCmdBMDytagMonReadBulk_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 uc_IdFirst, AiUInt8 uc_Count, AiUInt8 *puc_IdList, TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct);
 
 
 
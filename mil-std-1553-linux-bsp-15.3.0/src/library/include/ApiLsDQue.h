@@ -23,7 +23,19 @@
 
 #define API_DATA_QUEUE_ID_MIL_SCOPE     8
 #define API_DATA_QUEUE_GEN_ASP          9
-#define MAX_DATA_QUEUE_ID               API_DATA_QUEUE_GEN_ASP
+#define API_DATA_QUEUE_ID_XFER_EVENT    10
+#define MAX_DATA_QUEUE_ID               API_DATA_QUEUE_ID_XFER_EVENT
+
+/* API_DATA_QUEUE_ID_XFER_EVENT entries, see TY_API_DATA_QUEUE_XFER_EVENT */
+#define API_DATA_QUEUE_XFER_EVENT_BC            1
+#define API_DATA_QUEUE_XFER_EVENT_RT            2
+#define API_DATA_QUEUE_XFER_EVENT_TYPE(h)       (((h) >> 28) & 0xF)
+#define API_DATA_QUEUE_XFER_EVENT_BIU(h)        (((h) >> 24) & 0xF)
+#define API_DATA_QUEUE_XFER_EVENT_CAUSE(h)      (((h) >> 16) & 0x1F) /* Interrupt cause bits PGI, EVI, IXI, AEI, UXI */
+#define API_DATA_QUEUE_XFER_EVENT_XID(h)        ((h) & 0xFFFF)       /* BC: Transfer ID */
+#define API_DATA_QUEUE_XFER_EVENT_RT_ADDR(h)    (((h) >> 8) & 0x1F)  /* RT: RT address */
+#define API_DATA_QUEUE_XFER_EVENT_SA_TYPE(h)    (((h) >> 5) & 0x3)   /* RT: API_RT_TYPE_xxx */
+#define API_DATA_QUEUE_XFER_EVENT_SA(h)         ((h) & 0x1F)         /* RT: Subaddress/Mode code */
 
 
 #define API_DATA_QUEUE_CTRL_MODE_START  0
@@ -31,6 +43,7 @@
 #define API_DATA_QUEUE_CTRL_MODE_RESUME 2
 #define API_DATA_QUEUE_CTRL_MODE_FLUSH  3
 #define MAX_DATA_QUEUE_CONTROL_MODE     API_DATA_QUEUE_CTRL_MODE_FLUSH
+#define API_DATA_QUEUE_CTRL_MODE_FILTER 4 /* Used by ApiCmdDataQueueFilter() only */
 
 /* function ApiCmdDataQueueRead() */
 #define API_DATA_QUEUE_STATUS_ASP_OVERFLOW  0x00008000
@@ -51,6 +64,14 @@
 #define API_DATA_QUEUE_TSW_OFFSET_START     0x0C
 #define API_DATA_QUEUE_TSW_OFFSET_SIZE      0x10
 
+/* function ApiRecFileCreate() */
+#define API_REC_FILE_DEFAULT_BLOCK_SIZE     (256 * 1024)
+#define API_REC_FILE_MIN_BLOCK_SIZE         (4 * 1024)
+#define API_REC_FILE_MAX_BLOCK_SIZE         (64 * 1024 * 1024)
+
+/* function ApiRecFileWrite() */
+#define API_REC_FILE_MAX_BIU                8
+
 
 
 
@@ -86,6 +107,53 @@ typedef struct ty_api_data_queue_write
 	TY_API_DATA_QUEUE_STATUS x_Info;
 } TY_API_DATA_QUEUE_WRITE;
 
+/* function ApiCmdDataQueueSpanGet() */
+typedef struct ty_api_data_queue_span
+{
+    AiUInt32   ul_Status;           /* Queue status, see API_DATA_QUEUE_STATUS_xxx */
+    AiUInt32   ul_BytesAvailable;   /* ul_Size1 + ul_Size2 */
+    void     * pv_Data1;            /* Oldest data up to the end of the ring buffer */
+    AiUInt32   ul_Size1;
+    void     * pv_Data2;            /* Data continued at the start of the ring buffer, NULL if not wrapped */
+    AiUInt32   ul_Size2;
+} TY_API_DATA_QUEUE_SPAN;
+
+/* Entry of the API_DATA_QUEUE_ID_XFER_EVENT data queue */
+typedef struct ty_api_data_queue_xfer_event
+{
+    AiUInt32 ul_Header;         /* See API_DATA_QUEUE_XFER_EVENT_xxx() */
+    AiUInt32 ul_StatusWords;    /* BC: Status Word 2/1, RT: Last Command Word/Last Status Word */
+    AiUInt32 ul_Status;         /* Status Queue control word including the error bits */
+    AiUInt32 ul_TimeTag;
+} TY_API_DATA_QUEUE_XFER_EVENT;
+
+/* function ApiCmdDataQueueFilter() */
+typedef struct ty_api_data_queue_filter
+{
+    AiUInt32 ul_Enable;
+    AiUInt32 ul_RtMask;     /* Bit n set => messages to/from RT n are recorded */
+    AiUInt32 ul_RxSaMask;   /* Bit n set => receive messages on SA/MC n are recorded */
+    AiUInt32 ul_TxSaMask;   /* Bit n set => transmit messages on SA/MC n are recorded */
+    AiUInt32 ul_ErrorMask;  /* 0 => no error filter, else only messages with one of the API_BM_ET_xxx_MASK bits are recorded */
+} TY_API_DATA_QUEUE_FILTER;
+
+/* Header of one block in a recording file, also used as index entry */
+typedef struct ty_api_rec_file_block
+{
+    AiUInt32 ul_Magic;
+    AiUInt32 ul_Biu;
+    AiUInt32 ul_MessageCount;
+    AiUInt32 ul_ByteCount;      /* Size of the BM data following the header */
+    AiUInt32 ul_FirstTTHigh;
+    AiUInt32 ul_FirstTTLow;
+    AiUInt32 ul_LastTTHigh;
+    AiUInt32 ul_LastTTLow;
+    AiUInt64 ull_Offset;        /* File offset of the block header */
+} TY_API_REC_FILE_BLOCK;
+
+/* Recording file handle, see ApiRecFileCreate() and ApiRecFileOpen() */
+typedef struct ty_api_rec_file TY_API_REC_FILE;
+
 
 /****************************************************************
 **    Data Queue Functions
@@ -94,6 +162,11 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueOpen(AiUInt32 ul_Module, AiUInt
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueClose(AiUInt32 ul_Module, AiUInt32 id );
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueControl(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 mode);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueRead(AiUInt32 ul_Module, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueFilter(AiUInt32 ul_Module, AiUInt32 id, TY_API_DATA_QUEUE_FILTER *px_Filter);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueMap(AiUInt32 ul_Module, AiUInt32 id);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueUnmap(AiUInt32 ul_Module, AiUInt32 id);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueSpanGet(AiUInt32 ul_Module, AiUInt32 id, TY_API_DATA_QUEUE_SPAN *px_Span);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueSpanRelease(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 ul_Bytes);
 
 /* The following functions are called by the ANS server. */
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueOpen(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 * queue_size);
@@ -101,10 +174,23 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueClose(AiUInt32 ul_Module, AiUIn
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueControl(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 mode);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueRead(AiUInt32 ul_Module, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info);
 
+/****************************************************************
+**    Recording File Functions
+****************************************************************/
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileCreate(const char *psz_FileName, AiUInt32 ul_BlockSize, TY_API_REC_FILE **ppx_File);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileWrite(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu, const void *pv_Data, AiUInt32 ul_Bytes);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileOpen(const char *psz_FileName, TY_API_REC_FILE **ppx_File);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileClose(TY_API_REC_FILE *px_File);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockCount(TY_API_REC_FILE *px_File, AiUInt32 *pul_BlockCount);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockInfo(TY_API_REC_FILE *px_File, AiUInt32 ul_Block, TY_API_REC_FILE_BLOCK *px_Block);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockRead(TY_API_REC_FILE *px_File, AiUInt32 ul_Block, void *pv_Buffer, AiUInt32 ul_BufferSize, AiUInt32 *pul_BytesRead);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileSeek(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu, AiUInt32 ul_TTHigh, AiUInt32 ul_TTLow, AiUInt32 *pul_Block);
+
 AiInt16 ApiCmdDataQueueOpen_(AiUInt32 ul_Module, AiUInt8 uc_Biu, AiUInt32 id, AiUInt32 * queue_size );
 AiInt16 ApiCmdDataQueueClose_(AiUInt32 ul_Module, AiUInt8 uc_Biu, AiUInt32 id );
 AiInt16 ApiCmdDataQueueControl_(AiUInt32 ul_Module, AiUInt8 uc_Biu, AiUInt32 id, AiUInt32 mode);
 AiInt16 ApiCmdDataQueueRead_(AiUInt32 ul_Module, AiUInt8 uc_Biu, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info);
+AiInt16 ApiCmdDataQueueFilter_(AiUInt32 ul_Module, AiUInt32 id, TY_API_DATA_QUEUE_FILTER *px_Filter);
 
 
 AiUInt8 _ApiCmdDataQueueDirectIsHs(AiUInt8 ucDeviceType, AiUInt8 ucId);
@@ -122,4 +208,9 @@ AiInt16 ApiCmdDataQueueCloseBuffer_(AiUInt32 module, AiUInt8 biu, AiUInt32 id );
 AiInt16 ApiCmdDataQueueControlTsw_(AiUInt32 module, AiUInt8 biu, AiUInt32 id, AiUInt32 mode);
 AiInt16 ApiCmdDataQueueReadBuffer_(AiUInt32 module, AiUInt8 biu, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info);
 
+AiInt16 ApiCmdDataQueueMap_(AiUInt32 module, AiUInt32 id);
+AiInt16 ApiCmdDataQueueUnmap_(AiUInt32 module, AiUInt32 id);
+AiInt16 ApiCmdDataQueueSpanGetMapped_(AiUInt32 module, AiUInt32 id, TY_API_DATA_QUEUE_SPAN *px_Span);
+AiInt16 ApiCmdDataQueueSpanReleaseMapped_(AiUInt32 module, AiUInt32 id, AiUInt32 ul_Bytes);
+
 #endif /*API_LS_DQUE_H*/
@@ -60,6 +60,44 @@ typedef struct ty_api_queue_buf_ex
     AiUInt32 ttag_lo;
 } TY_API_QUEUE_BUF_EX;
 
+/* Decode the last message of the data even if no time tag high of a following message was seen */
+#define API_BM_STREAM_DECODE_FLUSH  1
+
+typedef struct ty_api_bm_stream_decode
+{
+    const AiUInt32      *pul_Data;              /* in:  raw BM entries, e.g. output of ApiCmdDataQueueRead */
+    AiUInt32             ul_EntryCount;         /* in:  number of entries in pul_Data */
+    AiUInt32             ul_Flags;              /* in:  API_BM_STREAM_DECODE_FLUSH or 0 */
+    TY_API_QUEUE_BUF_EX *px_Messages;           /* in:  array to store decoded messages in */
+    AiUInt32             ul_MaxMessages;        /* in:  number of elements of px_Messages */
+    AiUInt32             ul_MessageCount;       /* out: number of decoded messages */
+    AiUInt32             ul_EntriesConsumed;    /* out: number of entries processed, decoding continues from here */
+    AiUInt32             ul_EntriesSkipped;     /* out: number of malformed entries that were dropped */
+} TY_API_BM_STREAM_DECODE;
+
+/* Maximum number of data queues merged by one ApiBMMergeCreate() call */
+#define API_BM_MERGE_MAX_SOURCES        16
+/* Default size of the raw data buffer of each merge source in bytes */
+#define API_BM_MERGE_DEFAULT_BUFFER     (64 * 1024)
+#define API_BM_MERGE_MIN_BUFFER         (4 * 1024)
+/* ApiBMMergeRead() flag: sources without data no longer hold back, e.g. after BM stop */
+#define API_BM_MERGE_FLUSH              1
+
+typedef struct ty_api_bm_merge_source
+{
+    AiUInt32             ul_Module;             /* module handle of the board */
+    AiUInt32             ul_QueueId;            /* API_DATA_QUEUE_ID_BM_REC_BIUx */
+} TY_API_BM_MERGE_SOURCE;
+
+typedef struct ty_api_bm_merge_msg
+{
+    AiUInt32             ul_Source;             /* index of the source in the array passed to ApiBMMergeCreate */
+    TY_API_QUEUE_BUF_EX  x_Msg;
+} TY_API_BM_MERGE_MSG;
+
+/* Merged monitor stream handle, see ApiBMMergeCreate() */
+typedef struct ty_api_bm_merge TY_API_BM_MERGE;
+
 /***********************/
 /* interface functions */
 /***********************/
@@ -69,6 +107,12 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdQueueRead         (AiUInt32 bModule, AiU
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdQueueFlush        (AiUInt32 bModule, AiUInt8 biu);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdQueueStart        (AiUInt32 bModule, AiUInt8 biu);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdQueueHalt         (AiUInt32 bModule, AiUInt8 biu);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMStreamDecode       (TY_API_BM_STREAM_DECODE *px_Decode);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeCreate        (const TY_API_BM_MERGE_SOURCE *px_Sources, AiUInt32 ul_SourceCount,
+                                                           AiUInt32 ul_BufferSize, AiUInt32 ul_IdlePolls, TY_API_BM_MERGE **ppx_Merge);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeRead          (TY_API_BM_MERGE *px_Merge, AiUInt32 ul_Flags, TY_API_BM_MERGE_MSG *px_Msgs,
+                                                           AiUInt32 ul_MaxMsgs, AiUInt32 *pul_MsgCount);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeDelete        (TY_API_BM_MERGE *px_Merge);
 
 
 /**********************/
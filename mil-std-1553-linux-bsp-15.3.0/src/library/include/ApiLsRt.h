@@ -119,6 +119,16 @@ typedef struct ty_api_rt_dytag
     AiUInt16 wpos;
 } TY_API_RT_DYTAG;
 
+typedef struct ty_api_rt_dytag_def
+{
+    AiUInt8  con;
+    AiUInt8  padding1;
+    AiUInt16 rt_hid;
+    AiUInt16 mode;
+    AiUInt16 padding2;
+    TY_API_RT_DYTAG dytag[4];
+} TY_API_RT_DYTAG_DEF;
+
 typedef struct ty_api_rt_status_dsp
 {
     AiUInt8  status;
@@ -267,6 +277,7 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTSAConErr        (AiUInt32 bModule, AiU
                                                            AiUInt8 sa, AiUInt8 sa_type, TY_API_RT_ERR *perr);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDef        (AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
                                                            AiUInt16 rt_hid, AiUInt16 mode, TY_API_RT_DYTAG rt_dytag[4]);
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDefList    (AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_RT_DYTAG_DEF *pdefs);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTGetDytagDef     (AiUInt32 bModule, AiUInt8 biu, AiUInt16 rt_hid, AiUInt16 *mode,
                                                            TY_API_RT_DYTAG *rt_dytag);
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTStart           (AiUInt32 bModule, AiUInt8 biu);
@@ -307,6 +318,7 @@ AiReturn ApiCmdRTSACon_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_addr, AiUInt8
 AiReturn ApiCmdRTGetSAConErr_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_addr, AiUInt8 sa, AiUInt8 sa_type, TY_API_RT_ERR *perr);
 AiReturn ApiCmdRTSAConErr_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_addr, AiUInt8 sa, AiUInt8 sa_type, TY_API_RT_ERR *perr);
 AiReturn ApiCmdRTDytagDef_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt16 rt_hid, AiUInt16 mode, TY_API_RT_DYTAG rt_dytag[4]);
+AiReturn ApiCmdRTDytagDefList_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_RT_DYTAG_DEF *pdefs);
 AiReturn ApiCmdRTGetDytagDef_(AiUInt32 bModule, AiUInt8 biu, AiUInt16 rt_hid, AiUInt16 *mode, TY_API_RT_DYTAG *rt_dytag);
 AiReturn ApiCmdRTStart_(AiUInt32 bModule, AiUInt8 biu);
 AiReturn ApiCmdRTHalt_(AiUInt32 bModule, AiUInt8 biu);
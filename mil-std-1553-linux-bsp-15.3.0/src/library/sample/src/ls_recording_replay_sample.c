@@ -11,8 +11,10 @@ The transfer has a dynamic data word generation in data word position 1 enabled.
 The transfer is send 5000 times with RT and BM enabled.
 The test reads the BM with a threshold of a minimum of 128KB per BM read.
 The BM data is parsed to count the number of transfers in the data.
-Then the data is stored in a temporary file.
+Then the data is stored in a temporary file and in a block indexed recording file.
 At the end of the framing the test checks the recording file size and the transfer count obtained from the data.
+It also decodes each block of the indexed recording file and compares the messages and time tags with the
+block header, which the library builds from the raw BM entries.
 
 The replay part :
 This part is only executed if there was no error in the recording part.
@@ -34,8 +36,9 @@ static AiReturn StartRecording(AiUInt32 ulModHandle, AiUInt8 ucQueueId, AiUInt8
 static AiReturn StopRecording(AiUInt32 ulModHandle, AiUInt8 ucQueueId);
 static AiReturn CloseRecording(AiUInt32 ulModHandle, AiUInt8 ucQueueId);
 static AiReturn CheckRecording(AiUInt32 ulModHandle, AiUInt32 ulTotalMessageCount);
+static AiReturn CheckRecFile(AiUInt32 ulModHandle, AiUInt32 ulTotalMessageCount);
 static AiReturn IsQueueDataAvailable(AiUInt32 ulModHandle, AiUInt8 ucQueueId, AiUInt32 * pulDataAvailable);
-static AiReturn ReadData(AiUInt32 ulModHandle, AiUInt8 ucQueueId, FILE * pFile, AiUInt32 ulDataAvailable, AiUInt32 * pulMessageCount);
+static AiReturn ReadData(AiUInt32 ulModHandle, AiUInt8 ucQueueId, AiUInt32 ulBiu, FILE * pFile, AiUInt32 ulDataAvailable, AiUInt32 * pulMessageCount);
 
 
 
@@ -50,6 +53,8 @@ static AiReturn CheckReceivedData(AiUInt32 ulModHandle);
 
 /* Global constants */
 static char szGlobalFileName[AI_OS_MAX_PATH];
+static char szGlobalRecFileName[AI_OS_MAX_PATH];
+static TY_API_REC_FILE * pxGlobalRecFile = NULL;
 
 
 #define GLOBAL_RECORDING_BUFFER_SIZE (128*1024) /* Read  blocks of 128 KB */
@@ -85,6 +90,16 @@ AiReturn LsRecordingReplaySample(AiUInt32 ulModHandle, AiUInt32 ulStream, AiUInt
 
     strcpy( &szGlobalFileName[strlen(szGlobalFileName)], "ls_recording_replay_sample.prc" );
 
+    AiOsGetTempPath( szGlobalRecFileName, AI_OS_MAX_PATH );
+
+    if( strlen(szGlobalRecFileName) > (AI_OS_MAX_PATH - strlen("ls_recording_replay_sample.rec") ) )
+    {
+        printf("Error : Temp path too long\n" );
+        return 1;
+    }
+
+    strcpy( &szGlobalRecFileName[strlen(szGlobalRecFileName)], "ls_recording_replay_sample.rec" );
+
     /* Recording sample */
    ret = Recording( ulModHandle, ulStream, ucUseAns );
 
@@ -188,6 +203,15 @@ AiReturn Recording(AiUInt32 ulModHandle, AiUInt32 ulStream, AiUInt8 ucUseAns)
         printf("Recording file %s\n", szGlobalFileName );
     }
 
+    ret = ApiRecFileCreate( szGlobalRecFileName, API_REC_FILE_DEFAULT_BLOCK_SIZE, &pxGlobalRecFile );
+
+    if( ret )
+    {
+        printf("Error : could not create recording file %s\n", szGlobalRecFileName );
+        fclose(pWriteFile);
+        return 1;
+    }
+
     /************************************************/
     /*                                              */
     /* --  Read BM data as long as BC is active --- */
@@ -210,7 +234,7 @@ AiReturn Recording(AiUInt32 ulModHandle, AiUInt32 ulStream, AiUInt8 ucUseAns)
         }
 
         /* -- read available data --- */
-        ret = ReadData( ulModHandle, ucQueueId, pWriteFile, ulDataAvailable, &ulMessageCount );
+        ret = ReadData( ulModHandle, ucQueueId, ulBiu, pWriteFile, ulDataAvailable, &ulMessageCount );
 
         AIM_TRACE_RETURN( ret );
 
@@ -248,7 +272,7 @@ AiReturn Recording(AiUInt32 ulModHandle, AiUInt32 ulStream, AiUInt8 ucUseAns)
             break;
         }
 
-        ret = ReadData( ulModHandle, ucQueueId, pWriteFile, ulDataAvailable, &ulMessageCount );
+        ret = ReadData( ulModHandle, ucQueueId, ulBiu, pWriteFile, ulDataAvailable, &ulMessageCount );
 
         AIM_TRACE_RETURN( ret );
 
@@ -268,10 +292,20 @@ AiReturn Recording(AiUInt32 ulModHandle, AiUInt32 ulStream, AiUInt8 ucUseAns)
 
     fclose(pWriteFile);
 
+    /* Writes the last blocks and the index */
+    ret = ApiRecFileClose( pxGlobalRecFile );
+    pxGlobalRecFile = NULL;
+
+    AIM_ERROR_MESSAGE_RETURN( ret );
+
     /* Check if the file recorded is ok */
     ret = CheckRecording( ulModHandle, ulTotalMessageCount );
     AIM_TRACE_RETURN(ret);
 
+    /* Check if the block headers match the decoded data */
+    ret = CheckRecFile( ulModHandle, ulTotalMessageCount );
+    AIM_TRACE_RETURN(ret);
+
     return ret;
 }
 
@@ -303,7 +337,7 @@ AiReturn IsQueueDataAvailable(AiUInt32 ulModHandle, AiUInt8 ucQueueId, AiUInt32
 }
 
 
-AiReturn ReadData(AiUInt32 ulModHandle, AiUInt8 ucQueueId, FILE * pFile, AiUInt32 ulDataAvailable, AiUInt32 * pulMessageCount )
+AiReturn ReadData(AiUInt32 ulModHandle, AiUInt8 ucQueueId, AiUInt32 ulBiu, FILE * pFile, AiUInt32 ulDataAvailable, AiUInt32 * pulMessageCount )
 {
     AiReturn ret = 0;
     AiUInt8 *aucRecordingBuffer;
@@ -342,6 +376,11 @@ AiReturn ReadData(AiUInt32 ulModHandle, AiUInt8 ucQueueId, FILE * pFile, AiUInt3
     /* Save buffer to file */
     fwrite(aucRecordingBuffer, 1, xDataQueuStatus.bytes_transfered, pFile);
 
+    /* Save buffer to the indexed recording file, which takes a 0 based BIU */
+    ret = ApiRecFileWrite(pxGlobalRecFile, ulBiu - 1, aucRecordingBuffer, xDataQueuStatus.bytes_transfered);
+
+    AIM_ERROR_MESSAGE_RETURN( ret );
+
     MIL_UTIL_BM_INIT_ITERATOR(&xBmIterator, aucRecordingBuffer, xDataQueuStatus.bytes_transfered);
 
     *pulMessageCount = 0;
@@ -660,6 +699,109 @@ AiReturn CheckRecording(AiUInt32 ulModHandle, AiUInt32 ulTotalMessageCount )
 }
 
 
+/* The library takes the block header time tags from the raw BM entries, which are in target byte order.
+   Decoding each block and comparing its first and last time tag with the header verifies this conversion. */
+AiReturn CheckRecFile(AiUInt32 ulModHandle, AiUInt32 ulTotalMessageCount)
+{
+    AiReturn ret                 = 0;
+    AiReturn check               = 0;
+    AiUInt32 ulBlockCount        = 0;
+    AiUInt32 ulBytesRead         = 0;
+    AiUInt32 ulMessageCount      = 0;
+    AiUInt32 ulBlockMessageCount = 0;
+    AiUInt32 i                   = 0;
+    AiUInt8 *aucBlockBuffer      = NULL;
+    TY_API_REC_FILE      * pxRecFile = NULL;
+    TY_API_REC_FILE_BLOCK  xBlock;
+    MIL_UTIL_BM_ITERATOR   xBmIterator;
+    TY_API_QUEUE_BUF_EX    xBmInterpretedMessage;
+
+    memset(&xBlock, 0, sizeof(xBlock));
+    memset(&xBmInterpretedMessage, 0, sizeof(xBmInterpretedMessage));
+
+    ret = ApiRecFileOpen(szGlobalRecFileName, &pxRecFile);
+
+    AIM_ERROR_MESSAGE_RETURN( ret );
+
+    ret = ApiRecFileBlockCount(pxRecFile, &ulBlockCount);
+
+    for (i = 0; (ret == 0) && (check == 0) && (i < ulBlockCount); i++)
+    {
+        ret = ApiRecFileBlockInfo(pxRecFile, i, &xBlock);
+
+        if (ret)
+            break;
+
+        aucBlockBuffer = (AiUInt8 *)AiOsMalloc(xBlock.ul_ByteCount);
+        if (aucBlockBuffer == 0)
+        {
+            printf("unable to allocate aucBlockBuffer\n");
+            check = 1;
+            break;
+        }
+
+        ret = ApiRecFileBlockRead(pxRecFile, i, aucBlockBuffer, xBlock.ul_ByteCount, &ulBytesRead);
+
+        if (ret)
+        {
+            AiOsFree(aucBlockBuffer);
+            break;
+        }
+
+        MIL_UTIL_BM_INIT_ITERATOR(&xBmIterator, aucBlockBuffer, ulBytesRead);
+
+        ulBlockMessageCount = 0;
+        while (MilUtilBMLsInterpretData(ulModHandle, &xBmIterator, &xBmInterpretedMessage) == API_OK)
+        {
+            if ((ulBlockMessageCount == 0)
+                && ((xBmInterpretedMessage.ttag_hi != xBlock.ul_FirstTTHigh) || (xBmInterpretedMessage.ttag_lo != xBlock.ul_FirstTTLow)))
+            {
+                printf("Error : Block %d first time tag is 0x%08X 0x%08X, decoded 0x%08X 0x%08X\n", i,
+                    xBlock.ul_FirstTTHigh, xBlock.ul_FirstTTLow, xBmInterpretedMessage.ttag_hi, xBmInterpretedMessage.ttag_lo);
+                check = 1;
+            }
+
+            ulBlockMessageCount++;
+        }
+
+        AiOsFree(aucBlockBuffer);
+
+        if ((ulBlockMessageCount > 0)
+            && ((xBmInterpretedMessage.ttag_hi != xBlock.ul_LastTTHigh) || (xBmInterpretedMessage.ttag_lo != xBlock.ul_LastTTLow)))
+        {
+            printf("Error : Block %d last time tag is 0x%08X 0x%08X, decoded 0x%08X 0x%08X\n", i,
+                xBlock.ul_LastTTHigh, xBlock.ul_LastTTLow, xBmInterpretedMessage.ttag_hi, xBmInterpretedMessage.ttag_lo);
+            check = 1;
+        }
+
+        if (ulBlockMessageCount != xBlock.ul_MessageCount)
+        {
+            printf("Error : Block %d holds %d transfers, decoded %d\n", i, xBlock.ul_MessageCount, ulBlockMessageCount);
+            check = 1;
+        }
+
+        ulMessageCount += ulBlockMessageCount;
+    }
+
+    ApiRecFileClose(pxRecFile);
+
+    AIM_ERROR_MESSAGE_RETURN( ret );
+
+    if (check)
+        return 1;
+
+    if (ulMessageCount != ulTotalMessageCount)
+    {
+        printf("Error : Expected %d transfers in recording file got %d\n", ulTotalMessageCount, ulMessageCount);
+        return 1;
+    }
+
+    printf("Recording file holds %d transfers in %d blocks\n", ulMessageCount, ulBlockCount);
+
+    return 0;
+}
+
+
 
 
 
@@ -444,140 +444,41 @@ retuns 1 if the data is not valid
 */
 AiReturn MilUtilBMLsInterpretData(AiUInt32 ulModHandle, MIL_UTIL_BM_ITERATOR * pIterator, TY_API_QUEUE_BUF_EX * pInterpreted)
 {
-    AiUInt32 ulIndex             = 0;
-    AiUInt8  ucBMEntryType       = 0;
-    AiUInt32 ulBMEntryData       = 0;
-    AiUInt32 ulBufferIndex       = 0;
-    AiUInt32 ulCurrentEntry      = 0;
+    TY_API_BM_STREAM_DECODE xDecode;
     AiReturn ret             = API_OK;
 
     if (pIterator->iterator_position >= pIterator->buffer_end)
         return API_ERR_QUEUE_EMPTY;
 
-    if ((pIterator->iterator_position + 3) > pIterator->buffer_end)
-    {
-        fprintf(stderr, "Error: %s Not enough data\n", __FUNCTION__);
-        return API_ERR;
-    }
-
-    memset(pInterpreted, 0, sizeof(TY_API_QUEUE_BUF_EX));
+    memset(&xDecode, 0, sizeof(xDecode));
 
-    /* The longest BM message is (RT2RT) 38 DW */
-    /* TTHigh, TTLow, CW1, CW2, SW1, DW1..DW32, SW2 */
-    for (ulIndex=0; ulIndex<38; ulIndex++)
-    {
-        /* Interpret BM entry */
-        ulCurrentEntry = BSWAP32(*pIterator->iterator_position);
-        ucBMEntryType = (AiUInt8)(ulCurrentEntry >> 28); /* Bits 28 .. 31 */
-        ulBMEntryData = (AiUInt32)(ulCurrentEntry & 0x3ffffff); /* Bits  0 .. 26 */
+    /* Decode exactly one message. The iterator covers the whole data
+       so the last message in the buffer is complete as well. */
+    xDecode.pul_Data       = pIterator->iterator_position;
+    xDecode.ul_EntryCount  = (AiUInt32)(pIterator->buffer_end - pIterator->iterator_position);
+    xDecode.ul_Flags       = API_BM_STREAM_DECODE_FLUSH;
+    xDecode.px_Messages    = pInterpreted;
+    xDecode.ul_MaxMessages = 1;
 
-        // -- Message detection logic ---
-        if ((ulIndex == 0) && (ucBMEntryType != 0x3))
-        {
-            /* First entry is supposed to be a TTHigh */
-            ret = API_ERR;
-            fprintf(stderr, "Error: %s No time tag high\n", __FUNCTION__);
-            break;
-        }
+    ret = ApiBMStreamDecode(&xDecode);
 
-        if ((ulIndex == 1) && (ucBMEntryType != 0x2))
-        {
-            /* Second entry is supposed to be a TTLow */
-            ret = API_ERR;
-            fprintf(stderr, "Error: %s No time tag low\n", __FUNCTION__);
-            break;
-        }
-
-        if ((ulIndex > 0) && (ucBMEntryType == 0x3))
-        {
-            /* We found the TTHigh of the next message.
-               stop parsing here.
-               */
-            break;
-        }
+    AIM_ERROR_MESSAGE_RETURN(ret);
 
-        // -- Message data interpretation ---
+    pIterator->iterator_position += xDecode.ul_EntriesConsumed;
 
-        switch (ucBMEntryType)
-        {
-        case 0x1: /* Error Word           */
-            if (ulBMEntryData & API_BM_ET_NRESP_MASK) pInterpreted->msg_trw |= API_BM_MSG_ERR_NO_RESP    << 12;
-            else if (ulBMEntryData & API_BM_ET_MANCH_MASK)  pInterpreted->msg_trw |= API_BM_MSG_ERR_MANCH      << 12;
-            else if (ulBMEntryData & API_BM_ET_HBIT_MASK)   pInterpreted->msg_trw |= API_BM_MSG_ERR_HBIT       << 12;
-            else if (ulBMEntryData & API_BM_ET_LBIT_MASK)   pInterpreted->msg_trw |= API_BM_MSG_ERR_LBIT       << 12;
-            else if (ulBMEntryData & API_BM_ET_PAR_MASK)    pInterpreted->msg_trw |= API_BM_MSG_ERR_PARITY     << 12;
-            else if (ulBMEntryData & API_BM_ET_ISYNC_MASK)  pInterpreted->msg_trw |= API_BM_MSG_ERR_ISYNC      << 12;
-            else if (ulBMEntryData & API_BM_ET_IWGAP_MASK)  pInterpreted->msg_trw |= API_BM_MSG_ERR_GAP        << 12;
-            else if (ulBMEntryData & API_BM_ET_TX_MASK)     pInterpreted->msg_trw |= API_BM_MSG_ERR_BOTH_CHN   << 12;
-            else if (ulBMEntryData & API_BM_ET_ILLEGL_MASK) pInterpreted->msg_trw |= API_BM_MSG_ERR_MODECODE   << 12;
-            else if (ulBMEntryData & API_BM_ET_GAP_MASK)    pInterpreted->msg_trw |= API_BM_MSG_ERR_EARLY_RESP << 12;
-            else if (ulBMEntryData & API_BM_ET_TADDR_MASK)  pInterpreted->msg_trw |= API_BM_MSG_ERR_BIT_SET    << 12;
-            else if (ulBMEntryData & API_BM_ET_STAT_MASK)   pInterpreted->msg_trw |= API_BM_MSG_ERR_SW_EXCEPT  << 12;
-            else if (ulBMEntryData & API_BM_ET_HCNT_MASK)   pInterpreted->msg_trw |= API_BM_MSG_ERR_HCNT       << 12;
-            else if (ulBMEntryData & API_BM_ET_LCNT_MASK)   pInterpreted->msg_trw |= API_BM_MSG_ERR_LCNT       << 12;
-            else if (ulBMEntryData & API_BM_ET_ALTER_MASK)  pInterpreted->msg_trw |= API_BM_MSG_ERR_ILLEGL     << 12;
-            break;
-        case 0x2: /* Time Tag Low         */
-            pInterpreted->ttag_lo = ulBMEntryData;
-            break;
-        case 0x3: /* Time Tag High        */
-            pInterpreted->ttag_hi = ulBMEntryData;
-            break;
-        case 0x8: /* Command Word   (Pri) */
-            pInterpreted->rt_addr  = ((ulBMEntryData>>11) & 0x1F);
-            pInterpreted->sa_type  = ((ulBMEntryData>>10) & 0x1);
-            pInterpreted->sa_mc    = ((ulBMEntryData>>5) & 0x1F);
-            pInterpreted->word_cnt = ((ulBMEntryData)& 0x1F);
-            pInterpreted->rbf_trw = 1; /* Primary */
-            break;
-        case 0x9: /* Command Word 2 (Pri) */
-            pInterpreted->rt_addr2 = ((ulBMEntryData>>11) & 0x1F);
-            pInterpreted->sa_type2 = ((ulBMEntryData>>10) & 0x1);
-            pInterpreted->sa_mc2   = ((ulBMEntryData>>5) & 0x1F);
-            break;
-        case 0xa: /* Data Word      (Pri) */
-            pInterpreted->buffer[ulBufferIndex] = ulBMEntryData;
-            ulBufferIndex++;
-            break;
-        case 0xb: /* Status Word    (Pri) */
-            pInterpreted->msg_trw |= (1<<11);                 /* Bus Primary            */
-            pInterpreted->msg_trw |= (ulBMEntryData & 0x3FF); /* Status Word (Bit 0..10)*/
-            break;
-        case 0xc: /* Command Word   (Sec) */
-            pInterpreted->rt_addr  = ((ulBMEntryData>>11) & 0x1F);
-            pInterpreted->sa_type  = ((ulBMEntryData>>10) & 0x1);
-            pInterpreted->sa_mc    = ((ulBMEntryData>>5) & 0x1F);
-            pInterpreted->word_cnt = ((ulBMEntryData)& 0x1F);
-            pInterpreted->rbf_trw  = 0; /* Secondary */
-            break;
-        case 0xd: /* Command Word 2 (Sec) */
-            pInterpreted->rt_addr2 = ((ulBMEntryData>>11) & 0x1F);
-            pInterpreted->sa_type2 = ((ulBMEntryData>>10) & 0x1);
-            pInterpreted->sa_mc2   = ((ulBMEntryData>>5) & 0x1F);
-            break;
-        case 0xe: /* Data Word      (Sec) */
-            pInterpreted->buffer[ulBufferIndex] = ulBMEntryData;
-            ulBufferIndex++;
-            break;
-        case 0xf: /* Status Word    (Sec) */
-            pInterpreted->msg_trw &= ~(1<<11);                /* Bus Secondary          */
-            pInterpreted->msg_trw |= (ulBMEntryData & 0x3FF); /* Status Word (Bit 0..10)*/
-            break;
-        case 0x0: /* Entry not updated    */
-        default: /* Reserved 4..7        */
-            /* Ignored */
-            break;
-        }
-
-        pIterator->iterator_position++;
+    if (xDecode.ul_EntriesSkipped > 0)
+    {
+        fprintf(stderr, "Error: %s Skipped %d entries without time tag\n", __FUNCTION__, xDecode.ul_EntriesSkipped);
 
-        if (pIterator->iterator_position >= pIterator->buffer_end)
-            break;
+        /* Report the broken entries once and continue with the next message on the next call */
+        if (xDecode.ul_MessageCount == 0)
+            return API_ERR;
     }
 
-    // -- clean up ---- 
+    if (xDecode.ul_MessageCount == 0)
+        return API_ERR_QUEUE_EMPTY;
 
-    return ret;
+    return API_OK;
 }
 
 
@@ -21,6 +21,7 @@
 #define API_CMD_STRUCT_RT_SA_ERR_CON(x,y,z)         ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_RT_SA_ERR_GET(x,y,z)         ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_RT_DYTAG_DEF(x,y,z)          ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_RT_DYTAG_DEF_LIST(x,y,z)     ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_RT_DYTAG_GET(x,y,z)          ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_RT_START(x,y,z)              ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_RT_HALT(x,y,z)               ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
@@ -72,10 +73,19 @@
 #define API_CMD_STRUCT_LS_BC_MAJOR_FRAME_DEF(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_STATUS_READ(x,y,z)     ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_XFER_READ(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_XFER_READ_BULK(x,y,z)  ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_SRVW_REQ_READ(x,y,z)   ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_SRVW_REQ_CON(x,y,z)    ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_ACYC_PREP(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_ACYC_SEND(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_ACYC_QUEUE(x,y,z)      ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_ACYC_QUEUE_STATUS(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_SETUP_BULK(x,y,z)      ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_FRAME_SWAP(x,y,z)      ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_MODIFY_DEF_LIST(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_TIMING_CONTROL(x,y,z)  ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_STATUS_TIMING_READ(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_LS_BC_DYTAG_DEF_LIST(x,y,z)  ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_ACYC_PREP_AND_SEND_TRANSFER(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_MODE_CTRL(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_LS_BC_TRAFFIC_OVERRIDE_CONTROL(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
@@ -119,10 +129,14 @@
 #define API_CMD_STRUCT_BM_INI_TCB(x,y,z)            ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_RT_ACT_READ(x,y,z)        ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_RT_SA_ACT_READ(x,y,z)     ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_BM_RT_SA_ACT_SNAPSHOT(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_BM_STAT_CONTROL(x,y,z)       ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_BM_STAT_READ(x,y,z)          ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_INI_MSG_REC_FLT(x,y,z)    ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_MSG_REC_FLT(x,y,z)        ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_DYNTAG_MON_DEF(x,y,z)     ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_BM_DYNTAG_MON_READ(x,y,z)    ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
+#define API_CMD_STRUCT_BM_DYNTAG_MON_READ_BULK(x,y,z) ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 
 #define API_CMD_STRUCT_HS_BM_INI_INTR(x,y,z)        ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
 #define API_CMD_STRUCT_HS_BM_INI_CAP(x,y,z)         ApiIoStruct( x, (TY_MIL_COM*)y, (TY_MIL_COM_ACK*)z );
@@ -182,6 +182,30 @@ AiInt16 ApiCmdBCBHDef_(AiUInt32 bModule, AiUInt8 biu, AiUInt16 hid,
     return uw_RetVal;
 }
 
+// Parameter check shared by ApiCmdBCBHDef and ApiCmdBCSetupBulk
+static AiInt16 uw_BCBHDefCheck(AiUInt16 sid, AiUInt16 eid, AiUInt8 qsize, AiUInt8 bqm, AiUInt8 bsm,
+                               AiUInt8 sqm, AiUInt8 eqm, AiUInt8 dbm)
+{
+    if( sid != 0 )
+        return API_ERR_PARAM5_NOT_IN_RANGE;
+    if( eid != 0 )
+        return API_ERR_PARAM6_NOT_IN_RANGE;
+    if( qsize > MAX_QUEUE_SIZE )
+        return API_ERR_PARAM7_NOT_IN_RANGE;
+    if( bqm > MAX_BQM )
+        return API_ERR_PARAM8_NOT_IN_RANGE;
+    if( bsm > MAX_BSM )
+        return API_ERR_PARAM9_NOT_IN_RANGE;
+    if( sqm > API_SQM_AS_QSIZE )
+        return API_ERR_PARAM10_NOT_IN_RANGE;
+    if( eqm != 0 )
+        return API_ERR_PARAM11_NOT_IN_RANGE;
+    if( dbm != 0 )
+        return API_ERR_PARAM12_NOT_IN_RANGE;
+
+    return API_OK;
+}
+
 AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCBHDef(AiUInt32 bModule, AiUInt8 biu, AiUInt16 hid,
                                                 AiUInt16 bid, AiUInt16 sid, AiUInt16 eid,
                                                 AiUInt8 qsize, AiUInt8 bqm, AiUInt8 bsm,
@@ -192,25 +216,13 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCBHDef(AiUInt32 bModule, AiUInt8 biu, A
 
     if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
         uw_RetVal = API_ERR_WRONG_BIU;
-    else if( sid != 0 )
-        uw_RetVal = API_ERR_PARAM5_NOT_IN_RANGE;
-    else if( eid != 0 )
-        uw_RetVal = API_ERR_PARAM6_NOT_IN_RANGE;
-    else if( qsize > MAX_QUEUE_SIZE )
-        uw_RetVal = API_ERR_PARAM7_NOT_IN_RANGE;
-    else if( bqm > MAX_BQM )
-        uw_RetVal = API_ERR_PARAM8_NOT_IN_RANGE;
-    else if( bsm > MAX_BSM )
-        uw_RetVal = API_ERR_PARAM9_NOT_IN_RANGE;
-    else if( sqm > API_SQM_AS_QSIZE )
-        uw_RetVal = API_ERR_PARAM10_NOT_IN_RANGE;
-    else if( eqm != 0 )
-        uw_RetVal = API_ERR_PARAM11_NOT_IN_RANGE;
-    else if( dbm != 0 )
-        uw_RetVal = API_ERR_PARAM12_NOT_IN_RANGE;
-    else if( NULL == pbh )
-        uw_RetVal = API_ERR_PARAM13_IS_NULL;
     else
+        uw_RetVal = uw_BCBHDefCheck(sid, eid, qsize, bqm, bsm, sqm, eqm, dbm);
+
+    if( (API_OK == uw_RetVal) && (NULL == pbh) )
+        uw_RetVal = API_ERR_PARAM13_IS_NULL;
+
+    if( API_OK == uw_RetVal )
     {
     	uw_RetVal = ApiCmdBCBHDef_(bModule, biu, hid, bid, sid, eid, qsize, bqm, bsm, sqm, eqm, dbm, pbh);
     }
@@ -322,17 +334,12 @@ AiInt16 ApiCmdBCXferDef_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_XFER *pxfer, A
     return uw_RetVal;
 }
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferDef(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_XFER *pxfer, AiUInt32 *desc_addr)
+// Parameter check shared by ApiCmdBCXferDef and ApiCmdBCSetupBulk
+static AiInt16 uw_BCXferDefCheck(TY_API_BC_XFER *pxfer)
 {
     AiInt16 uw_RetVal = API_OK;
 
-    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
-        uw_RetVal = API_ERR_WRONG_BIU;
-    else if( NULL == pxfer )
-        uw_RetVal = API_ERR_PARAM3_IS_NULL;
-    else if( NULL == desc_addr )
-        uw_RetVal = API_ERR_PARAM4_IS_NULL;
-    else if( (pxfer->xid < MIN_XFER_ID) || (pxfer->xid > MAX_XFER_ID) )
+    if( (pxfer->xid < MIN_XFER_ID) || (pxfer->xid > MAX_XFER_ID) )
         uw_RetVal = API_ERR_XID_NOT_IN_RANGE;
     else if( pxfer->type > API_BC_TYPE_RTRT )
         uw_RetVal = API_ERR_TYPE_NOT_IN_RANGE;
@@ -373,24 +380,35 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferDef(AiUInt32 bModule, AiUInt8 biu,
         ((((pxfer->err.err_spec & API_BC_ERRSPEC_BCBITS_MASK) >> API_BC_ERRSPEC_BCBITS_POS) < MIN_ERR_BCBITS) ||
         (((pxfer->err.err_spec & API_BC_ERRSPEC_BCBITS_MASK) >> API_BC_ERRSPEC_BCBITS_POS) > MAX_ERR_BCBITS)) )
         uw_RetVal = API_ERR_ERRSPEC_BCBITS_NOT_IN_RANGE;
+    else if( pxfer->gap_mode < API_BC_GAP_MODE_FAST )
+    {
+        if( pxfer->gap > MAX_GAP_TIME_MODE_01 )
+            uw_RetVal = API_ERR_GAP_NOT_IN_RANGE;
+    }
     else
     {
-        if( pxfer->gap_mode < API_BC_GAP_MODE_FAST )
-        {
-            if( pxfer->gap > MAX_GAP_TIME_MODE_01 )
-                uw_RetVal = API_ERR_GAP_NOT_IN_RANGE;
-        }
-        else
-        {
-            if( pxfer->gap > MAX_GAP_TIME_MODE_2 )
-                uw_RetVal = API_ERR_GAP_NOT_IN_RANGE;
-        }
-
-        if( API_OK == uw_RetVal )
-        {
-            uw_RetVal = ApiCmdBCXferDef_(bModule, biu, pxfer, desc_addr);
-        }
+        if( pxfer->gap > MAX_GAP_TIME_MODE_2 )
+            uw_RetVal = API_ERR_GAP_NOT_IN_RANGE;
     }
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferDef(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_XFER *pxfer, AiUInt32 *desc_addr)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( NULL == pxfer )
+        uw_RetVal = API_ERR_PARAM3_IS_NULL;
+    else if( NULL == desc_addr )
+        uw_RetVal = API_ERR_PARAM4_IS_NULL;
+    else
+        uw_RetVal = uw_BCXferDefCheck(pxfer);
+
+    if( API_OK == uw_RetVal )
+        uw_RetVal = ApiCmdBCXferDef_(bModule, biu, pxfer, desc_addr);
     v_ExamineRetVal( "ApiCmdBCXferDef", uw_RetVal );
 
     TRACE_BEGIN
@@ -674,15 +692,11 @@ AiInt16 ApiCmdBCDytagDef_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
     return uw_RetVal;
 }
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDef(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
-                                                   AiUInt16 bc_hid, AiUInt16 mode,
-                                                   TY_API_BC_DYTAG *bc_dytag)
+// Parameter check shared by ApiCmdBCDytagDef and ApiCmdBCDytagDefList
+static AiInt16 uw_BCDytagDefCheck(AiUInt8 con, AiUInt16 mode, TY_API_BC_DYTAG *bc_dytag)
 {
     AiUInt32 i;
-    AiInt16 uw_RetVal = API_OK;
 
-    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
-        return API_ERR_WRONG_BIU;
     if( con > API_ENA )
         return API_ERR_PARAM3_NOT_IN_RANGE;
     if( mode > MAX_DYTAG_MODE )
@@ -723,6 +737,21 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDef(AiUInt32 bModule, AiUInt8 biu
         ((bc_dytag[3].wpos > MAX_WPOS) && (bc_dytag[3].tag_fct != API_DYTAG_FCT_DISABLE)) )
         return API_ERR_BCDYTAG_WPOS_NOT_IN_RANGE;
 
+    return API_OK;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDef(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
+                                                   AiUInt16 bc_hid, AiUInt16 mode,
+                                                   TY_API_BC_DYTAG *bc_dytag)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+
+    uw_RetVal = uw_BCDytagDefCheck(con, mode, bc_dytag);
+    if( API_OK != uw_RetVal )
+        return uw_RetVal;
 
     uw_RetVal = ApiCmdBCDytagDef_(bModule, biu, con, bc_hid, mode, bc_dytag);
 
@@ -748,6 +777,102 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDef(AiUInt32 bModule, AiUInt8 biu
     return uw_RetVal;
 } // end: ApiCmdBCDytagDef
 
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCDytagDefList
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Number of definitions [count],
+//                BC Dynamic Tagging definitions [pdefs]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies a list of BC dynamic tagging definitions, one per
+//    buffer header, with as few commands as possible. Every definition is
+//    checked like with ApiCmdBCDytagDef before the first one is sent.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBCDytagDefList_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_BC_DYTAG_DEF *pdefs)
+{
+    TY_MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT xInput;
+    TY_MIL_COM_ACK                        xOutput;
+    AiUInt32 ulDone, ulCount, i, j;
+    AiInt16 uw_RetVal = API_OK;
+
+    for( ulDone = 0; ulDone < count; ulDone += ulCount )
+    {
+        ulCount = count - ulDone;
+
+        if( ulCount > MIL_COM_LS_BC_DYTAG_DEF_LIST_MAX )
+            ulCount = MIL_COM_LS_BC_DYTAG_DEF_LIST_MAX;
+
+        xInput.cnt = ulCount;
+
+        for( i = 0; i < ulCount; i++ )
+        {
+            xInput.entry[i].con    = pdefs[ulDone + i].con;
+            xInput.entry[i].bc_hid = pdefs[ulDone + i].bc_hid;
+            xInput.entry[i].mode   = pdefs[ulDone + i].mode;
+
+            for( j = 0; j < 4; j++ )
+            {
+                xInput.entry[i].tag_fct[j] = pdefs[ulDone + i].dytag[j].tag_fct;
+                xInput.entry[i].min[j]     = pdefs[ulDone + i].dytag[j].min;
+                xInput.entry[i].max[j]     = pdefs[ulDone + i].dytag[j].max;
+                xInput.entry[i].step[j]    = pdefs[ulDone + i].dytag[j].step;
+                xInput.entry[i].wpos[j]    = pdefs[ulDone + i].dytag[j].wpos;
+            }
+        }
+
+        MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_DYTAG_DEF_LIST,
+                      MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE + ulCount * sizeof(TY_MIL_COM_LS_BC_DYTAG_DEF_ENTRY), sizeof(xOutput) );
+
+        uw_RetVal = API_CMD_STRUCT_LS_BC_DYTAG_DEF_LIST( bModule, &xInput, &xOutput );
+
+        if( API_OK != uw_RetVal )
+            break;
+    }
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCDytagDefList(AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_BC_DYTAG_DEF *pdefs)
+{
+    AiUInt32 i;
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( 0 == count )
+        return API_ERR_PARAM3_NOT_IN_RANGE;
+    if( NULL == pdefs )
+        return API_ERR_PARAM4_IS_NULL;
+
+    for( i = 0; (i < count) && (API_OK == uw_RetVal); i++ )
+        uw_RetVal = uw_BCDytagDefCheck(pdefs[i].con, pdefs[i].mode, pdefs[i].dytag);
+
+    if( API_OK == uw_RetVal )
+        uw_RetVal = ApiCmdBCDytagDefList_(bModule, biu, count, pdefs);
+
+    v_ExamineRetVal( "ApiCmdBCDytagDefList", uw_RetVal );
+
+    TRACE_BEGIN
+    TRACE("        TY_API_BC_DYTAG_DEF defs[...];\n");
+    TRACE_FCTA("ApiCmdBCDytagDefList", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(count);
+    TRACE_RPARE("defs");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCDytagDefList
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdBCFrameDef
@@ -794,15 +919,11 @@ AiInt16 ApiCmdBCFrameDef_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_FRAME  *pfram
     return uw_RetVal;
 }
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameDef(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_FRAME  *pframe)
+// Parameter check shared by ApiCmdBCFrameDef and ApiCmdBCSetupBulk
+static AiInt16 uw_BCFrameDefCheck(TY_API_BC_FRAME *pframe)
 {
     AiInt16 i = 0;
-    AiInt16 uw_RetVal = API_OK;
 
-    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
-        return API_ERR_WRONG_BIU;
-    if( NULL == pframe )
-        return API_ERR_PARAM3_IS_NULL;
     if( (pframe->id < MIN_API_BC_MFRAME) || (pframe->id > MAX_API_BC_MFRAME) )
         return API_ERR_FRAME_ID_NOT_IN_RANGE;
     if( (pframe->cnt < MIN_API_BC_XFRAME) || (pframe->cnt > MAX_API_BC_XFRAME) )
@@ -825,6 +946,24 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameDef(AiUInt32 bModule, AiUInt8 biu
         }
     }
 
+    return API_OK;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameDef(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_FRAME  *pframe)
+{
+    AiInt16 i = 0;
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( NULL == pframe )
+        return API_ERR_PARAM3_IS_NULL;
+
+    uw_RetVal = uw_BCFrameDefCheck(pframe);
+
+    if( API_OK != uw_RetVal )
+        return uw_RetVal;
+
     uw_RetVal = ApiCmdBCFrameDef_(bModule, biu, pframe);
     
     v_ExamineRetVal( "ApiCmdBCFrameDef", uw_RetVal );
@@ -1003,6 +1142,288 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCMFrameDefEx(AiUInt32 bModule, AiUInt8
     return uw_RetVal;
 } // end: ApiCmdBCMFrameDefEx
 
+
+//***************************************************************************
+//
+//   Module : APILSBC                  Submodule : ApiCmdBCSetupBulk
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : BC Buffer Headers, Transfers, Minor Frames and Major Frame
+//                to define [psetup]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BC_SETUP_BULK' instruction to the
+//    API1553-DS ASP Driver SW to define the BC Buffer Headers, Transfers,
+//    Minor Frames and the Major Frame of a BC setup with as few commands as
+//    possible. The definitions are packed into commands of up to
+//    MAX_TG_CMD_SIZE bytes and applied in this order. All entries are checked
+//    like in the single definition functions before the first command is
+//    sent. The Buffer Header info of ApiCmdBCBHDef can be read back with
+//    ApiCmdBCBHRead.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBCSetupBulk_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_SETUP_BULK *psetup)
+{
+    TY_MIL_COM_LS_BC_SETUP_BULK_INPUT * pxInput = NULL;
+    TY_MIL_COM_LS_BC_BULK_BH          * pxBh;
+    TY_MIL_COM_LS_BC_BULK_XFER        * pxXfer;
+    TY_MIL_COM_LS_BC_BULK_FRAME       * pxFrame;
+    TY_API_BC_XFER                    * pxfer;
+    TY_MIL_COM_ACK xOutput;
+    AiUInt32 ulBh = 0, ulXfer = 0, ulFrame = 0;
+    AiUInt32 ulMframeCnt, ulSize, i;
+    AiUInt32 * pulFid;
+    AiInt16 uw_RetVal = API_OK;
+
+    pxInput = (TY_MIL_COM_LS_BC_SETUP_BULK_INPUT*)AiOsMalloc(MAX_TG_CMD_SIZE);
+
+    if( NULL == pxInput )
+        return API_ERR_MALLOC_FAILED;
+
+    ulMframeCnt = psetup->pmframe ? psetup->pmframe->cnt : 0;
+
+    while( (ulBh < psetup->bh_cnt) || (ulXfer < psetup->xfer_cnt) || (ulFrame < psetup->frame_cnt) || (ulMframeCnt > 0) )
+    {
+        pxInput->bh_cnt     = 0;
+        pxInput->xfer_cnt   = 0;
+        pxInput->frame_cnt  = 0;
+        pxInput->mframe_cnt = 0;
+        ulSize              = MIL_COM_LS_BC_SETUP_BULK_INPUT_MINIMUM_SIZE;
+
+        // Buffer Headers
+        while( (ulBh < psetup->bh_cnt) && (ulSize + sizeof(TY_MIL_COM_LS_BC_BULK_BH) <= MAX_TG_CMD_SIZE) )
+        {
+            pxBh = (TY_MIL_COM_LS_BC_BULK_BH*)((AiUInt8*)pxInput + ulSize);
+
+            pxBh->hid   = psetup->pbh[ulBh].hid;
+            pxBh->bid   = psetup->pbh[ulBh].bid;
+            pxBh->sid   = psetup->pbh[ulBh].sid;
+            pxBh->eid   = psetup->pbh[ulBh].eid;
+            pxBh->qsize = psetup->pbh[ulBh].qsize;
+            pxBh->bqm   = psetup->pbh[ulBh].bqm;
+            pxBh->bsm   = psetup->pbh[ulBh].bsm;
+            pxBh->sqm   = psetup->pbh[ulBh].sqm;
+            pxBh->eqm   = psetup->pbh[ulBh].eqm;
+            pxBh->dbm   = psetup->pbh[ulBh].dbm;
+
+            ulSize += sizeof(TY_MIL_COM_LS_BC_BULK_BH);
+            pxInput->bh_cnt++;
+            ulBh++;
+        }
+
+        // Transfers, once all Buffer Headers are packed
+        while( (ulBh == psetup->bh_cnt) && (ulXfer < psetup->xfer_cnt) && (ulSize + sizeof(TY_MIL_COM_LS_BC_BULK_XFER) <= MAX_TG_CMD_SIZE) )
+        {
+            pxXfer = (TY_MIL_COM_LS_BC_BULK_XFER*)((AiUInt8*)pxInput + ulSize);
+            pxfer  = &psetup->pxfer[ulXfer];
+
+            pxXfer->xid         = pxfer->xid;
+            pxXfer->hid         = pxfer->hid;
+            pxXfer->xfer_type   = pxfer->type;
+            pxXfer->chn         = pxfer->chn;
+            pxXfer->xmt_rt      = pxfer->xmt_rt;
+            pxXfer->rcv_rt      = pxfer->rcv_rt;
+            pxXfer->xmt_sa      = pxfer->xmt_sa;
+            pxXfer->rcv_sa      = pxfer->rcv_sa;
+            pxXfer->wcnt        = pxfer->wcnt;
+            pxXfer->xfer_ir     = pxfer->tic;
+            pxXfer->xfer_hlt    = pxfer->hlt;
+            pxXfer->rte         = pxfer->rte;
+            pxXfer->sxh         = pxfer->sxh;
+            pxXfer->rsp         = pxfer->rsp;
+            pxXfer->res         = pxfer->res;
+            pxXfer->swxm        = pxfer->swxm;
+            pxXfer->err_type    = pxfer->err.type;
+            pxXfer->err_wpos    = (pxfer->err.err_spec >> 16) & 0xFF;
+            pxXfer->err_bpos    = (pxfer->err.err_spec >> 8)  & 0xFF;
+            pxXfer->err_sync    = pxfer->err.sync;
+            pxXfer->err_contig  = pxfer->err.contig;
+            pxXfer->err_bc_bits = (pxfer->err.err_spec) & 0xFF;
+            pxXfer->delay_mode  = pxfer->gap_mode;
+            pxXfer->gap         = pxfer->gap;
+
+            ulSize += sizeof(TY_MIL_COM_LS_BC_BULK_XFER);
+            pxInput->xfer_cnt++;
+            ulXfer++;
+        }
+
+        // Minor Frames, once all Transfers are packed
+        while( (ulXfer == psetup->xfer_cnt) && (ulFrame < psetup->frame_cnt)
+            && (ulSize + MIL_COM_LS_BC_BULK_FRAME_SIZE(psetup->pframe[ulFrame].cnt) <= MAX_TG_CMD_SIZE) )
+        {
+            pxFrame = (TY_MIL_COM_LS_BC_BULK_FRAME*)((AiUInt8*)pxInput + ulSize);
+
+            pxFrame->frame_id = psetup->pframe[ulFrame].id;
+            pxFrame->xfer_cnt = psetup->pframe[ulFrame].cnt;
+
+            for( i = 0; i < psetup->pframe[ulFrame].cnt; i++ )
+            {
+                pxFrame->data[i].instr = psetup->pframe[ulFrame].instr[i];
+                pxFrame->data[i].xid   = psetup->pframe[ulFrame].xid[i];
+            }
+
+            ulSize += MIL_COM_LS_BC_BULK_FRAME_SIZE(psetup->pframe[ulFrame].cnt);
+            pxInput->frame_cnt++;
+            ulFrame++;
+        }
+
+        // Major Frame, once all Minor Frames are packed
+        if( (ulFrame == psetup->frame_cnt) && (ulMframeCnt > 0) && (ulSize + ulMframeCnt * sizeof(AiUInt32) <= MAX_TG_CMD_SIZE) )
+        {
+            pulFid = (AiUInt32*)((AiUInt8*)pxInput + ulSize);
+
+            for( i = 0; i < ulMframeCnt; i++ )
+                pulFid[i] = psetup->pmframe->fid[i];
+
+            ulSize += ulMframeCnt * sizeof(AiUInt32);
+            pxInput->mframe_cnt = ulMframeCnt;
+            ulMframeCnt = 0;
+        }
+
+        MIL_COM_INIT( &pxInput->cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_SETUP_BULK, ulSize, sizeof(xOutput) );
+
+        uw_RetVal = API_CMD_STRUCT_LS_BC_SETUP_BULK( bModule, pxInput, &xOutput );
+
+        if( API_OK != uw_RetVal )
+            break;
+    }
+
+    AiOsFree(pxInput);
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCSetupBulk(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_SETUP_BULK *psetup)
+{
+    TY_API_BC_BH_DEF * pbh;
+    AiUInt32 i;
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( NULL == psetup )
+        return API_ERR_PARAM3_IS_NULL;
+    if( ((psetup->bh_cnt > 0) && (NULL == psetup->pbh)) || ((psetup->xfer_cnt > 0) && (NULL == psetup->pxfer)) || ((psetup->frame_cnt > 0) && (NULL == psetup->pframe)) )
+        return API_ERR_PARAM3_IS_NULL;
+    if( psetup->frame_cnt > MAX_API_BC_MFRAME_ID )
+        return API_ERR_PARAM3_NOT_IN_RANGE;
+
+    for( i = 0; i < psetup->bh_cnt; i++ )
+    {
+        pbh = &psetup->pbh[i];
+
+        uw_RetVal = uw_BCBHDefCheck(pbh->sid, pbh->eid, pbh->qsize, pbh->bqm, pbh->bsm, pbh->sqm, pbh->eqm, pbh->dbm);
+
+        if( API_OK != uw_RetVal )
+            return uw_RetVal;
+    }
+
+    for( i = 0; i < psetup->xfer_cnt; i++ )
+    {
+        uw_RetVal = uw_BCXferDefCheck(&psetup->pxfer[i]);
+
+        if( API_OK != uw_RetVal )
+            return uw_RetVal;
+    }
+
+    for( i = 0; i < psetup->frame_cnt; i++ )
+    {
+        uw_RetVal = uw_BCFrameDefCheck(&psetup->pframe[i]);
+
+        if( API_OK != uw_RetVal )
+            return uw_RetVal;
+    }
+
+    if( NULL != psetup->pmframe )
+    {
+        if( (psetup->pmframe->cnt < MIN_API_BC_MFRAME) || (psetup->pmframe->cnt > MAX_API_BC_MFRAME_EX) )
+            return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+        for( i = 0; i < psetup->pmframe->cnt; i++ )
+        {
+            if( (psetup->pmframe->fid[i] < MIN_API_BC_MFRAME_ID) || (psetup->pmframe->fid[i] > MAX_API_BC_MFRAME_ID))
+                return API_ERR_FRAME_FID_NOT_IN_RANGE;
+        }
+    }
+
+    uw_RetVal = ApiCmdBCSetupBulk_( bModule, biu, psetup );
+
+    v_ExamineRetVal( "ApiCmdBCSetupBulk", uw_RetVal );
+
+    TRACE_BEGIN
+    TRACE ("        TY_API_BC_SETUP_BULK setup;\n");
+    TRACE1("        setup.bh_cnt    = 0x%x;\n", psetup->bh_cnt);
+    TRACE1("        setup.xfer_cnt  = 0x%x;\n", psetup->xfer_cnt);
+    TRACE1("        setup.frame_cnt = 0x%x;\n", psetup->frame_cnt);
+    TRACE1("        setup.pmframe   = %s;\n", psetup->pmframe ? "&mframe" : "NULL");
+    TRACE_FCTA("ApiCmdBCSetupBulk", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_RPARE("&setup");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCSetupBulk
+
+//***************************************************************************
+//
+//   Module : APILSBC                  Submodule : ApiCmdBCFrameSwap
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : none
+//
+//    Outputs   : none
+//
+//    Description :
+//    This function applies the 'TG_API_BC_FRAME_SWAP' instruction to the
+//    API1553-DS ASP Driver SW to rebuild the running Major Frame from the
+//    current frame definitions. The new frames are activated at the next
+//    Major Frame boundary.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBCFrameSwap_(AiUInt32 bModule, AiUInt8 biu)
+{
+    TY_MIL_COM     xInput;
+    TY_MIL_COM_ACK xOutput;
+    AiInt16 uw_RetVal = API_OK;
+
+    MIL_COM_INIT( &xInput, API_STREAM(bModule), 0, MIL_COM_LS_BC_FRAME_SWAP, sizeof(xInput), sizeof(xOutput) );
+
+    uw_RetVal = API_CMD_STRUCT_LS_BC_FRAME_SWAP( bModule, &xInput, &xOutput );
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCFrameSwap(AiUInt32 bModule, AiUInt8 biu)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+
+    uw_RetVal = ApiCmdBCFrameSwap_( bModule, biu );
+
+    v_ExamineRetVal( "ApiCmdBCFrameSwap", uw_RetVal );
+
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdBCFrameSwap", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARE(biu);
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCFrameSwap
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdBCStart
@@ -1197,48 +1618,241 @@ AiInt16 ApiCmdBCStatusRead_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_STATUS_DSP
 
     uw_RetVal = API_CMD_STRUCT_LS_BC_STATUS_READ( bModule, &xInput, &xOutput );
 
-    pdsp->glb_err_cnt    = xOutput.bc_ec;
-    pdsp->glb_msg_cnt    = xOutput.bc_mc;
-    pdsp->hip            = xOutput.hip;
-    pdsp->hxfer          = xOutput.hxfer;
-    pdsp->mfc            = xOutput.mfc;
-    pdsp->padding1       = 0;
-    pdsp->status         = xOutput.status;
+    pdsp->glb_err_cnt    = xOutput.bc_ec;
+    pdsp->glb_msg_cnt    = xOutput.bc_mc;
+    pdsp->hip            = xOutput.hip;
+    pdsp->hxfer          = xOutput.hxfer;
+    pdsp->mfc            = xOutput.mfc;
+    pdsp->padding1       = 0;
+    pdsp->status         = xOutput.status;
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStatusRead(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_STATUS_DSP *pdsp)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( NULL == pdsp )
+        return API_ERR_PARAM3_IS_NULL;
+
+    uw_RetVal = ApiCmdBCStatusRead_( bModule, biu, pdsp);
+
+    v_ExamineRetVal( "ApiCmdBCStatusRead", uw_RetVal );
+
+    TRACE_BEGIN
+    TRACE ("    TY_API_BC_STATUS_DSP dsp;\n");
+    TRACE_FCTA("ApiCmdBCStatusRead", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_RPARE("&dsp");
+    TRACE_FCTE;
+    TRACE1("    --> dsp.glb_err_cnt = 0x%x\n", pdsp->glb_err_cnt);
+    TRACE1("    --> dsp.glb_msg_cnt = 0x%x\n", pdsp->glb_msg_cnt);
+    TRACE1("    --> dsp.hip         = 0x%x\n", pdsp->hip);
+    TRACE1("    --> dsp.hxfer       = 0x%x\n", pdsp->hxfer);
+    TRACE1("    --> dsp.mfc         = 0x%x\n", pdsp->mfc);
+    TRACE1("    --> dsp.padding1    = 0x%x\n", pdsp->padding1);
+    TRACE1("    --> dsp.status      = 0x%x\n", pdsp->status);
+    TRACE_END
+
+    return(uw_RetVal);
+} // end: ApiCmdBCStatusRead
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCTimingControl
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Timing monitor control [con]
+//                Overrun tolerance in us [tolerance]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BC_TIMING_CONTROL' instruction to
+//    the API1553-DS ASP Driver SW to enable, disable or reset the on-target
+//    BC schedule timing monitor. The monitor applies to Major Frames set up
+//    by the next BC start or frame swap. Transfers are only accounted if
+//    their transfer interrupt is enabled. Disable and reset are rejected
+//    while the BC is running. The tolerance is applied on enable, also to
+//    an enabled monitor. Values below API_BC_TIMING_TOLERANCE_MIN are raised
+//    to it, so that time tag jitter is not counted as overrun.
+//
+//***************************************************************************
+AiInt16 ApiCmdBCTimingControl_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt32 tolerance)
+{
+    TY_MIL_COM_LS_BC_TIMING_CONTROL_INPUT xInput;
+    TY_MIL_COM_ACK                        xOutput;
+    AiInt16 uw_RetVal = API_OK;
+
+    xInput.con       = con;
+    xInput.tolerance = tolerance;
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_TIMING_CONTROL, sizeof(xInput), sizeof(xOutput) );
+
+    uw_RetVal = API_CMD_STRUCT_LS_BC_TIMING_CONTROL( bModule, &xInput, &xOutput );
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCTimingControl(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt32 tolerance)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( con > API_BC_TIMING_RESET )
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else
+    {
+        uw_RetVal = ApiCmdBCTimingControl_( bModule, biu, con, tolerance );
+    }
+
+    v_ExamineRetVal( "ApiCmdBCTimingControl", uw_RetVal );
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdBCTimingControl", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(con);
+    TRACE_PARE(tolerance);
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCTimingControl
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCStatusTimingRead
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : First Transfer identifier [xid_first]
+//                Number of Transfers [xid_count]
+//
+//    Outputs   : Instruction execution status [status]
+//                BC Status and Minor Frame timing [ptiming]
+//                Timing of each Transfer [pxfer]
+//
+//    Description :
+//    This function applies the 'TG_API_BC_STATUS_TIMING_READ' instruction
+//    to the API1553-DS ASP Driver SW to read the BC status together with
+//    the on-target BC schedule timing. The transfers are read in chunks of
+//    MIL_COM_LS_BC_TIMING_MAX_XFER, the BC status and Minor Frame timing
+//    are taken from the last chunk.
+//
+//***************************************************************************
+static void v_BCTimingTimeCopy( TY_API_BC_TIMING_TIME * px_Time, TY_MIL_COM_LS_BC_TIMING_TIME * px_Target )
+{
+    px_Time->count = px_Target->count;
+    px_Time->min   = px_Target->min;
+    px_Time->max   = px_Target->max;
+    px_Time->mean  = px_Target->mean;
+}
+
+AiInt16 ApiCmdBCStatusTimingRead_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 xid_first, AiUInt32 xid_count, TY_API_BC_STATUS_TIMING *ptiming, TY_API_BC_TIMING_XFER *pxfer)
+{
+    TY_MIL_COM_LS_BC_STATUS_TIMING_READ_INPUT    xInput;
+    TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT * pxOutput = NULL;
+    AiUInt32 ulAckSize = MIL_COM_LS_BC_STATUS_TIMING_READ_ACK_SIZE(MIL_COM_LS_BC_TIMING_MAX_XFER);
+    AiUInt32 ulDone, ulCount, i;
+    AiUInt32 * pulData;
+    AiInt16 uw_RetVal = API_OK;
+
+    pxOutput = (TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT*)AiOsMalloc(ulAckSize);
+
+    if( NULL == pxOutput )
+        return API_ERR_MALLOC_FAILED;
+
+    for( ulDone = 0; ulDone < xid_count; ulDone += ulCount )
+    {
+        ulCount = xid_count - ulDone;
+
+        if( ulCount > MIL_COM_LS_BC_TIMING_MAX_XFER )
+            ulCount = MIL_COM_LS_BC_TIMING_MAX_XFER;
+
+        xInput.xid_first = xid_first + ulDone;
+        xInput.xid_count = ulCount;
+
+        MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_STATUS_TIMING_READ, sizeof(xInput), MIL_COM_LS_BC_STATUS_TIMING_READ_ACK_SIZE(ulCount) );
+
+        uw_RetVal = API_CMD_STRUCT_LS_BC_STATUS_TIMING_READ( bModule, &xInput, pxOutput );
+
+        if( API_OK != uw_RetVal )
+            break;
+
+        pulData = pxOutput->data;
+
+        for( i = 0; i < ulCount; i++ )
+        {
+            pxfer[ulDone + i].offset.count = *pulData++;
+            pxfer[ulDone + i].offset.min   = *pulData++;
+            pxfer[ulDone + i].offset.max   = *pulData++;
+            pxfer[ulDone + i].offset.mean  = *pulData++;
+            pxfer[ulDone + i].overrun      = *pulData++;
+        }
+    }
+
+    if( API_OK == uw_RetVal )
+    {
+        ptiming->status.status      = (AiUInt8)pxOutput->status;
+        ptiming->status.padding1    = 0;
+        ptiming->status.hxfer       = (AiUInt16)pxOutput->hxfer;
+        ptiming->status.glb_msg_cnt = pxOutput->bc_mc;
+        ptiming->status.glb_err_cnt = pxOutput->bc_ec;
+        ptiming->status.hip         = pxOutput->hip;
+        ptiming->status.mfc         = pxOutput->mfc;
+        ptiming->ftime              = pxOutput->ftime;
+        ptiming->frame_overrun      = pxOutput->frame_overrun;
+
+        v_BCTimingTimeCopy( &ptiming->interval, &pxOutput->interval );
+    }
+
+    AiOsFree(pxOutput);
 
     return uw_RetVal;
 }
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStatusRead(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_STATUS_DSP *pdsp)
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCStatusTimingRead(AiUInt32 bModule, AiUInt8 biu, AiUInt32 xid_first, AiUInt32 xid_count, 
+                                                           TY_API_BC_STATUS_TIMING *ptiming, TY_API_BC_TIMING_XFER *pxfer)
 {
     AiInt16 uw_RetVal = API_OK;
 
     if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
-        return API_ERR_WRONG_BIU;
-    if( NULL == pdsp )
-        return API_ERR_PARAM3_IS_NULL;
-
-    uw_RetVal = ApiCmdBCStatusRead_( bModule, biu, pdsp);
-
-    v_ExamineRetVal( "ApiCmdBCStatusRead", uw_RetVal );
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( 0 == xid_count )
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if( NULL == ptiming )
+        uw_RetVal = API_ERR_PARAM5_IS_NULL;
+    else if( NULL == pxfer )
+        uw_RetVal = API_ERR_PARAM6_IS_NULL;
+    else
+    {
+        uw_RetVal = ApiCmdBCStatusTimingRead_( bModule, biu, xid_first, xid_count, ptiming, pxfer );
+    }
 
+    v_ExamineRetVal( "ApiCmdBCStatusTimingRead", uw_RetVal );
     TRACE_BEGIN
-    TRACE ("    TY_API_BC_STATUS_DSP dsp;\n");
-    TRACE_FCTA("ApiCmdBCStatusRead", uw_RetVal); 
+    TRACE("        TY_API_BC_STATUS_TIMING timing;\n");
+    TRACE("        TY_API_BC_TIMING_XFER   xfer[...];\n");
+    TRACE_FCTA("ApiCmdBCStatusTimingRead", uw_RetVal); 
     TRACE_PARA(bModule);
     TRACE_PARA(biu);
-    TRACE_RPARE("&dsp");
+    TRACE_PARA(xid_first);
+    TRACE_PARA(xid_count);
+    TRACE_RPARA("&timing");
+    TRACE_RPARE("xfer");
     TRACE_FCTE;
-    TRACE1("    --> dsp.glb_err_cnt = 0x%x\n", pdsp->glb_err_cnt);
-    TRACE1("    --> dsp.glb_msg_cnt = 0x%x\n", pdsp->glb_msg_cnt);
-    TRACE1("    --> dsp.hip         = 0x%x\n", pdsp->hip);
-    TRACE1("    --> dsp.hxfer       = 0x%x\n", pdsp->hxfer);
-    TRACE1("    --> dsp.mfc         = 0x%x\n", pdsp->mfc);
-    TRACE1("    --> dsp.padding1    = 0x%x\n", pdsp->padding1);
-    TRACE1("    --> dsp.status      = 0x%x\n", pdsp->status);
     TRACE_END
 
-    return(uw_RetVal);
-} // end: ApiCmdBCStatusRead
+    return uw_RetVal;
+} // end: ApiCmdBCStatusTimingRead
 
 //***************************************************************************
 //
@@ -1338,6 +1952,136 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferRead(AiUInt32 bModule, AiUInt8 biu
     return uw_RetVal;
 } // end: ApiCmdBCXferRead
 
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCXferReadBulk
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : First BC Transfer identifier [xid_first]
+//                Number of BC Transfers [count]
+//                BC Transfer identifier list [pxid_list]
+//                Buffer Status Flag control [clr]
+//
+//    Outputs   : BC Transfer states [pxfer_state]
+//
+//    Description :
+//    This function applies the 'TG_API_BC_XFER_READ_BULK' instruction to the
+//    API1553-DS ASP Driver SW to read message/error counter, last status
+//    words, current buffer and time tag of many BC Transfers. If pxid_list
+//    is NULL the count transfers starting with xid_first are read, otherwise
+//    the count transfers of the list. pxfer_state must provide count entries.
+//    Up to MIL_COM_LS_BC_XFER_READ_BULK_MAX transfers are read per command.
+//
+//***************************************************************************
+AiInt16 ApiCmdBCXferReadBulk_(AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid_first, AiUInt16 count, AiUInt16 *pxid_list,
+                              AiUInt16 clr, TY_API_BC_XFER_STATE *pxfer_state)
+{
+    TY_MIL_COM_LS_BC_XFER_READ_BULK_INPUT    xInput;
+    TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT * pxOutput = NULL;
+    AiUInt32 ulDone, ulChunk, ulInputSize, i;
+    AiInt16 uw_RetVal = API_OK;
+
+    pxOutput = (TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT*)AiOsMalloc(sizeof(TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT));
+
+    if( NULL == pxOutput )
+        return API_ERR_MALLOC_FAILED;
+
+    for( ulDone = 0; ulDone < count; ulDone += ulChunk )
+    {
+        ulChunk = count - ulDone;
+
+        if( ulChunk > MIL_COM_LS_BC_XFER_READ_BULK_MAX )
+            ulChunk = MIL_COM_LS_BC_XFER_READ_BULK_MAX;
+
+        xInput.count = ulChunk;
+        xInput.clr   = clr;
+
+        if( NULL == pxid_list )
+        {
+            xInput.xid_first = xid_first + ulDone;
+            ulInputSize      = MIL_COM_LS_BC_XFER_READ_BULK_INPUT_MINIMUM_SIZE;
+        }
+        else
+        {
+            xInput.xid_first = 0;
+            ulInputSize      = MIL_COM_LS_BC_XFER_READ_BULK_INPUT_MINIMUM_SIZE + ulChunk * sizeof(AiUInt32);
+
+            for( i = 0; i < ulChunk; i++ )
+                xInput.xid[i] = pxid_list[ulDone + i];
+        }
+
+        MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_XFER_READ_BULK, ulInputSize, MIL_COM_LS_BC_XFER_READ_BULK_ACK_SIZE(ulChunk) );
+
+        uw_RetVal = API_CMD_STRUCT_LS_BC_XFER_READ_BULK( bModule, &xInput, pxOutput );
+
+        if( API_OK != uw_RetVal )
+            break;
+
+        for( i = 0; i < ulChunk; i++ )
+        {
+            pxfer_state[ulDone + i].msg_cnt = pxOutput->xfer[i].msg_cnt;
+            pxfer_state[ulDone + i].err_cnt = pxOutput->xfer[i].err_cnt;
+            pxfer_state[ulDone + i].st1     = (AiUInt16)(pxOutput->xfer[i].st2_st1 & 0xFFFF);
+            pxfer_state[ulDone + i].st2     = (AiUInt16)(pxOutput->xfer[i].st2_st1 >> 16);
+            pxfer_state[ulDone + i].bid     = (AiUInt16)(pxOutput->xfer[i].brw_bid & 0xFFFF);
+            pxfer_state[ulDone + i].brw     = (AiUInt16)(pxOutput->xfer[i].brw_bid >> 16);
+            pxfer_state[ulDone + i].ttag    = pxOutput->xfer[i].ttag;
+        }
+    }
+
+    AiOsFree(pxOutput);
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCXferReadBulk(AiUInt32 bModule, AiUInt8 biu, AiUInt16 xid_first, AiUInt16 count, AiUInt16 *pxid_list,
+                                                       AiUInt16 clr, TY_API_BC_XFER_STATE *pxfer_state)
+{
+    AiInt16 uw_RetVal = API_OK;
+    AiUInt32 i;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( (NULL == pxid_list) && ((xid_first < MIN_XFER_ID) || (xid_first > MAX_XFER_ID)) )
+        return API_ERR_PARAM3_NOT_IN_RANGE;
+    if( (count < 1) || ((NULL == pxid_list) && (count > (MAX_XFER_ID + 1 - xid_first))) )
+        return API_ERR_PARAM4_NOT_IN_RANGE;
+    if( clr > MAX_CLR )
+        return API_ERR_PARAM6_NOT_IN_RANGE;
+    if( NULL == pxfer_state )
+        return API_ERR_PARAM7_IS_NULL;
+
+    if( NULL != pxid_list )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            if( (pxid_list[i] < MIN_XFER_ID) || (pxid_list[i] > MAX_XFER_ID) )
+                return API_ERR_PARAM5_NOT_IN_RANGE;
+        }
+    }
+
+    uw_RetVal = ApiCmdBCXferReadBulk_( bModule, biu, xid_first, count, pxid_list, clr, pxfer_state );
+
+    v_ExamineRetVal( "ApiCmdBCXferReadBulk", uw_RetVal );
+
+    TRACE_BEGIN
+    TRACE1("    TY_API_BC_XFER_STATE xfer_state[%d];\n", count);
+    TRACE_FCTA("ApiCmdBCXferReadBulk", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(xid_first);
+    TRACE_PARA(count);
+    TRACE_RPARA(pxid_list ? "xid_list" : "NULL");
+    TRACE_PARA(clr);
+    TRACE_RPARE("xfer_state");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCXferReadBulk
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdBCXferReadEx
@@ -1653,6 +2397,175 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycSend(AiUInt32 bModule, AiUInt8 biu
     return uw_RetVal;
 } // end: ApiCmdBCAcycSend
 
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCAcycQueue
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Acyclic burst [pacyc]
+//
+//    Outputs   : Queue state after the call [pstatus], may be NULL
+//
+//    Description :
+//    This function applies the 'TG_API_BC_ACYC_QUEUE' instruction to the
+//    API1553-DS ASP Driver SW to append an acyclic burst to the BC acyclic
+//    queue. The burst is started as soon as the previous queued burst has
+//    completed, the function does not wait for this. API_ERR_AGAIN is
+//    returned if all queue slots are in use.
+//    The queue shares the acyclic instruction list with ApiCmdBCAcycPrep
+//    and ApiCmdBCAcycSend, which return API_ERR_AGAIN while queued bursts
+//    are not completed.
+//
+//***************************************************************************
+
+static void v_BCAcycQueueStatusCopy(TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT *pxOutput, TY_API_BC_ACYC_QUEUE_STATUS *pstatus)
+{
+    if( NULL == pstatus )
+        return;
+
+    pstatus->pending = pxOutput->pending;
+    pstatus->running = pxOutput->running;
+    pstatus->free    = pxOutput->free;
+    pstatus->done    = pxOutput->done;
+}
+
+AiInt16 ApiCmdBCAcycQueue_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc, TY_API_BC_ACYC_QUEUE_STATUS *pstatus)
+{
+    TY_MIL_COM_LS_BC_ACYC_QUEUE_INPUT  xInput;
+    TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT xOutput;
+    AiInt16 i = 0;
+    AiInt16 uw_RetVal = API_OK;
+    AiUInt32 ulInputSize = MIL_COM_LS_BC_ACYC_QUEUE_INPUT_MINIMUM_SIZE + pacyc->cnt * sizeof(TY_BC_INSTRUCTION);
+
+    xInput.xfer_cnt = pacyc->cnt;
+    for (i=0; (i < pacyc->cnt) && (i < MIL_COM_LS_BC_ACYC_QUEUE_MAX); i++)
+    {
+        xInput.data[i].instr = pacyc->instr[i];
+        xInput.data[i].xid   = pacyc->xid[i];
+    }
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_ACYC_QUEUE, ulInputSize, sizeof(xOutput) );
+
+    uw_RetVal = API_CMD_STRUCT_LS_BC_ACYC_QUEUE( bModule, &xInput, &xOutput );
+
+    if( API_OK == uw_RetVal )
+        v_BCAcycQueueStatusCopy( &xOutput, pstatus );
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycQueue(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC *pacyc, TY_API_BC_ACYC_QUEUE_STATUS *pstatus)
+{
+    AiInt16 i = 0;
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( NULL == pacyc )
+        return API_ERR_PARAM3_IS_NULL;
+    if( (pacyc->cnt < MIN_API_BC_XFRAME) || (pacyc->cnt > MAX_API_BC_XACYC_QUEUE) )
+        return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+    for( i=0; i<pacyc->cnt; i++ )
+    {
+        if( (pacyc->instr[i] < MIN_INSTR_NR) || (pacyc->instr[i] > MAX_INSTR_NR))
+            return API_ERR_FRAME_INSTR_NOT_IN_RANGE;
+
+        if( API_BC_INSTR_TRANSFER == pacyc->instr[i] )
+        {
+            if( (pacyc->xid[i] < MIN_XFER_ID) || (pacyc->xid[i] > MAX_XFER_ID) )
+                return API_ERR_FRAME_XID_NOT_IN_RANGE;
+        }
+        if( API_BC_INSTR_WAIT == pacyc->instr[i] )
+            return API_ERR_FRAME_XID_NOT_IN_RANGE;
+        if( API_BC_INSTR_STROBE == pacyc->instr[i] )
+        {
+            if( pacyc->xid[i] != 0 )
+                return API_ERR_FRAME_XID_NOT_IN_RANGE;
+        }
+    }
+
+    uw_RetVal = ApiCmdBCAcycQueue_( bModule, biu, pacyc, pstatus );
+
+    v_ExamineRetVal( "ApiCmdBCAcycQueue", uw_RetVal );
+    TRACE_BEGIN
+    TRACE ("        TY_API_BC_ACYC   acyc;\n");
+    TRACE ("        TY_API_BC_ACYC_QUEUE_STATUS status;\n");
+    TRACE1("        acyc.cnt      = 0x%x;\n", pacyc->cnt);
+    for(i=0; i<pacyc->cnt; i++ )
+    {
+        TRACE1("        acyc.instr[%d] = ", i); TRACE2("0x%x;\n", pacyc->instr[i]);
+        TRACE1("        acyc.xid[%d]   = ", i); TRACE2("0x%x;\n", pacyc->xid[i]);
+    }
+    TRACE_FCTA("ApiCmdBCAcycQueue", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_RPARA("&acyc");
+    TRACE_RPARE("&status");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCAcycQueue
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBCAcycQueueStatus
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : none
+//
+//    Outputs   : Queue state [pstatus]
+//
+//    Description :
+//    This function applies the 'TG_API_BC_ACYC_QUEUE_STATUS' instruction to
+//    the API1553-DS ASP Driver SW to read the state of the BC acyclic queue.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBCAcycQueueStatus_(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC_QUEUE_STATUS *pstatus)
+{
+    TY_MIL_COM                         xInput;
+    TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT xOutput;
+    AiInt16 uw_RetVal = API_OK;
+
+    MIL_COM_INIT( &xInput, API_STREAM(bModule), 0, MIL_COM_LS_BC_ACYC_QUEUE_STATUS, sizeof(xInput), sizeof(xOutput) );
+
+    uw_RetVal = API_CMD_STRUCT_LS_BC_ACYC_QUEUE_STATUS( bModule, &xInput, &xOutput );
+
+    if( API_OK == uw_RetVal )
+        v_BCAcycQueueStatusCopy( &xOutput, pstatus );
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCAcycQueueStatus(AiUInt32 bModule, AiUInt8 biu, TY_API_BC_ACYC_QUEUE_STATUS *pstatus)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        return API_ERR_WRONG_BIU;
+    if( NULL == pstatus )
+        return API_ERR_PARAM3_IS_NULL;
+
+    uw_RetVal = ApiCmdBCAcycQueueStatus_( bModule, biu, pstatus );
+
+    v_ExamineRetVal( "ApiCmdBCAcycQueueStatus", uw_RetVal );
+    TRACE_BEGIN
+    TRACE("        TY_API_BC_ACYC_QUEUE_STATUS status;\n");
+    TRACE_FCTA("ApiCmdBCAcycQueueStatus", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_RPARE("&status");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+} // end: ApiCmdBCAcycQueueStatus
+
 
 //***************************************************************************
 //
@@ -2507,6 +3420,65 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCInstrModifyDefine(AiUInt32 bModule, Ai
 
 
 
+
+AiReturn ApiCmdBCInstrModifyDefineList_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 mode, AiUInt32 count, AiUInt32 * ids, TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offsets)
+{
+    TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT     xInput;
+    TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_OUTPUT    xOutput;
+    AiInt16  uw_RetVal = API_OK;
+    AiUInt32 i;
+
+    MIL_COM_INIT(&xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BC_MODIFY_DEF_LIST,
+                 MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT_MINIMUM_SIZE + count * sizeof(TY_MIL_COM_LS_BC_MODIFY_DEF_ENTRY), sizeof(xOutput));
+
+    xInput.mode = mode;
+    xInput.cnt  = count;
+
+    for (i = 0; i < count; i++)
+    {
+        xInput.entry[i].id = ids[i];
+        memcpy(&xInput.entry[i].modify, &modify[i], sizeof(TY_API_BC_MODIFY_INSTRUCTION));
+    }
+
+    uw_RetVal = API_CMD_STRUCT_LS_BC_MODIFY_DEF_LIST(bModule, &xInput, &xOutput);
+
+    if ((uw_RetVal == API_OK) && (offsets != NULL))
+        memcpy(offsets, xOutput.offset, count * sizeof(AiUInt32));
+
+    return uw_RetVal;
+}
+
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBCInstrModifyDefineList(AiUInt32 bModule, AiUInt8 biu, AiUInt32 mode, AiUInt32 count, AiUInt32 * ids, 
+                                                                TY_API_BC_MODIFY_INSTRUCTION * modify, AiUInt32 * offsets)
+{
+    AiInt16 uw_RetVal = API_OK;
+    TY_DEVICE_INFO * pDevice = _ApiGetDeviceInfoPtrByModule(bModule);
+
+    if (pDevice == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
+
+    if (mode > API_BC_MODIFY_LIST_MAJOR_FRAME)
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else if ((count == 0) || (count > API_BC_MODIFY_LIST_MAX))
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if (NULL == ids)
+        uw_RetVal = API_ERR_PARAM5_IS_NULL;
+    else if (NULL == modify)
+        uw_RetVal = API_ERR_PARAM6_IS_NULL;
+    else
+    {
+        uw_RetVal = ApiCmdBCInstrModifyDefineList_(bModule, biu, mode, count, ids, modify, offsets);
+    }
+
+    v_ExamineRetVal("ApiCmdBCInstrModifyDefineList", uw_RetVal);
+
+    return uw_RetVal;
+
+} /* end: ApiCmdBCInstrModifyDefineList */
+
+
+
 //***************************************************************************
 //
 //   Module :                          Submodule : 
@@ -839,6 +839,88 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStackEntryFind(AiUInt32 bModule, AiUIn
     return uw_RetVal;
 }
 
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBMStackTimeTagFind
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Time Tag High and Time Tag Low to find [ttag_high, ttag_low]
+//
+//    Outputs   : Instruction execution status [status]
+//                Time Tag High entry of the message found [pfnd]
+//
+//    Description :
+//    This function searches the first message in the Monitor Buffer with a
+//    time tag equal or later than the given one. The target software uses a
+//    binary search over the monitor entries, which are stored in time order.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBMStackTimeTagFind_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 ttag_high, AiUInt32 ttag_low, TY_API_BM_STACK_FND *pfnd)
+{
+    TY_MIL_COM_LS_BM_STACK_ENTRY_FIND_INPUT  xInput;
+    TY_MIL_COM_LS_BM_STACK_ENTRY_FIND_OUTPUT xOutput;
+    AiInt16 uw_RetVal = API_OK;
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BM_STACK_ENTRY_FIND, sizeof(xInput), sizeof(xOutput) );
+
+    xInput.mode   = API_BM_READ_STP;
+    xInput.sgn    = API_BM_SIGN_POS;
+    xInput.offset = 0;
+    xInput.spec   = API_BM_SEARCH_TTAG_MASK | API_BM_ENTRY_TIMETAG_HIGH;
+    xInput.etw    = ttag_high;
+    xInput.etm    = ttag_low;
+
+    uw_RetVal = API_CMD_STRUCT_BM_STACK_ENTRY_FIND( bModule, &xInput, &xOutput );
+
+    pfnd->efnd      = xOutput.fnd;
+    pfnd->padding1  = 0;
+    pfnd->padding2  = 0;
+    pfnd->eptr      = xOutput.eptr;
+    pfnd->entry     = xOutput.entry;
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStackTimeTagFind(AiUInt32 bModule, AiUInt8 biu, AiUInt32 ttag_high, AiUInt32 ttag_low,
+                                                           TY_API_BM_STACK_FND *pfnd)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( ttag_high > API_BM_TIMETAG_MASK )
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else if( ttag_low > API_BM_TIMETAG_MASK )
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if( NULL == pfnd )
+        uw_RetVal = API_ERR_PARAM5_IS_NULL;
+    else
+    {
+        uw_RetVal = ApiCmdBMStackTimeTagFind_(bModule, biu, ttag_high, ttag_low, pfnd);
+    }
+
+    v_ExamineRetVal( "ApiCmdBMStackTimeTagFind", uw_RetVal );
+    TRACE_BEGIN
+    TRACE("        TY_API_BM_STACK_FND fnd;\n");
+    TRACE_FCTA("ApiCmdBMStackTimeTagFind", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(ttag_high);
+    TRACE_PARA(ttag_low);
+    TRACE_RPARE("&fnd");
+    TRACE_FCTE;
+    TRACE1("    --> fnd.efnd     = 0x%x\n", pfnd->efnd);
+    TRACE1("    --> fnd.entry    = 0x%x\n", pfnd->entry);
+    TRACE1("    --> fnd.eptr     = 0x%x\n", pfnd->eptr);
+    TRACE_END
+    
+    return uw_RetVal;
+}
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdBMRecStatusRead
@@ -1606,6 +1688,281 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRTSAActRead( AiUInt32           bModul
     return uw_RetVal;
 }
 
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBMRTSAActSnapshot
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : First RT address [rt_first]
+//                Number of RTs [rt_count]
+//                Subaddress type [sa_type]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BM_RT_SA_ACT_SNAPSHOT' instruction to
+//    the API1553-DS ASP Driver SW to read the BM message/error counter of
+//    all subaddresses of a range of RTs with one command.
+//    pact must provide rt_count * 32 entries, ordered by RT and SA.
+//
+//***************************************************************************
+AiInt16 ApiCmdBMRTSAActSnapshot_( AiUInt32 bModule, AiUInt8 biu, AiUInt8 rt_first, AiUInt8 rt_count, AiUInt8 sa_type, TY_API_BM_RT_ACT * pact )
+{
+    TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_INPUT    xInput;
+    TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT * pxOutput = NULL;
+    AiUInt32 ulCount   = rt_count * (MAX_RT_MODECODE + 1);
+    AiUInt32 ulAckSize = MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_ACK_SIZE(ulCount);
+    AiUInt32 * pulStatus;
+    AiUInt32 i;
+    AiInt16 uw_RetVal = API_OK;
+
+    pxOutput = (TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT*)AiOsMalloc(ulAckSize);
+
+    if( NULL == pxOutput )
+        return API_ERR_MALLOC_FAILED;
+
+    xInput.rt_first = rt_first;
+    xInput.rt_count = rt_count;
+    xInput.sa_type  = sa_type;
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT, sizeof(xInput), ulAckSize );
+
+    uw_RetVal = API_CMD_STRUCT_BM_RT_SA_ACT_SNAPSHOT( bModule, &xInput, pxOutput );
+
+    if( API_OK == uw_RetVal )
+    {
+        pulStatus = &pxOutput->data[2 * ulCount];
+
+        for( i = 0; i < ulCount; i++ )
+        {
+            pact[i].mc = pxOutput->data[2 * i];
+            pact[i].ec = pxOutput->data[2 * i + 1];
+            pact[i].et = (pulStatus[i / 2] >> ((i & 1) * 16)) & 0xFFFF;
+        }
+    }
+
+    AiOsFree(pxOutput);
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMRTSAActSnapshot( AiUInt32           bModule, 
+                                              AiUInt8            biu, 
+                                              AiUInt8            rt_first, 
+                                              AiUInt8            rt_count, 
+                                              AiUInt8            sa_type,
+                                              TY_API_BM_RT_ACT * pact )
+{
+    AiInt16 uw_RetVal      = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( rt_first > MAX_RT_ADDR )
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else if( (rt_count < 1) || (rt_count > (MAX_RT_ADDR + 1 - rt_first)) )
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if( sa_type > API_RT_TYPE_ALL )
+        uw_RetVal = API_ERR_PARAM5_NOT_IN_RANGE;
+    else if( NULL == pact )
+        uw_RetVal = API_ERR_PARAM6_IS_NULL;
+    else
+    {
+        uw_RetVal = ApiCmdBMRTSAActSnapshot_( bModule, biu, rt_first, rt_count, sa_type, pact );
+    }
+
+    v_ExamineRetVal( "ApiCmdBMRTSAActSnapshot", uw_RetVal );
+    TRACE_BEGIN
+    TRACE1("        TY_API_BM_RT_ACT act[%d];\n", rt_count * (MAX_RT_MODECODE + 1));
+    TRACE_FCTA("ApiCmdBMRTSAActSnapshot", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(rt_first);
+    TRACE_PARA(rt_count);
+    TRACE_PARA(sa_type);
+    TRACE_RPARE("act");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+}
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBMStatisticsControl
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Statistics control [con]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BM_STAT_CONTROL' instruction to
+//    the API1553-DS ASP Driver SW to enable, disable or reset the on-target
+//    bus statistics. While enabled, the BM interrupt mode is set to buffer
+//    full on BM start.
+//
+//***************************************************************************
+AiInt16 ApiCmdBMStatisticsControl_( AiUInt32 bModule, AiUInt8 biu, AiUInt8 con )
+{
+    TY_MIL_COM_LS_BM_STAT_CONTROL_INPUT xInput;
+    TY_MIL_COM_ACK                      xOutput;
+    AiInt16 uw_RetVal = API_OK;
+
+    xInput.con = con;
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BM_STAT_CONTROL, sizeof(xInput), sizeof(xOutput) );
+
+    uw_RetVal = API_CMD_STRUCT_BM_STAT_CONTROL( bModule, &xInput, &xOutput );
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStatisticsControl( AiUInt32 bModule, AiUInt8 biu, AiUInt8 con )
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( con > API_BM_STAT_RESET )
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else
+    {
+        uw_RetVal = ApiCmdBMStatisticsControl_( bModule, biu, con );
+    }
+
+    v_ExamineRetVal( "ApiCmdBMStatisticsControl", uw_RetVal );
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdBMStatisticsControl", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARE(con);
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+}
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBMStatisticsRead
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : none
+//
+//    Outputs   : Bus statistics [px_Stat]
+//                Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BM_STAT_READ' instruction to
+//    the API1553-DS ASP Driver SW to read the on-target bus statistics.
+//    The per RT/SA counters are read in chunks of
+//    MIL_COM_LS_BM_STAT_MAX_RT RTs. The first chunk takes a snapshot on
+//    the target which all chunks are read from, the global values are
+//    taken from the last chunk. While the BM is running, the statistics
+//    cover the BM entries up to the last Monitor Buffer Full interrupt.
+//
+//***************************************************************************
+static void v_BMStatisticsTimeCopy( TY_API_BM_STATISTICS_TIME * px_Time, TY_MIL_COM_LS_BM_STAT_TIME * px_Target )
+{
+    px_Time->count = px_Target->count;
+    px_Time->min   = px_Target->min;
+    px_Time->max   = px_Target->max;
+    px_Time->mean  = px_Target->mean;
+}
+
+AiInt16 ApiCmdBMStatisticsRead_( AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STATISTICS * px_Stat )
+{
+    TY_MIL_COM_LS_BM_STAT_READ_INPUT    xInput;
+    TY_MIL_COM_LS_BM_STAT_READ_OUTPUT * pxOutput = NULL;
+    AiUInt32 ulCount   = MIL_COM_LS_BM_STAT_MAX_RT * (MAX_RT_MODECODE + 1);
+    AiUInt32 ulAckSize = MIL_COM_LS_BM_STAT_READ_ACK_SIZE(ulCount);
+    AiUInt32 ulRt, ulSa, i;
+    AiUInt32 * pulData;
+    AiInt16 uw_RetVal = API_OK;
+
+    pxOutput = (TY_MIL_COM_LS_BM_STAT_READ_OUTPUT*)AiOsMalloc(ulAckSize);
+
+    if( NULL == pxOutput )
+        return API_ERR_MALLOC_FAILED;
+
+    for( ulRt = 0; ulRt <= MAX_RT_ADDR; ulRt += MIL_COM_LS_BM_STAT_MAX_RT )
+    {
+        xInput.rt_first = ulRt;
+        xInput.rt_count = MIL_COM_LS_BM_STAT_MAX_RT;
+
+        MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BM_STAT_READ, sizeof(xInput), ulAckSize );
+
+        uw_RetVal = API_CMD_STRUCT_BM_STAT_READ( bModule, &xInput, pxOutput );
+
+        if( API_OK != uw_RetVal )
+            break;
+
+        pulData = pxOutput->data;
+
+        for( i = 0; i < MIL_COM_LS_BM_STAT_MAX_RT; i++ )
+        {
+            for( ulSa = 0; ulSa <= MAX_RT_MODECODE; ulSa++ )
+            {
+                px_Stat->rt_sa[ulRt + i][ulSa].rcv_msg_cnt = *pulData++;
+                px_Stat->rt_sa[ulRt + i][ulSa].rcv_err_cnt = *pulData++;
+                px_Stat->rt_sa[ulRt + i][ulSa].xmt_msg_cnt = *pulData++;
+                px_Stat->rt_sa[ulRt + i][ulSa].xmt_err_cnt = *pulData++;
+            }
+        }
+    }
+
+    if( API_OK == uw_RetVal )
+    {
+        px_Stat->msg_cnt = pxOutput->msg_cnt;
+        px_Stat->err_cnt = pxOutput->err_cnt;
+
+        for( i = 0; i < 16; i++ )
+            px_Stat->err_hist[i] = pxOutput->err_hist[i];
+
+        v_BMStatisticsTimeCopy( &px_Stat->gap,      &pxOutput->gap );
+        v_BMStatisticsTimeCopy( &px_Stat->interval, &pxOutput->interval );
+
+        for( ulRt = 0; ulRt <= MAX_RT_ADDR; ulRt++ )
+            v_BMStatisticsTimeCopy( &px_Stat->resp[ulRt], &pxOutput->resp[ulRt] );
+    }
+
+    AiOsFree(pxOutput);
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMStatisticsRead( AiUInt32 bModule, AiUInt8 biu, TY_API_BM_STATISTICS * px_Stat )
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( NULL == px_Stat )
+        uw_RetVal = API_ERR_PARAM3_IS_NULL;
+    else
+    {
+        uw_RetVal = ApiCmdBMStatisticsRead_( bModule, biu, px_Stat );
+    }
+
+    v_ExamineRetVal( "ApiCmdBMStatisticsRead", uw_RetVal );
+    TRACE_BEGIN
+    TRACE("        TY_API_BM_STATISTICS stat;\n");
+    TRACE_FCTA("ApiCmdBMStatisticsRead", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_RPARE("&stat");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+}
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdBMIniMsgFltRec
@@ -1766,7 +2123,7 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMCopyMsgFltRecData(AiUInt32 bModule, Ai
 
     if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
         uw_RetVal = API_ERR_WRONG_BIU;
-    else if( mode > MAX_BM_MSGFLT_MODE  )
+    else if( (mode & ~API_BM_FLT_MODE_INCREMENTAL) > MAX_BM_MSGFLT_MODE  )
         uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
     else if( con > MAX_BM_MSGFLT_FORMAT  )
         uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
@@ -1819,6 +2176,9 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMCopyMsgFltRecData(AiUInt32 bModule, Ai
 //    Description :
 //    This function applies the 'API_BM_READ_MSG_FLT_REC' instruction to the
 //    API1553-DS ASP Driver SW to read the BM Message Filter Recording data
+//    Only the records received since the previous call are returned.
+//    With API_BM_FLT_MODE_INCREMENTAL a full buffer sets ovfl to
+//    API_BM_MORE_DATA and the remaining records are returned by the next call.
 //
 //***************************************************************************
 AiInt16 ApiCmdBMReadMsgFltRec_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 mode,
@@ -1864,7 +2224,7 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMReadMsgFltRec(AiUInt32 bModule, AiUInt
 
     if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
         uw_RetVal = API_ERR_WRONG_BIU;
-    else if( mode > MAX_BM_MSGFLT_MODE  )
+    else if( (mode & ~API_BM_FLT_MODE_INCREMENTAL) > MAX_BM_MSGFLT_MODE  )
         uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
     else if( con > MAX_BM_MSGFLT_FORMAT  )
         uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
@@ -2075,3 +2435,101 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMDytagMonRead(AiUInt32 bModule, AiUInt8
 
     return uw_RetVal;
 }
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdBMDytagMonReadBulk
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : First Dytag Monitor ID [uc_IdFirst]
+//                Number of Dytag Monitors [uc_Count]
+//                Dytag Monitor ID list [puc_IdList]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function applies the 'TG_API_BM_DYTAG_MON_READ_BULK' instruction
+//    to the API1553-DS ASP Driver SW to read the status of several BM Dytag
+//    Monitors with one command. If puc_IdList is NULL the uc_Count monitors
+//    starting with uc_IdFirst are read, otherwise the uc_Count monitors of
+//    the list. px_DytagMonAct must provide uc_Count entries.
+//
+//***************************************************************************
+
+AiInt16 ApiCmdBMDytagMonReadBulk_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 uc_IdFirst, AiUInt8 uc_Count, AiUInt8 *puc_IdList, TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct)
+{
+    TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_INPUT  xInput;
+    TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_OUTPUT xOutput;
+    AiUInt32 i;
+    AiInt16 uw_RetVal = API_OK;
+
+    xInput.id_first = (NULL == puc_IdList) ? uc_IdFirst : 0;
+    xInput.count    = uc_Count;
+
+    for( i = 0; i < MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_MAX; i++ )
+        xInput.id[i] = ((NULL != puc_IdList) && (i < uc_Count)) ? puc_IdList[i] : 0;
+
+    MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_BM_DYNTAG_MON_READ_BULK, sizeof(xInput), MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_ACK_SIZE(uc_Count) );
+
+    uw_RetVal = API_CMD_STRUCT_BM_DYNTAG_MON_READ_BULK( bModule, &xInput, &xOutput );
+
+    if( API_OK == uw_RetVal )
+    {
+        for( i = 0; i < uc_Count; i++ )
+        {
+            px_DytagMonAct[i].ul_Stale = xOutput.state[i].stale_cnt;
+            px_DytagMonAct[i].ul_Good  = xOutput.state[i].good_cnt;
+            px_DytagMonAct[i].ul_Bad   = xOutput.state[i].bad_cnt;
+        }
+    }
+
+    return uw_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdBMDytagMonReadBulk(AiUInt32 bModule, AiUInt8 biu, AiUInt8 uc_IdFirst, AiUInt8 uc_Count, AiUInt8 *puc_IdList, TY_API_BM_DYTAG_MON_ACT *px_DytagMonAct)
+{
+    AiInt16 uw_RetVal = API_OK;
+    AiUInt32 i;
+
+    if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        uw_RetVal = API_ERR_WRONG_BIU;
+    else if( (NULL == puc_IdList) && ((uc_IdFirst < MIN_DYTAG_MON_ID) || (uc_IdFirst > MAX_DYTAG_MON_ID)) )
+        uw_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else if( (uc_Count < 1) || (uc_Count > MAX_DYTAG_MON_ID) )
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if( (NULL == puc_IdList) && (uc_Count > (MAX_DYTAG_MON_ID + 1 - uc_IdFirst)) )
+        uw_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
+    else if( NULL == px_DytagMonAct )
+        uw_RetVal = API_ERR_PARAM6_IS_NULL;
+    else
+    {
+        if( NULL != puc_IdList )
+        {
+            for( i = 0; i < uc_Count; i++ )
+            {
+                if( (puc_IdList[i] < MIN_DYTAG_MON_ID) || (puc_IdList[i] > MAX_DYTAG_MON_ID) )
+                    uw_RetVal = API_ERR_PARAM5_NOT_IN_RANGE;
+            }
+        }
+
+        if( API_OK == uw_RetVal )
+            uw_RetVal = ApiCmdBMDytagMonReadBulk_(bModule, biu, uc_IdFirst, uc_Count, puc_IdList, px_DytagMonAct);
+    }
+
+    v_ExamineRetVal( "ApiCmdBMDytagMonReadBulk", uw_RetVal );
+    TRACE_BEGIN
+    TRACE1("        TY_API_BM_DYTAG_MON_ACT x_DytagMonAct[%d];\n", uc_Count);
+    TRACE_FCTA("ApiCmdBMDytagMonReadBulk", uw_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(uc_IdFirst);
+    TRACE_PARA(uc_Count);
+    TRACE_RPARA(puc_IdList ? "puc_IdList" : "NULL");
+    TRACE_RPARE("x_DytagMonAct");
+    TRACE_FCTE;
+    TRACE_END
+
+    return uw_RetVal;
+}
@@ -25,6 +25,7 @@
 #include "ApiLsDQue.h"
 
 #include "string.h"  /* for memset and strncpy */
+#include <stdio.h>   /* for recording files */
 
 
 //****************************************************
@@ -362,6 +363,9 @@ AiInt16 ApiCmdDataQueueCloseBuffer_(AiUInt32 module, AiUInt8 biu, AiUInt32 id)
         /* DQ not opened */
         return 0;
 
+    /* Mapped memory is no longer valid after close */
+    ApiCmdDataQueueUnmap_(module, id);
+
     pDevice->ax_QueueTable[id].uc_QueueFlag = DQUEUE_CLOSED;
 
     xInput.id   = id;
@@ -515,6 +519,94 @@ AiInt16 ApiCmdDataQueueControlTsw_(AiUInt32 module, AiUInt8 biu, AiUInt32 id, Ai
 }
 
 
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiCmdDataQueueFilter
+//
+//---------------------------------------------------------------------------
+//
+//    Description : This function sets up a target side RT/SA and error filter
+//                  for a BM recording data queue. Only messages passing the
+//                  filter are copied into the queue.
+//
+//***************************************************************************
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueFilter(AiUInt32 ul_Module, AiUInt32 id, TY_API_DATA_QUEUE_FILTER *px_Filter)
+{
+    AiInt16 uw_RetVal = API_OK;
+
+    if (px_Filter == NULL)
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (Aiul_DbgLevel & DBG_PARAMCHK)
+    {
+        if (id > API_DATA_QUEUE_ID_BM_REC_BIU8)
+            uw_RetVal = API_ERR_DQUEUE_ID_NOT_IN_RANGE;
+    }
+
+    if (API_OK == uw_RetVal)
+    {
+        uw_RetVal = ApiCmdDataQueueFilter_(ul_Module, id, px_Filter);
+    }
+
+    v_ExamineRetVal("ApiCmdDataQueueFilter", uw_RetVal);
+    TRACE_BEGIN
+    TRACE("        TY_API_DATA_QUEUE_FILTER x_Filter;\n");
+    TRACE1("        x_Filter.ul_Enable    = 0x%x;\n", px_Filter->ul_Enable);
+    TRACE1("        x_Filter.ul_RtMask    = 0x%x;\n", px_Filter->ul_RtMask);
+    TRACE1("        x_Filter.ul_RxSaMask  = 0x%x;\n", px_Filter->ul_RxSaMask);
+    TRACE1("        x_Filter.ul_TxSaMask  = 0x%x;\n", px_Filter->ul_TxSaMask);
+    TRACE1("        x_Filter.ul_ErrorMask = 0x%x;\n", px_Filter->ul_ErrorMask);
+    TRACE_FCTA("ApiCmdDataQueueFilter", uw_RetVal);
+    TRACE_PARA(ul_Module);
+    TRACE_PARA(id);
+    TRACE_RPARE("&x_Filter");
+    TRACE_FCTE;
+    TRACE_END
+        return(uw_RetVal);
+}
+
+
+//**************************************************************************
+//
+//  ApiCmdDataQueueFilter_
+//
+//**************************************************************************
+AiInt16 ApiCmdDataQueueFilter_(AiUInt32 module, AiUInt32 id, TY_API_DATA_QUEUE_FILTER *px_Filter)
+{
+    TY_MIL_COM_LS_BM_DATAQUEUE_FILTER_INPUT xInput;
+    TY_MIL_COM_ACK                          xOutput;
+    AiInt16  ret = API_OK;
+
+    TY_DEVICE_INFO * pDevice = _ApiGetDeviceInfoPtrByModule(module);
+
+    if (pDevice == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
+
+    /* The filter is applied by the TSW data queue task.
+       Direct mode queues and remote queues do not use it. */
+    if ((pDevice->x_Config.uc_DataQueueMode == 1) || GET_SERVER_ID(module))
+        return API_ERR_PLATTFORM_NOT_SUPPORTED;
+
+    if (DQUEUE_OPENED != pDevice->ax_QueueTable[id].uc_QueueFlag)
+        return API_ERR_DQUEUE_ASP_OPEN;
+
+    xInput.id         = id;
+    xInput.mode       = API_DATA_QUEUE_CTRL_MODE_FILTER;
+    xInput.enable     = px_Filter->ul_Enable;
+    xInput.rt_mask    = px_Filter->ul_RtMask;
+    xInput.rx_sa_mask = px_Filter->ul_RxSaMask;
+    xInput.tx_sa_mask = px_Filter->ul_TxSaMask;
+    xInput.error_mask = px_Filter->ul_ErrorMask;
+
+    MIL_COM_INIT(&xInput.cmd, API_STREAM(module), 0, MIL_COM_LS_BM_DATAQUEUE_CONTROL, sizeof(xInput), sizeof(xOutput));
+
+    ret = API_CMD_STRUCT_BM_DATAQUEUE_CONTROL(module, &xInput, &xOutput);
+
+    return ret;
+}
+
+
 //***************************************************************************
 //
 //   Module : ApiLsDQue                Submodule : ApiCmdDataQueueRead
@@ -1089,138 +1181,1278 @@ AiInt16 ApiCmdDataQueueReadBuffer_(AiUInt32 module, AiUInt8 biu, TY_API_DATA_QUE
 
 
 
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiCmdDataQueueMap
+//
+//---------------------------------------------------------------------------
+//
+//    Description : These functions give zero copy access to the ring buffer
+//                  of an open TSW data queue. ApiCmdDataQueueMap maps the
+//                  queue into the process, ApiCmdDataQueueSpanGet returns
+//                  pointers to the data between get and put and
+//                  ApiCmdDataQueueSpanRelease hands consumed bytes back to
+//                  the TSW.
+//
+//***************************************************************************
 
-AiUInt8 _ApiCmdDataQueueDirectGetBiu(AiUInt8 ucId)
+/* Access to one 32 bit field of a mapped TSW data queue header */
+#define DATA_QUEUE_MAP_HEADER(map, start, field) (*(volatile AiUInt32 *)((map)->pucMemory + (start) + (field)))
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueMap(AiUInt32 ul_Module, AiUInt32 id)
 {
-    AiUInt8 ucBiu = 0;
+    AiInt16 uw_RetVal = API_OK;
 
-    /* BM Recording */
-    if      (ucId == API_DATA_QUEUE_ID_BM_REC_BIU1)    ucBiu = 0;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU2)    ucBiu = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU3)    ucBiu = 2;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU4)    ucBiu = 3;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU5)    ucBiu = 4;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU6)    ucBiu = 5;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU7)    ucBiu = 6;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU8)    ucBiu = 7;
-    /* Milscope */
-    else if (ucId == API_DATA_QUEUE_ID_MIL_SCOPE)      ucBiu = 0;
+    if (Aiul_DbgLevel & DBG_PARAMCHK)
+    {
+        if (id > MAX_DATA_QUEUE_ID)
+            uw_RetVal = API_ERR_DQUEUE_ID_NOT_IN_RANGE;
+    }
 
-    return ucBiu;
+    if (API_OK == uw_RetVal)
+    {
+        uw_RetVal = ApiCmdDataQueueMap_(ul_Module, id);
+    }
+
+    v_ExamineRetVal("ApiCmdDataQueueMap", uw_RetVal);
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdDataQueueMap", uw_RetVal);
+    TRACE_PARA(ul_Module);
+    TRACE_PARE(id);
+    TRACE_FCTE;
+    TRACE_END
+        return(uw_RetVal);
 }
 
-AiUInt8 _ApiCmdDataQueueDirectIsBmRecording(AiUInt8 ucId)
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueUnmap(AiUInt32 ul_Module, AiUInt32 id)
 {
-    AiUInt8 ucBmRecording = 0;
+    AiInt16 uw_RetVal = API_OK;
 
-    /* BM Recording */
-    if      (ucId == API_DATA_QUEUE_ID_BM_REC_BIU1)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU2)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU3)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU4)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU5)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU6)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU7)    ucBmRecording = 1;
-    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU8)    ucBmRecording = 1;
-    /* Milscope */
-    else if (ucId == API_DATA_QUEUE_ID_MIL_SCOPE)      ucBmRecording = 0;
+    if (Aiul_DbgLevel & DBG_PARAMCHK)
+    {
+        if (id > MAX_DATA_QUEUE_ID)
+            uw_RetVal = API_ERR_DQUEUE_ID_NOT_IN_RANGE;
+    }
 
-    return ucBmRecording;
-}
+    if (API_OK == uw_RetVal)
+    {
+        uw_RetVal = ApiCmdDataQueueUnmap_(ul_Module, id);
+    }
 
+    v_ExamineRetVal("ApiCmdDataQueueUnmap", uw_RetVal);
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdDataQueueUnmap", uw_RetVal);
+    TRACE_PARA(ul_Module);
+    TRACE_PARE(id);
+    TRACE_FCTE;
+    TRACE_END
+        return(uw_RetVal);
+}
 
 
-AiUInt8 _ApiCmdDataQueueDirectIsHs(AiUInt8 ucDeviceType, AiUInt8 ucId)
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueSpanGet(AiUInt32 ul_Module, AiUInt32 id, TY_API_DATA_QUEUE_SPAN *px_Span)
 {
-    switch (ucDeviceType)
+    AiInt16 uw_RetVal = API_OK;
+
+    if (px_Span == NULL)
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (Aiul_DbgLevel & DBG_PARAMCHK)
     {
-    case TYPE_APX3910:
-    case TYPE_APX3910Xp:
-    case TYPE_APXX3910:
-    case TYPE_APXX3910Xp:
-    case TYPE_APEX3910:
-    case TYPE_APEX3910Xp:
-    case TYPE_ACE3910:
-    case TYPE_ACE3910Xp:
-    case TYPE_AXC3910:
-    case TYPE_AXC3910Xp:
-    case TYPE_ACX3910:
-    case TYPE_ACX3910Xp:
-    case TYPE_AVX3910:
-    case TYPE_AVX3910Xp:
-    case TYPE_ANET3910:
-    case TYPE_ANET3910Xp:
-        if (ucId == 1)
-            return 1;
-        break;
+        if (id > MAX_DATA_QUEUE_ID)
+            uw_RetVal = API_ERR_DQUEUE_ID_NOT_IN_RANGE;
+    }
 
-    case TYPE_ACX3910_2:
-    case TYPE_ACX3910Xp_2:
-    case TYPE_AVX3910_2:
-    case TYPE_AVX3910Xp_2:
-        if ((ucId == 1) || (ucId == 3))
-            return 1;
-        break;
+    if (API_OK == uw_RetVal)
+    {
+        uw_RetVal = ApiCmdDataQueueSpanGetMapped_(ul_Module, id, px_Span);
+    }
 
-    case TYPE_ACX_EFA_1_TWO_PBIS:
-    case TYPE_ACX_EFAXp_1_TWO_PBIS:
-    case TYPE_ACX_EFA_1_DS_TWO_PBIS:
-    case TYPE_ACX_EFAXp_1_DS_TWO_PBIS:
-    case TYPE_AVX_EFA_1_TWO_PBIS:
-    case TYPE_AVX_EFA_1_DS_TWO_PBIS:
-    case TYPE_AVX_EFAXp_1_TWO_PBIS:
-    case TYPE_AVX_EFAXp_1_DS_TWO_PBIS:
-        if (ucId == 2)
-            return 1;
-        break;
+    v_ExamineRetVal("ApiCmdDataQueueSpanGet", uw_RetVal);
+    TRACE_BEGIN
+    TRACE("        TY_API_DATA_QUEUE_SPAN span;\n");
+    TRACE_FCTA("ApiCmdDataQueueSpanGet", uw_RetVal);
+    TRACE_PARA(ul_Module);
+    TRACE_PARA(id);
+    TRACE_RPARE("&span");
+    TRACE_FCTE;
+    TRACE1("    --> span.ul_Status         = 0x%x\n", px_Span->ul_Status);
+    TRACE1("    --> span.ul_BytesAvailable = 0x%x\n", px_Span->ul_BytesAvailable);
+    TRACE1("    --> span.ul_Size1          = 0x%x\n", px_Span->ul_Size1);
+    TRACE1("    --> span.ul_Size2          = 0x%x\n", px_Span->ul_Size2);
+    TRACE_END
+        return(uw_RetVal);
+}
 
-    case TYPE_ACX_EFA_2_TWO_PBIS:
-    case TYPE_ACX_EFAXp_2_TWO_PBIS:
-    case TYPE_ACX_EFA_2_DS_TWO_PBIS:
-    case TYPE_ACX_EFAXp_2_DS_TWO_PBIS:
-    case TYPE_AVX_EFA_2_TWO_PBIS:
-    case TYPE_AVX_EFAXp_2_TWO_PBIS:
-    case TYPE_AVX_EFA_2_DS_TWO_PBIS:
-    case TYPE_AVX_EFAXp_2_DS_TWO_PBIS:
-        if (ucId == 3)
-            return 1;
-        break;
 
-    case TYPE_ACX_EFA_4_TWO_PBIS:
-    case TYPE_ACX_EFAXp_4_TWO_PBIS:
-    case TYPE_AVX_EFA_4_TWO_PBIS:
-    case TYPE_AVX_EFAXp_4_TWO_PBIS:
-        if (ucId == 16)
-            return 1;
-        break;
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdDataQueueSpanRelease(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 ul_Bytes)
+{
+    AiInt16 uw_RetVal = API_OK;
 
-    default:
-        break;
+    if (Aiul_DbgLevel & DBG_PARAMCHK)
+    {
+        if (id > MAX_DATA_QUEUE_ID)
+            uw_RetVal = API_ERR_DQUEUE_ID_NOT_IN_RANGE;
     }
 
-    return 0;
-}
+    if (API_OK == uw_RetVal)
+    {
+        uw_RetVal = ApiCmdDataQueueSpanReleaseMapped_(ul_Module, id, ul_Bytes);
+    }
 
+    v_ExamineRetVal("ApiCmdDataQueueSpanRelease", uw_RetVal);
+    TRACE_BEGIN
+    TRACE_FCTA("ApiCmdDataQueueSpanRelease", uw_RetVal);
+    TRACE_PARA(ul_Module);
+    TRACE_PARA(id);
+    TRACE_PARE(ul_Bytes);
+    TRACE_FCTE;
+    TRACE_END
+        return(uw_RetVal);
+}
 
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueOpen(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 * queue_size)
+//**************************************************************************
+//
+//  ApiCmdDataQueueMap_
+//
+//**************************************************************************
+AiInt16 ApiCmdDataQueueMap_(AiUInt32 module, AiUInt32 id)
 {
-    return ApiCmdDataQueueOpen(ul_Module, id, queue_size);
-}
+    AiInt16  ret;
+    AiUInt32 queue_status;
+    AiUInt32 queue_put;
+    AiUInt32 queue_get;
+    AiUInt32 queue_data_start;
+    AiUInt32 queue_data_size;
+    void   * memory = NULL;
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueClose(AiUInt32 ul_Module, AiUInt32 id)
-{
-    return ApiCmdDataQueueClose(ul_Module, id);
-}
+    TY_DEVICE_INFO * dev = _ApiGetDeviceInfoPtrByModule(module);
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueControl(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 mode)
-{
-    return ApiCmdDataQueueControl(ul_Module, id, mode);
-}
+    if (dev == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueRead(AiUInt32 ul_Module, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info)
-{
-    return ApiCmdDataQueueRead(ul_Module, px_QueueData, info);
+    /* Only the shared ring buffer filled by the TSW can be mapped */
+    if (((dev->x_Config.uc_DataQueueMode == 1) && _ApiCmdDataQueueDirectIsBmRecording((AiUInt8)id)) || GET_SERVER_ID(module))
+        return API_ERR_PLATTFORM_NOT_SUPPORTED;
+
+    if (DQUEUE_OPENED != dev->ax_QueueTable[id].uc_QueueFlag)
+        return API_ERR_DQUEUE_ASP_OPEN;
+
+    if (dev->ax_QueueTable[id].ul_QueueStart == 0)
+        return API_ERR_DQUEUE_ASP_OPEN;
+
+    if (dev->ax_QueueMap[id].pucMemory != NULL)
+        /* already mapped */
+        return API_OK;
+
+    ret = ApiCmdDataQueueReadGetTswStatus_(module, (AiUInt8)id, &queue_status, &queue_put, &queue_get, &queue_data_start, &queue_data_size);
+
+    if (ret != 0)
+        return ret;
+
+#if defined(_AIM_LINUX)
+    ret = _ApiOsMapMemory(module, dev->x_Config.uc_DataQueueMemoryType, queue_data_start + queue_data_size, &memory);
+#else
+    ret = API_ERR_OS_NOT_SUPPORTED;
+#endif
+
+    if (ret != 0)
+        return ret;
+
+    dev->ax_QueueMap[id].pucMemory = (AiUInt8 *)memory;
+    dev->ax_QueueMap[id].ulSize    = queue_data_start + queue_data_size;
+
+    return API_OK;
+}
+
+
+//**************************************************************************
+//
+//  ApiCmdDataQueueUnmap_
+//
+//**************************************************************************
+AiInt16 ApiCmdDataQueueUnmap_(AiUInt32 module, AiUInt32 id)
+{
+    TY_DEVICE_INFO * dev = _ApiGetDeviceInfoPtrByModule(module);
+
+    if (dev == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
+
+    if (dev->ax_QueueMap[id].pucMemory == NULL)
+        /* nothing to do */
+        return API_OK;
+
+#if defined(_AIM_LINUX)
+    _ApiOsUnmapMemory(dev->ax_QueueMap[id].pucMemory, dev->ax_QueueMap[id].ulSize);
+#endif
+
+    dev->ax_QueueMap[id].pucMemory = NULL;
+    dev->ax_QueueMap[id].ulSize    = 0;
+
+    return API_OK;
+}
+
+
+//**************************************************************************
+//
+//  ApiCmdDataQueueSpanGetMapped_
+//
+//**************************************************************************
+AiInt16 ApiCmdDataQueueSpanGetMapped_(AiUInt32 module, AiUInt32 id, TY_API_DATA_QUEUE_SPAN *px_Span)
+{
+    AiUInt32 queue_start;
+    AiUInt32 queue_put;
+    AiUInt32 queue_get;
+    AiUInt32 queue_data_start;
+    AiUInt32 queue_data_size;
+    AiUInt32 bytes_to_end;
+
+    TY_API_DATA_QUEUE_MAP * map;
+    TY_DEVICE_INFO * dev = _ApiGetDeviceInfoPtrByModule(module);
+
+    memset(px_Span, 0, sizeof(TY_API_DATA_QUEUE_SPAN));
+
+    if (dev == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
+
+    map = &dev->ax_QueueMap[id];
+
+    if (map->pucMemory == NULL)
+        return API_ERR_BUFFER_NOT_ALLOCATED;
+
+    queue_start = dev->ax_QueueTable[id].ul_QueueStart;
+
+    /* The TSW updates put after the data, so read it first */
+    queue_put        = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_PUT);
+    queue_get        = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_GET);
+    queue_data_start = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_START);
+    queue_data_size  = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_SIZE);
+
+    px_Span->ul_Status = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_STATUS);
+    dev->ax_QueueTable[id].x_QueueStatus.status = px_Span->ul_Status;
+
+    px_Span->ul_BytesAvailable = mil_tsw_buffer_consumer_available_bytes(queue_data_size, queue_put, queue_get);
+
+    if (px_Span->ul_BytesAvailable == 0)
+        return API_OK;
+
+    bytes_to_end = mil_tsw_buffer_bytes_to_end(queue_data_size, queue_data_start, queue_get);
+
+    px_Span->pv_Data1 = map->pucMemory + queue_get;
+
+    if (px_Span->ul_BytesAvailable <= bytes_to_end)
+    {
+        px_Span->ul_Size1 = px_Span->ul_BytesAvailable;
+    }
+    else
+    {
+        px_Span->ul_Size1 = bytes_to_end;
+        px_Span->pv_Data2 = map->pucMemory + queue_data_start;
+        px_Span->ul_Size2 = px_Span->ul_BytesAvailable - bytes_to_end;
+    }
+
+    return API_OK;
+}
+
+
+//**************************************************************************
+//
+//  ApiCmdDataQueueSpanReleaseMapped_
+//
+//**************************************************************************
+AiInt16 ApiCmdDataQueueSpanReleaseMapped_(AiUInt32 module, AiUInt32 id, AiUInt32 ul_Bytes)
+{
+    AiUInt32 queue_start;
+    AiUInt32 queue_put;
+    AiUInt32 queue_get;
+    AiUInt32 queue_data_start;
+    AiUInt32 queue_data_size;
+
+    TY_API_DATA_QUEUE_MAP * map;
+    TY_DEVICE_INFO * dev = _ApiGetDeviceInfoPtrByModule(module);
+
+    if (dev == NULL)
+        return API_ERR_NO_MODULE_EXTENSION;
+
+    map = &dev->ax_QueueMap[id];
+
+    if (map->pucMemory == NULL)
+        return API_ERR_BUFFER_NOT_ALLOCATED;
+
+    if (ul_Bytes == 0)
+        return API_OK;
+
+    queue_start = dev->ax_QueueTable[id].ul_QueueStart;
+
+    queue_put        = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_PUT);
+    queue_get        = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_GET);
+    queue_data_start = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_START);
+    queue_data_size  = DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_SIZE);
+
+    if (ul_Bytes > mil_tsw_buffer_consumer_available_bytes(queue_data_size, queue_put, queue_get))
+        return API_ERR_PARAM3_NOT_IN_RANGE;
+
+    mil_tsw_buffer_increment_offset(&queue_get, ul_Bytes, queue_data_start, queue_data_size);
+
+    DATA_QUEUE_MAP_HEADER(map, queue_start, API_DATA_QUEUE_TSW_OFFSET_GET) = queue_get;
+
+    dev->ax_QueueTable[id].x_QueueStatus.total_bytes_transfered += ul_Bytes;
+
+    return API_OK;
+}
+
+
+
+
+AiUInt8 _ApiCmdDataQueueDirectGetBiu(AiUInt8 ucId)
+{
+    AiUInt8 ucBiu = 0;
+
+    /* BM Recording */
+    if      (ucId == API_DATA_QUEUE_ID_BM_REC_BIU1)    ucBiu = 0;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU2)    ucBiu = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU3)    ucBiu = 2;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU4)    ucBiu = 3;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU5)    ucBiu = 4;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU6)    ucBiu = 5;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU7)    ucBiu = 6;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU8)    ucBiu = 7;
+    /* Milscope */
+    else if (ucId == API_DATA_QUEUE_ID_MIL_SCOPE)      ucBiu = 0;
+
+    return ucBiu;
+}
+
+AiUInt8 _ApiCmdDataQueueDirectIsBmRecording(AiUInt8 ucId)
+{
+    AiUInt8 ucBmRecording = 0;
+
+    /* BM Recording */
+    if      (ucId == API_DATA_QUEUE_ID_BM_REC_BIU1)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU2)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU3)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU4)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU5)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU6)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU7)    ucBmRecording = 1;
+    else if (ucId == API_DATA_QUEUE_ID_BM_REC_BIU8)    ucBmRecording = 1;
+    /* Milscope */
+    else if (ucId == API_DATA_QUEUE_ID_MIL_SCOPE)      ucBmRecording = 0;
+
+    return ucBmRecording;
+}
+
+
+
+AiUInt8 _ApiCmdDataQueueDirectIsHs(AiUInt8 ucDeviceType, AiUInt8 ucId)
+{
+    switch (ucDeviceType)
+    {
+    case TYPE_APX3910:
+    case TYPE_APX3910Xp:
+    case TYPE_APXX3910:
+    case TYPE_APXX3910Xp:
+    case TYPE_APEX3910:
+    case TYPE_APEX3910Xp:
+    case TYPE_ACE3910:
+    case TYPE_ACE3910Xp:
+    case TYPE_AXC3910:
+    case TYPE_AXC3910Xp:
+    case TYPE_ACX3910:
+    case TYPE_ACX3910Xp:
+    case TYPE_AVX3910:
+    case TYPE_AVX3910Xp:
+    case TYPE_ANET3910:
+    case TYPE_ANET3910Xp:
+        if (ucId == 1)
+            return 1;
+        break;
+
+    case TYPE_ACX3910_2:
+    case TYPE_ACX3910Xp_2:
+    case TYPE_AVX3910_2:
+    case TYPE_AVX3910Xp_2:
+        if ((ucId == 1) || (ucId == 3))
+            return 1;
+        break;
+
+    case TYPE_ACX_EFA_1_TWO_PBIS:
+    case TYPE_ACX_EFAXp_1_TWO_PBIS:
+    case TYPE_ACX_EFA_1_DS_TWO_PBIS:
+    case TYPE_ACX_EFAXp_1_DS_TWO_PBIS:
+    case TYPE_AVX_EFA_1_TWO_PBIS:
+    case TYPE_AVX_EFA_1_DS_TWO_PBIS:
+    case TYPE_AVX_EFAXp_1_TWO_PBIS:
+    case TYPE_AVX_EFAXp_1_DS_TWO_PBIS:
+        if (ucId == 2)
+            return 1;
+        break;
+
+    case TYPE_ACX_EFA_2_TWO_PBIS:
+    case TYPE_ACX_EFAXp_2_TWO_PBIS:
+    case TYPE_ACX_EFA_2_DS_TWO_PBIS:
+    case TYPE_ACX_EFAXp_2_DS_TWO_PBIS:
+    case TYPE_AVX_EFA_2_TWO_PBIS:
+    case TYPE_AVX_EFAXp_2_TWO_PBIS:
+    case TYPE_AVX_EFA_2_DS_TWO_PBIS:
+    case TYPE_AVX_EFAXp_2_DS_TWO_PBIS:
+        if (ucId == 3)
+            return 1;
+        break;
+
+    case TYPE_ACX_EFA_4_TWO_PBIS:
+    case TYPE_ACX_EFAXp_4_TWO_PBIS:
+    case TYPE_AVX_EFA_4_TWO_PBIS:
+    case TYPE_AVX_EFAXp_4_TWO_PBIS:
+        if (ucId == 16)
+            return 1;
+        break;
+
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueOpen(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 * queue_size)
+{
+    return ApiCmdDataQueueOpen(ul_Module, id, queue_size);
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueClose(AiUInt32 ul_Module, AiUInt32 id)
+{
+    return ApiCmdDataQueueClose(ul_Module, id);
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueControl(AiUInt32 ul_Module, AiUInt32 id, AiUInt32 mode)
+{
+    return ApiCmdDataQueueControl(ul_Module, id, mode);
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiAnsDataQueueRead(AiUInt32 ul_Module, TY_API_DATA_QUEUE_READ *px_QueueData, TY_API_DATA_QUEUE_STATUS * info)
+{
+    return ApiCmdDataQueueRead(ul_Module, px_QueueData, info);
+}
+
+
+
+
+//***************************************************************************
+//***       R E C O R D I N G     F I L E S
+//***************************************************************************
+//
+//    A recording file consists of a file header followed by blocks of BM
+//    data as read from the BM recording data queues. Each block starts with
+//    a TY_API_REC_FILE_BLOCK header and contains complete messages of one
+//    BIU only. A block is assembled per BIU, so interleaved writes of
+//    several BIUs do not cut the blocks short. When the file is closed, a
+//    copy of all block headers is appended as index, followed by the index
+//    trailer. This allows to seek to a time tag with a binary search over
+//    the index instead of scanning the whole file. Files without index,
+//    e.g. from an aborted recording, are still readable. In this case the
+//    index is rebuilt from the block headers when the file is opened.
+//
+//    A file handle must not be used by several threads at the same time.
+//    Blocks can be processed in parallel by opening the file once per thread.
+//
+//***************************************************************************
+
+#define API_REC_FILE_MAGIC          0x31434552  /* "REC1" */
+#define API_REC_FILE_BLOCK_MAGIC    0x4B4C4252  /* "RBLK" */
+#define API_REC_FILE_INDEX_MAGIC    0x58444952  /* "RIDX" */
+#define API_REC_FILE_VERSION        1
+
+#define API_REC_FILE_INDEX_INITIAL  256
+
+/* BM entry types relevant for the block headers.
+   The entries are in target byte order, swap them before use. */
+#define API_REC_FILE_ENTRY_TYPE(entry)  ((entry) >> 28)
+#define API_REC_FILE_ENTRY_DATA(entry)  ((entry) & 0x3FFFFFF)
+#define API_REC_FILE_ENTRY_TTLOW        0x2
+#define API_REC_FILE_ENTRY_TTHIGH       0x3
+
+
+typedef struct ty_api_rec_file_header
+{
+    AiUInt32 ul_Magic;
+    AiUInt32 ul_Version;
+    AiUInt32 ul_BlockSize;
+    AiUInt32 ul_Reserved;
+} TY_API_REC_FILE_HEADER;
+
+typedef struct ty_api_rec_file_trailer
+{
+    AiUInt32 ul_Magic;
+    AiUInt32 ul_BlockCount;
+    AiUInt64 ull_IndexOffset;
+} TY_API_REC_FILE_TRAILER;
+
+struct ty_api_rec_file
+{
+    FILE                  *px_Stream;
+    AiBoolean              b_Writer;
+    AiUInt32               ul_BlockSize;     /* Maximum block size in bytes */
+    AiUInt32              *apul_Entries[API_REC_FILE_MAX_BIU];   /* Block being assembled per BIU */
+    AiUInt32               aul_EntryCount[API_REC_FILE_MAX_BIU]; /* Entries in apul_Entries */
+    AiUInt64               ull_Offset;       /* File offset of the next block */
+    TY_API_REC_FILE_BLOCK *px_Index;
+    AiUInt32               ul_BlockCount;
+    AiUInt32               ul_IndexSize;     /* Allocated entries in px_Index */
+    AiUInt32              *apul_BiuIndex[API_REC_FILE_MAX_BIU];   /* Non empty blocks per BIU, for seeking */
+    AiUInt32               aul_BiuIndexCount[API_REC_FILE_MAX_BIU];
+    AiUInt32               ul_BiuIndexBlocks; /* ul_BlockCount when apul_BiuIndex was built */
+};
+
+
+
+static int i_RecFileSeek(FILE *px_Stream, AiInt64 ll_Offset, int i_Origin)
+{
+#ifdef _AIM_WINDOWS
+    return _fseeki64(px_Stream, ll_Offset, i_Origin);
+#else
+    return fseeko(px_Stream, (off_t)ll_Offset, i_Origin);
+#endif
+}
+
+static AiInt64 ll_RecFileTell(FILE *px_Stream)
+{
+#ifdef _AIM_WINDOWS
+    return _ftelli64(px_Stream);
+#else
+    return (AiInt64)ftello(px_Stream);
+#endif
+}
+
+static AiUInt64 ull_RecFileTime(AiUInt32 ul_TTHigh, AiUInt32 ul_TTLow)
+{
+    return ((AiUInt64)ul_TTHigh << 26) | ul_TTLow;
+}
+
+
+static void v_RecFileBiuIndexFree(TY_API_REC_FILE *px_File)
+{
+    AiUInt32 i;
+
+    for (i = 0; i < API_REC_FILE_MAX_BIU; i++)
+    {
+        if (px_File->apul_BiuIndex[i])
+            AiOsFree(px_File->apul_BiuIndex[i]);
+
+        px_File->apul_BiuIndex[i]     = NULL;
+        px_File->aul_BiuIndexCount[i] = 0;
+    }
+
+    px_File->ul_BiuIndexBlocks = 0;
+}
+
+
+static void v_RecFileFree(TY_API_REC_FILE *px_File)
+{
+    AiUInt32 i;
+
+    if (px_File->px_Stream)
+        fclose(px_File->px_Stream);
+
+    for (i = 0; i < API_REC_FILE_MAX_BIU; i++)
+    {
+        if (px_File->apul_Entries[i])
+            AiOsFree(px_File->apul_Entries[i]);
+    }
+
+    v_RecFileBiuIndexFree(px_File);
+
+    if (px_File->px_Index)
+        AiOsFree(px_File->px_Index);
+
+    AiOsFree(px_File);
+}
+
+
+static AiReturn uw_RecFileIndexAppend(TY_API_REC_FILE *px_File, const TY_API_REC_FILE_BLOCK *px_Block)
+{
+    TY_API_REC_FILE_BLOCK *px_Index;
+    AiUInt32 ul_Size;
+
+    if (px_File->ul_BlockCount == px_File->ul_IndexSize)
+    {
+        /* Double the index so appending stays cheap for long recordings */
+        ul_Size = px_File->ul_IndexSize ? (2 * px_File->ul_IndexSize) : API_REC_FILE_INDEX_INITIAL;
+
+        if (ul_Size > 0xFFFFFFFF / sizeof(TY_API_REC_FILE_BLOCK))
+            return API_ERR_MALLOC_FAILED;
+
+        px_Index = (TY_API_REC_FILE_BLOCK *)AiOsMalloc(ul_Size * sizeof(TY_API_REC_FILE_BLOCK));
+
+        if (px_Index == NULL)
+            return API_ERR_MALLOC_FAILED;
+
+        if (px_File->px_Index)
+        {
+            memcpy(px_Index, px_File->px_Index, px_File->ul_BlockCount * sizeof(TY_API_REC_FILE_BLOCK));
+            AiOsFree(px_File->px_Index);
+        }
+
+        px_File->px_Index     = px_Index;
+        px_File->ul_IndexSize = ul_Size;
+    }
+
+    px_File->px_Index[px_File->ul_BlockCount++] = *px_Block;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//  uw_RecFileWriteBlock
+//
+//  Writes the first ul_Entries entries of the block being assembled for
+//  ul_Biu to the file and moves the remaining entries to the start of the
+//  block buffer.
+//
+//***************************************************************************
+static AiReturn uw_RecFileWriteBlock(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu, AiUInt32 ul_Entries)
+{
+    TY_API_REC_FILE_BLOCK x_Block;
+    AiUInt32 *pul_Entries = px_File->apul_Entries[ul_Biu];
+    AiUInt32 ul_Entry;
+    AiUInt32 ul_Next;
+    AiUInt32 i;
+
+    memset(&x_Block, 0, sizeof(x_Block));
+
+    x_Block.ul_Magic     = API_REC_FILE_BLOCK_MAGIC;
+    x_Block.ul_Biu       = ul_Biu;
+    x_Block.ul_ByteCount = ul_Entries * sizeof(AiUInt32);
+    x_Block.ull_Offset   = px_File->ull_Offset;
+
+    for (i = 0; i + 1 < ul_Entries; i++)
+    {
+        ul_Entry = BSWAP32(pul_Entries[i]);
+        ul_Next  = BSWAP32(pul_Entries[i + 1]);
+
+        if (API_REC_FILE_ENTRY_TYPE(ul_Entry) != API_REC_FILE_ENTRY_TTHIGH)
+            continue;
+
+        if (API_REC_FILE_ENTRY_TYPE(ul_Next) != API_REC_FILE_ENTRY_TTLOW)
+            continue;
+
+        x_Block.ul_LastTTHigh = API_REC_FILE_ENTRY_DATA(ul_Entry);
+        x_Block.ul_LastTTLow  = API_REC_FILE_ENTRY_DATA(ul_Next);
+
+        if (x_Block.ul_MessageCount++ == 0)
+        {
+            x_Block.ul_FirstTTHigh = x_Block.ul_LastTTHigh;
+            x_Block.ul_FirstTTLow  = x_Block.ul_LastTTLow;
+        }
+    }
+
+    if (fwrite(&x_Block, sizeof(x_Block), 1, px_File->px_Stream) != 1)
+        return API_ERR_FILE_ACCESS;
+
+    if (fwrite(pul_Entries, sizeof(AiUInt32), ul_Entries, px_File->px_Stream) != ul_Entries)
+        return API_ERR_FILE_ACCESS;
+
+    px_File->ull_Offset += sizeof(x_Block) + x_Block.ul_ByteCount;
+
+    px_File->aul_EntryCount[ul_Biu] -= ul_Entries;
+
+    if (px_File->aul_EntryCount[ul_Biu] > 0)
+        memmove(pul_Entries, &pul_Entries[ul_Entries], px_File->aul_EntryCount[ul_Biu] * sizeof(AiUInt32));
+
+    return uw_RecFileIndexAppend(px_File, &x_Block);
+}
+
+
+//***************************************************************************
+//
+//  uw_RecFileWriteFullBlock
+//
+//  Writes a full block buffer. The block is cut before the last message,
+//  which might be continued by the next data, so that blocks always contain
+//  complete messages.
+//
+//***************************************************************************
+static AiReturn uw_RecFileWriteFullBlock(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu)
+{
+    AiUInt32 ul_Cut = px_File->aul_EntryCount[ul_Biu];
+
+    while (--ul_Cut > 0)
+    {
+        if (API_REC_FILE_ENTRY_TYPE(BSWAP32(px_File->apul_Entries[ul_Biu][ul_Cut])) == API_REC_FILE_ENTRY_TTHIGH)
+            break;
+    }
+
+    /* No message start found, the block holds garbage or a single message */
+    if (ul_Cut == 0)
+        ul_Cut = px_File->aul_EntryCount[ul_Biu];
+
+    return uw_RecFileWriteBlock(px_File, ul_Biu, ul_Cut);
+}
+
+
+//***************************************************************************
+//
+//  uw_RecFileBiuIndexUpdate
+//
+//  Builds the lists of block numbers per BIU used by ApiRecFileSeek.
+//  Blocks without messages carry no time tag and are left out.
+//
+//***************************************************************************
+static AiReturn uw_RecFileBiuIndexUpdate(TY_API_REC_FILE *px_File)
+{
+    AiUInt32 ul_Biu;
+    AiUInt32 i;
+
+    if (px_File->ul_BiuIndexBlocks == px_File->ul_BlockCount)
+        return API_OK;
+
+    v_RecFileBiuIndexFree(px_File);
+
+    for (i = 0; i < px_File->ul_BlockCount; i++)
+    {
+        ul_Biu = px_File->px_Index[i].ul_Biu;
+
+        if ((ul_Biu < API_REC_FILE_MAX_BIU) && (px_File->px_Index[i].ul_MessageCount > 0))
+            px_File->aul_BiuIndexCount[ul_Biu]++;
+    }
+
+    for (ul_Biu = 0; ul_Biu < API_REC_FILE_MAX_BIU; ul_Biu++)
+    {
+        if (px_File->aul_BiuIndexCount[ul_Biu] == 0)
+            continue;
+
+        px_File->apul_BiuIndex[ul_Biu] = (AiUInt32 *)AiOsMalloc(px_File->aul_BiuIndexCount[ul_Biu] * sizeof(AiUInt32));
+
+        if (px_File->apul_BiuIndex[ul_Biu] == NULL)
+        {
+            v_RecFileBiuIndexFree(px_File);
+            return API_ERR_MALLOC_FAILED;
+        }
+
+        px_File->aul_BiuIndexCount[ul_Biu] = 0;
+    }
+
+    for (i = 0; i < px_File->ul_BlockCount; i++)
+    {
+        ul_Biu = px_File->px_Index[i].ul_Biu;
+
+        if ((ul_Biu < API_REC_FILE_MAX_BIU) && (px_File->px_Index[i].ul_MessageCount > 0))
+            px_File->apul_BiuIndex[ul_Biu][px_File->aul_BiuIndexCount[ul_Biu]++] = i;
+    }
+
+    px_File->ul_BiuIndexBlocks = px_File->ul_BlockCount;
+
+    return API_OK;
+}
+
+
+static AiReturn uw_RecFileReadIndex(TY_API_REC_FILE *px_File)
+{
+    TY_API_REC_FILE_TRAILER x_Trailer;
+    TY_API_REC_FILE_BLOCK   x_Block;
+    AiInt64  ll_FileSize;
+    AiUInt64 ull_Offset;
+    AiUInt32 i;
+    AiReturn uw_RetVal;
+
+    if (i_RecFileSeek(px_File->px_Stream, 0, SEEK_END) != 0)
+        return API_ERR_FILE_ACCESS;
+
+    ll_FileSize = ll_RecFileTell(px_File->px_Stream);
+
+    if (ll_FileSize < 0)
+        return API_ERR_FILE_ACCESS;
+
+    /* Use the index written on close if available */
+    if ((AiUInt64)ll_FileSize >= sizeof(TY_API_REC_FILE_HEADER) + sizeof(x_Trailer)
+        && i_RecFileSeek(px_File->px_Stream, ll_FileSize - (AiInt64)sizeof(x_Trailer), SEEK_SET) == 0
+        && fread(&x_Trailer, sizeof(x_Trailer), 1, px_File->px_Stream) == 1
+        && x_Trailer.ul_Magic == API_REC_FILE_INDEX_MAGIC
+        && x_Trailer.ull_IndexOffset + (AiUInt64)x_Trailer.ul_BlockCount * sizeof(x_Block) + sizeof(x_Trailer) == (AiUInt64)ll_FileSize)
+    {
+        if (x_Trailer.ul_BlockCount > 0)
+        {
+            px_File->px_Index = (TY_API_REC_FILE_BLOCK *)AiOsMalloc(x_Trailer.ul_BlockCount * sizeof(x_Block));
+
+            if (px_File->px_Index == NULL)
+                return API_ERR_MALLOC_FAILED;
+
+            px_File->ul_IndexSize = x_Trailer.ul_BlockCount;
+
+            if (i_RecFileSeek(px_File->px_Stream, (AiInt64)x_Trailer.ull_IndexOffset, SEEK_SET) != 0)
+                return API_ERR_FILE_ACCESS;
+
+            if (fread(px_File->px_Index, sizeof(x_Block), x_Trailer.ul_BlockCount, px_File->px_Stream) != x_Trailer.ul_BlockCount)
+                return API_ERR_FILE_ACCESS;
+
+            for (i = 0; i < x_Trailer.ul_BlockCount; i++)
+            {
+                if (px_File->px_Index[i].ul_Magic != API_REC_FILE_BLOCK_MAGIC)
+                    return API_ERR_FILE_FORMAT;
+            }
+        }
+
+        px_File->ul_BlockCount = x_Trailer.ul_BlockCount;
+
+        return API_OK;
+    }
+
+    /* No valid index, rebuild it from the block headers */
+    ull_Offset = sizeof(TY_API_REC_FILE_HEADER);
+
+    while (ull_Offset + sizeof(x_Block) <= (AiUInt64)ll_FileSize)
+    {
+        if (i_RecFileSeek(px_File->px_Stream, (AiInt64)ull_Offset, SEEK_SET) != 0)
+            return API_ERR_FILE_ACCESS;
+
+        if (fread(&x_Block, sizeof(x_Block), 1, px_File->px_Stream) != 1)
+            return API_ERR_FILE_ACCESS;
+
+        if ((x_Block.ul_Magic != API_REC_FILE_BLOCK_MAGIC) || (x_Block.ull_Offset != ull_Offset))
+            break;
+
+        /* Block was not written completely */
+        if (ull_Offset + sizeof(x_Block) + x_Block.ul_ByteCount > (AiUInt64)ll_FileSize)
+            break;
+
+        uw_RetVal = uw_RecFileIndexAppend(px_File, &x_Block);
+
+        if (uw_RetVal != API_OK)
+            return uw_RetVal;
+
+        ull_Offset += sizeof(x_Block) + x_Block.ul_ByteCount;
+    }
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileCreate
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Creates a recording file for BM data queue output.
+//                  ul_BlockSize is the maximum size of the BM data in one
+//                  block, 0 selects API_REC_FILE_DEFAULT_BLOCK_SIZE.
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileCreate(const char *psz_FileName, AiUInt32 ul_BlockSize, TY_API_REC_FILE **ppx_File)
+{
+    TY_API_REC_FILE_HEADER x_Header;
+    TY_API_REC_FILE *px_File;
+
+    if (psz_FileName == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (ppx_File == NULL)
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (ul_BlockSize == 0)
+        ul_BlockSize = API_REC_FILE_DEFAULT_BLOCK_SIZE;
+
+    if ((ul_BlockSize < API_REC_FILE_MIN_BLOCK_SIZE) || (ul_BlockSize > API_REC_FILE_MAX_BLOCK_SIZE) || (ul_BlockSize % sizeof(AiUInt32)))
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    *ppx_File = NULL;
+
+    px_File = (TY_API_REC_FILE *)AiOsMalloc(sizeof(TY_API_REC_FILE));
+
+    if (px_File == NULL)
+        return API_ERR_MALLOC_FAILED;
+
+    memset(px_File, 0, sizeof(TY_API_REC_FILE));
+
+    px_File->b_Writer     = AiTrue;
+    px_File->ul_BlockSize = ul_BlockSize;
+
+    px_File->px_Stream = fopen(psz_FileName, "wb");
+
+    if (px_File->px_Stream == NULL)
+    {
+        v_RecFileFree(px_File);
+        return API_ERR_FILE_ACCESS;
+    }
+
+    memset(&x_Header, 0, sizeof(x_Header));
+    x_Header.ul_Magic     = API_REC_FILE_MAGIC;
+    x_Header.ul_Version   = API_REC_FILE_VERSION;
+    x_Header.ul_BlockSize = ul_BlockSize;
+
+    if (fwrite(&x_Header, sizeof(x_Header), 1, px_File->px_Stream) != 1)
+    {
+        v_RecFileFree(px_File);
+        return API_ERR_FILE_ACCESS;
+    }
+
+    px_File->ull_Offset = sizeof(x_Header);
+
+    *ppx_File = px_File;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileWrite
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Appends BM data as read with ApiCmdDataQueueRead to a
+//                  recording file. The data can be split at any entry
+//                  boundary. Data of different BIUs is stored in separate
+//                  blocks, each BIU below API_REC_FILE_MAX_BIU has its own
+//                  block buffer, allocated with its first data.
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileWrite(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu, const void *pv_Data, AiUInt32 ul_Bytes)
+{
+    const AiUInt32 *pul_Data = (const AiUInt32 *)pv_Data;
+    AiUInt32 *pul_Entries;
+    AiUInt32 ul_Entries;
+    AiUInt32 ul_Copy;
+    AiUInt32 ul_BlockEntries;
+    AiReturn uw_RetVal = API_OK;
+
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (!px_File->b_Writer)
+        return API_ERR_INVALID_MODE;
+
+    if ((pv_Data == NULL) && (ul_Bytes > 0))
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (ul_Biu >= API_REC_FILE_MAX_BIU)
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (ul_Bytes % sizeof(AiUInt32))
+        return API_ERR_PARAM4_NOT_IN_RANGE;
+
+    if (ul_Bytes == 0)
+        return API_OK;
+
+    if (px_File->apul_Entries[ul_Biu] == NULL)
+    {
+        px_File->apul_Entries[ul_Biu] = (AiUInt32 *)AiOsMalloc(px_File->ul_BlockSize);
+
+        if (px_File->apul_Entries[ul_Biu] == NULL)
+            return API_ERR_MALLOC_FAILED;
+    }
+
+    pul_Entries     = px_File->apul_Entries[ul_Biu];
+    ul_Entries      = ul_Bytes / sizeof(AiUInt32);
+    ul_BlockEntries = px_File->ul_BlockSize / sizeof(AiUInt32);
+
+    while (ul_Entries > 0)
+    {
+        ul_Copy = ul_BlockEntries - px_File->aul_EntryCount[ul_Biu];
+
+        if (ul_Copy > ul_Entries)
+            ul_Copy = ul_Entries;
+
+        memcpy(&pul_Entries[px_File->aul_EntryCount[ul_Biu]], pul_Data, ul_Copy * sizeof(AiUInt32));
+
+        px_File->aul_EntryCount[ul_Biu] += ul_Copy;
+        pul_Data                        += ul_Copy;
+        ul_Entries                      -= ul_Copy;
+
+        if (px_File->aul_EntryCount[ul_Biu] == ul_BlockEntries)
+        {
+            uw_RetVal = uw_RecFileWriteFullBlock(px_File, ul_Biu);
+
+            if (uw_RetVal != API_OK)
+                break;
+        }
+    }
+
+    return uw_RetVal;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileOpen
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Opens a recording file for reading
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileOpen(const char *psz_FileName, TY_API_REC_FILE **ppx_File)
+{
+    TY_API_REC_FILE_HEADER x_Header;
+    TY_API_REC_FILE *px_File;
+    AiReturn uw_RetVal;
+
+    if (psz_FileName == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (ppx_File == NULL)
+        return API_ERR_PARAM2_IS_NULL;
+
+    *ppx_File = NULL;
+
+    px_File = (TY_API_REC_FILE *)AiOsMalloc(sizeof(TY_API_REC_FILE));
+
+    if (px_File == NULL)
+        return API_ERR_MALLOC_FAILED;
+
+    memset(px_File, 0, sizeof(TY_API_REC_FILE));
+
+    px_File->px_Stream = fopen(psz_FileName, "rb");
+
+    if (px_File->px_Stream == NULL)
+    {
+        v_RecFileFree(px_File);
+        return API_ERR_FILE_ACCESS;
+    }
+
+    if (fread(&x_Header, sizeof(x_Header), 1, px_File->px_Stream) != 1)
+    {
+        v_RecFileFree(px_File);
+        return API_ERR_FILE_FORMAT;
+    }
+
+    if ((x_Header.ul_Magic != API_REC_FILE_MAGIC) || (x_Header.ul_Version != API_REC_FILE_VERSION))
+    {
+        v_RecFileFree(px_File);
+        return API_ERR_FILE_FORMAT;
+    }
+
+    px_File->ul_BlockSize = x_Header.ul_BlockSize;
+
+    uw_RetVal = uw_RecFileReadIndex(px_File);
+
+    if (uw_RetVal != API_OK)
+    {
+        v_RecFileFree(px_File);
+        return uw_RetVal;
+    }
+
+    *ppx_File = px_File;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileClose
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Closes a recording file. For files created with
+//                  ApiRecFileCreate the remaining data and the block index
+//                  are written before the file is closed.
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileClose(TY_API_REC_FILE *px_File)
+{
+    TY_API_REC_FILE_TRAILER x_Trailer;
+    AiUInt32 ul_Biu;
+    AiReturn uw_RetVal = API_OK;
+
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (px_File->b_Writer)
+    {
+        for (ul_Biu = 0; (ul_Biu < API_REC_FILE_MAX_BIU) && (uw_RetVal == API_OK); ul_Biu++)
+        {
+            if (px_File->aul_EntryCount[ul_Biu] > 0)
+                uw_RetVal = uw_RecFileWriteBlock(px_File, ul_Biu, px_File->aul_EntryCount[ul_Biu]);
+        }
+
+        if (uw_RetVal == API_OK)
+        {
+            memset(&x_Trailer, 0, sizeof(x_Trailer));
+            x_Trailer.ul_Magic        = API_REC_FILE_INDEX_MAGIC;
+            x_Trailer.ul_BlockCount   = px_File->ul_BlockCount;
+            x_Trailer.ull_IndexOffset = px_File->ull_Offset;
+
+            if (fwrite(px_File->px_Index, sizeof(TY_API_REC_FILE_BLOCK), px_File->ul_BlockCount, px_File->px_Stream) != px_File->ul_BlockCount)
+                uw_RetVal = API_ERR_FILE_ACCESS;
+            else if (fwrite(&x_Trailer, sizeof(x_Trailer), 1, px_File->px_Stream) != 1)
+                uw_RetVal = API_ERR_FILE_ACCESS;
+        }
+
+        if (fclose(px_File->px_Stream) != 0 && uw_RetVal == API_OK)
+            uw_RetVal = API_ERR_FILE_ACCESS;
+
+        px_File->px_Stream = NULL;
+    }
+
+    v_RecFileFree(px_File);
+
+    return uw_RetVal;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileBlockCount
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Returns the number of blocks in a recording file
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockCount(TY_API_REC_FILE *px_File, AiUInt32 *pul_BlockCount)
+{
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (pul_BlockCount == NULL)
+        return API_ERR_PARAM2_IS_NULL;
+
+    *pul_BlockCount = px_File->ul_BlockCount;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileBlockInfo
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Returns the header of one block of a recording file
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockInfo(TY_API_REC_FILE *px_File, AiUInt32 ul_Block, TY_API_REC_FILE_BLOCK *px_Block)
+{
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (ul_Block >= px_File->ul_BlockCount)
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (px_Block == NULL)
+        return API_ERR_PARAM3_IS_NULL;
+
+    *px_Block = px_File->px_Index[ul_Block];
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileBlockRead
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Reads the BM data of one block of a recording file.
+//                  The buffer must hold at least ul_ByteCount of the block.
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileBlockRead(TY_API_REC_FILE *px_File, AiUInt32 ul_Block, void *pv_Buffer, AiUInt32 ul_BufferSize, AiUInt32 *pul_BytesRead)
+{
+    TY_API_REC_FILE_BLOCK *px_Block;
+
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (ul_Block >= px_File->ul_BlockCount)
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (pv_Buffer == NULL)
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (pul_BytesRead == NULL)
+        return API_ERR_PARAM5_IS_NULL;
+
+    *pul_BytesRead = 0;
+
+    px_Block = &px_File->px_Index[ul_Block];
+
+    if (ul_BufferSize < px_Block->ul_ByteCount)
+        return API_ERR_BUFFER_TOO_SMALL;
+
+    if (px_File->b_Writer)
+        return API_ERR_INVALID_MODE;
+
+    if (i_RecFileSeek(px_File->px_Stream, (AiInt64)(px_Block->ull_Offset + sizeof(TY_API_REC_FILE_BLOCK)), SEEK_SET) != 0)
+        return API_ERR_FILE_ACCESS;
+
+    if (fread(pv_Buffer, 1, px_Block->ul_ByteCount, px_File->px_Stream) != px_Block->ul_ByteCount)
+        return API_ERR_FILE_ACCESS;
+
+    *pul_BytesRead = px_Block->ul_ByteCount;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : ApiLsDQue                Submodule : ApiRecFileSeek
+//
+//---------------------------------------------------------------------------
+//
+//    Description : Returns the first block of the given BIU that contains
+//                  messages with a time tag equal or later than the given
+//                  time. If all messages of the BIU are earlier, the block
+//                  count is returned. The blocks of one BIU are in time
+//                  order, blocks without messages are skipped.
+//
+//***************************************************************************
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiRecFileSeek(TY_API_REC_FILE *px_File, AiUInt32 ul_Biu, AiUInt32 ul_TTHigh, AiUInt32 ul_TTLow, AiUInt32 *pul_Block)
+{
+    TY_API_REC_FILE_BLOCK *px_Block;
+    AiUInt32 *pul_BiuIndex;
+    AiUInt64 ull_Time;
+    AiUInt32 ul_Low;
+    AiUInt32 ul_High;
+    AiUInt32 ul_Mid;
+    AiReturn uw_RetVal;
+
+    if (px_File == NULL)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (ul_Biu >= API_REC_FILE_MAX_BIU)
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (pul_Block == NULL)
+        return API_ERR_PARAM5_IS_NULL;
+
+    uw_RetVal = uw_RecFileBiuIndexUpdate(px_File);
+
+    if (uw_RetVal != API_OK)
+        return uw_RetVal;
+
+    pul_BiuIndex = px_File->apul_BiuIndex[ul_Biu];
+    ull_Time     = ull_RecFileTime(ul_TTHigh, ul_TTLow);
+    ul_Low       = 0;
+    ul_High      = px_File->aul_BiuIndexCount[ul_Biu];
+
+    while (ul_Low < ul_High)
+    {
+        ul_Mid   = ul_Low + (ul_High - ul_Low) / 2;
+        px_Block = &px_File->px_Index[pul_BiuIndex[ul_Mid]];
+
+        if (ull_RecFileTime(px_Block->ul_LastTTHigh, px_Block->ul_LastTTLow) < ull_Time)
+            ul_Low = ul_Mid + 1;
+        else
+            ul_High = ul_Mid;
+    }
+
+    if (ul_Low < px_File->aul_BiuIndexCount[ul_Biu])
+        *pul_Block = pul_BiuIndex[ul_Low];
+    else
+        *pul_Block = px_File->ul_BlockCount;
+
+    return API_OK;
 }
 
 
@@ -423,3 +423,665 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdQueueRead(AiUInt32 bModule, AiUInt8 biu,
 
     return uw_RetVal;
 }
+
+
+
+//***************************************************************************
+//***       B M    D A T A    S T R E A M    D E C O D I N G
+//***************************************************************************
+
+/* Entry type is stored in bits 28..31 of a BM entry, the entry data in bits 0..25.
+   The entries are in target byte order and must be swapped with BSWAP32 first. */
+#define BM_STREAM_ENTRY_TYPE(entry)     ((entry) >> 28)
+#define BM_STREAM_ENTRY_DATA(entry)     ((entry) & 0x3FFFFFF)
+
+#define BM_STREAM_TYPE_ERROR            0x1
+#define BM_STREAM_TYPE_TTLOW            0x2
+#define BM_STREAM_TYPE_TTHIGH           0x3
+
+/* Bus word entries (type 8..15) differ in bit 2 only depending on the bus they were received on */
+#define BM_STREAM_BUS_WORD              0x8
+#define BM_STREAM_BUS_SECONDARY         0x4
+#define BM_STREAM_BUS_WORD_KIND(type)   ((type) & 0xB)
+#define BM_STREAM_KIND_CW1              0x8
+#define BM_STREAM_KIND_CW2              0x9
+#define BM_STREAM_KIND_DW               0xA
+#define BM_STREAM_KIND_SW               0xB
+
+/* Maximum number of data words a 1553 message can hold */
+#define BM_STREAM_MAX_DATA_WORDS        32
+
+
+/* Bit position of the lowest set bit, indexed by de Bruijn sequence */
+static const AiUInt8 auc_BMStreamLowestBit[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+};
+
+
+/*! \brief Maps a BM error entry to its API_BM_MSG_ERR_xxx code
+ *
+ * The error bits API_BM_ET_NRESP_MASK (bit 0) up to API_BM_ET_ALTER_MASK (bit 14)
+ * map in ascending order to the error codes API_BM_MSG_ERR_NO_RESP (1) up to API_BM_MSG_ERR_ILLEGL (15).
+ * Lower bits take precedence, so the code is the index of the lowest set bit plus one.
+ *
+ * \param ul_Data data of the error entry
+ * \return the error code or 0 if no error bit is set
+ */
+static AiUInt16 uw_BMStreamErrorCode(AiUInt32 ul_Data)
+{
+    AiUInt32 ul_Bits = ul_Data & 0x7FFF;
+
+    if( 0 == ul_Bits )
+        return 0;
+
+    return (AiUInt16)(auc_BMStreamLowestBit[((ul_Bits & (0 - ul_Bits)) * 0x077CB531UL) >> 27 & 0x1F] + 1);
+}
+
+
+/*! \brief Decodes one complete BM message
+ *
+ * \param pul_Entry first entry of the message, which is the time tag high. The second one must be the time tag low.
+ * \param pul_End end of the message, i.e. the time tag high of the next message
+ * \param px_Msg the decoded message is stored here
+ */
+static void v_BMStreamDecodeMessage(const AiUInt32 *pul_Entry, const AiUInt32 *pul_End, TY_API_QUEUE_BUF_EX *px_Msg)
+{
+    AiUInt32 ul_Entry;
+    AiUInt32 ul_Type;
+    AiUInt32 ul_Data;
+    AiUInt32 ul_DataIndex = 0;
+    AiUInt32 ul_StatusCount = 0;
+
+    memset(px_Msg, 0, sizeof(TY_API_QUEUE_BUF_EX));
+
+    ul_Entry        = BSWAP32(pul_Entry[0]);
+    px_Msg->ttag_hi = BM_STREAM_ENTRY_DATA(ul_Entry);
+    ul_Entry        = BSWAP32(pul_Entry[1]);
+    px_Msg->ttag_lo = BM_STREAM_ENTRY_DATA(ul_Entry);
+
+    for( pul_Entry += 2; pul_Entry < pul_End; pul_Entry++ )
+    {
+        ul_Entry = BSWAP32(*pul_Entry);
+        ul_Type  = BM_STREAM_ENTRY_TYPE(ul_Entry);
+        ul_Data  = BM_STREAM_ENTRY_DATA(ul_Entry);
+
+        if( ul_Type & BM_STREAM_BUS_WORD )
+        {
+            switch( BM_STREAM_BUS_WORD_KIND(ul_Type) )
+            {
+            case BM_STREAM_KIND_DW:
+                if( ul_DataIndex < BM_STREAM_MAX_DATA_WORDS )
+                    px_Msg->buffer[ul_DataIndex++] = (AiUInt16)ul_Data;
+                break;
+            case BM_STREAM_KIND_CW1:
+                px_Msg->rt_addr  = (AiUInt8)((ul_Data >> 11) & 0x1F);
+                px_Msg->sa_type  = (AiUInt8)((ul_Data >> 10) & 0x1);
+                px_Msg->sa_mc    = (AiUInt8)((ul_Data >> 5) & 0x1F);
+                px_Msg->word_cnt = (AiUInt8)(ul_Data & 0x1F);
+                px_Msg->rbf_trw  = (ul_Type & BM_STREAM_BUS_SECONDARY) ? 0 : 1;
+                break;
+            case BM_STREAM_KIND_CW2:
+                px_Msg->rt_addr2 = (AiUInt8)((ul_Data >> 11) & 0x1F);
+                px_Msg->sa_type2 = (AiUInt8)((ul_Data >> 10) & 0x1);
+                px_Msg->sa_mc2   = (AiUInt8)((ul_Data >> 5) & 0x1F);
+                break;
+            default: /* BM_STREAM_KIND_SW */
+                if( ul_Type & BM_STREAM_BUS_SECONDARY )
+                    px_Msg->msg_trw &= ~(1 << 11);
+                else
+                    px_Msg->msg_trw |= (1 << 11);
+
+                px_Msg->msg_trw |= (AiUInt16)(ul_Data & 0x3FF);
+
+                if( ul_StatusCount++ == 0 )
+                    px_Msg->status_word1 = (AiUInt16)ul_Data;
+                else
+                    px_Msg->status_word2 = (AiUInt16)ul_Data;
+                break;
+            }
+        }
+        else if( ul_Type == BM_STREAM_TYPE_ERROR )
+        {
+            /* Only the first error of a message is reported */
+            if( 0 == (px_Msg->msg_trw & 0xF000) )
+                px_Msg->msg_trw |= uw_BMStreamErrorCode(ul_Data) << 12;
+        }
+        /* Not updated (0) and reserved (4..7) entries are ignored */
+    }
+}
+
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiBMStreamDecode
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Raw BM entries and output array [px_Decode]
+//
+//    Outputs   : Decoded messages and number of consumed entries [px_Decode]
+//                Instruction execution status [status]
+//
+//    Description :
+//    This function decodes raw BM entries, as delivered by the BM data queue,
+//    into TY_API_QUEUE_BUF_EX records. A message starts with a time tag high
+//    entry followed by a time tag low entry and ends before the time tag high
+//    of the next message. Entries that do not belong to a well formed message
+//    are skipped until the next time tag high and counted in ul_EntriesSkipped.
+//    Without API_BM_STREAM_DECODE_FLUSH the last message is left undecoded,
+//    as further entries of it may still be in flight. Its entries are not
+//    counted in ul_EntriesConsumed, so the caller can pass them again together
+//    with the next chunk of data.
+//
+//***************************************************************************
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMStreamDecode(TY_API_BM_STREAM_DECODE *px_Decode)
+{
+    const AiUInt32 *pul_Data;
+    AiUInt32 ul_Count;
+    AiUInt32 ul_Pos;
+    AiUInt32 ul_End;
+    AiUInt32 ul_Messages = 0;
+    AiUInt32 ul_Skipped  = 0;
+
+    if( NULL == px_Decode )
+        return API_ERR_PARAM1_IS_NULL;
+
+    if( ((NULL == px_Decode->pul_Data) && (px_Decode->ul_EntryCount > 0))
+     || ((NULL == px_Decode->px_Messages) && (px_Decode->ul_MaxMessages > 0)) )
+        return API_ERR_PARAM1_IS_NULL;
+
+    pul_Data = px_Decode->pul_Data;
+    ul_Count = px_Decode->ul_EntryCount;
+    ul_Pos   = 0;
+
+    while( (ul_Pos < ul_Count) && (ul_Messages < px_Decode->ul_MaxMessages) )
+    {
+        if( BM_STREAM_ENTRY_TYPE(BSWAP32(pul_Data[ul_Pos])) != BM_STREAM_TYPE_TTHIGH )
+        {
+            /* Resynchronize to the start of the next message */
+            ul_Pos++;
+            ul_Skipped++;
+            continue;
+        }
+
+        for( ul_End = ul_Pos + 1; ul_End < ul_Count; ul_End++ )
+        {
+            if( BM_STREAM_ENTRY_TYPE(BSWAP32(pul_Data[ul_End])) == BM_STREAM_TYPE_TTHIGH )
+                break;
+        }
+
+        if( (ul_End == ul_Count) && !(px_Decode->ul_Flags & API_BM_STREAM_DECODE_FLUSH) )
+            break;
+
+        if( ((ul_End - ul_Pos) < 2) || (BM_STREAM_ENTRY_TYPE(BSWAP32(pul_Data[ul_Pos + 1])) != BM_STREAM_TYPE_TTLOW) )
+        {
+            ul_Skipped += ul_End - ul_Pos;
+            ul_Pos = ul_End;
+            continue;
+        }
+
+        v_BMStreamDecodeMessage(&pul_Data[ul_Pos], &pul_Data[ul_End], &px_Decode->px_Messages[ul_Messages]);
+
+        ul_Messages++;
+        ul_Pos = ul_End;
+    }
+
+    px_Decode->ul_MessageCount    = ul_Messages;
+    px_Decode->ul_EntriesConsumed = ul_Pos;
+    px_Decode->ul_EntriesSkipped  = ul_Skipped;
+
+    return API_OK;
+}
+
+
+
+//***************************************************************************
+//***       M E R G E D    B M    D A T A    S T R E A M
+//***************************************************************************
+
+/* Number of messages decoded at once per source */
+#define BM_MERGE_DECODE_MESSAGES        64
+
+typedef struct ty_api_bm_merge_src
+{
+    TY_API_BM_MERGE_SOURCE  x_Source;
+    AiUInt32               *pul_Raw;            /* Entries read from the data queue but not decoded yet */
+    AiUInt32                ul_RawCount;
+    AiUInt32                ul_RawSize;         /* Capacity of pul_Raw in entries */
+    TY_API_QUEUE_BUF_EX     ax_Msgs[BM_MERGE_DECODE_MESSAGES];
+    AiUInt32                ul_MsgPos;          /* Next message of ax_Msgs to merge */
+    AiUInt32                ul_MsgCount;
+    AiUInt32                ul_IdleCount;       /* Consecutive polls without data */
+    AiBoolean               b_Polled;           /* Queue was read during the current ApiBMMergeRead */
+    AiBoolean               b_Started;
+} TY_API_BM_MERGE_SRC;
+
+struct ty_api_bm_merge
+{
+    TY_API_BM_MERGE_SRC    *px_Src;
+    AiUInt32                ul_SourceCount;
+    AiUInt32                ul_IdlePolls;
+    AiUInt32               *pul_Heap;           /* Min heap of sources with a decoded message */
+    AiUInt32                ul_HeapCount;
+};
+
+
+static AiUInt64 ull_BMMergeTime(const TY_API_BM_MERGE_SRC *px_Src)
+{
+    const TY_API_QUEUE_BUF_EX *px_Msg = &px_Src->ax_Msgs[px_Src->ul_MsgPos];
+
+    return ((AiUInt64)px_Msg->ttag_hi << 26) | px_Msg->ttag_lo;
+}
+
+/* Orders by time tag, equal time tags by source index to keep the output deterministic */
+static AiBoolean b_BMMergeLess(const TY_API_BM_MERGE *px_Merge, AiUInt32 ul_A, AiUInt32 ul_B)
+{
+    AiUInt64 ull_A = ull_BMMergeTime(&px_Merge->px_Src[ul_A]);
+    AiUInt64 ull_B = ull_BMMergeTime(&px_Merge->px_Src[ul_B]);
+
+    if (ull_A != ull_B)
+        return (ull_A < ull_B) ? AiTrue : AiFalse;
+
+    return (ul_A < ul_B) ? AiTrue : AiFalse;
+}
+
+static void v_BMMergeHeapPush(TY_API_BM_MERGE *px_Merge, AiUInt32 ul_Source)
+{
+    AiUInt32 *pul_Heap = px_Merge->pul_Heap;
+    AiUInt32  ul_Pos   = px_Merge->ul_HeapCount++;
+    AiUInt32  ul_Parent;
+
+    while (ul_Pos > 0)
+    {
+        ul_Parent = (ul_Pos - 1) / 2;
+
+        if (!b_BMMergeLess(px_Merge, ul_Source, pul_Heap[ul_Parent]))
+            break;
+
+        pul_Heap[ul_Pos] = pul_Heap[ul_Parent];
+        ul_Pos = ul_Parent;
+    }
+
+    pul_Heap[ul_Pos] = ul_Source;
+}
+
+/* Replaces the top of the heap by ul_Source and restores the heap order */
+static void v_BMMergeHeapSiftDown(TY_API_BM_MERGE *px_Merge, AiUInt32 ul_Source)
+{
+    AiUInt32 *pul_Heap = px_Merge->pul_Heap;
+    AiUInt32  ul_Pos   = 0;
+    AiUInt32  ul_Child;
+
+    for (;;)
+    {
+        ul_Child = 2 * ul_Pos + 1;
+
+        if (ul_Child >= px_Merge->ul_HeapCount)
+            break;
+
+        if ((ul_Child + 1 < px_Merge->ul_HeapCount) && b_BMMergeLess(px_Merge, pul_Heap[ul_Child + 1], pul_Heap[ul_Child]))
+            ul_Child++;
+
+        if (!b_BMMergeLess(px_Merge, pul_Heap[ul_Child], ul_Source))
+            break;
+
+        pul_Heap[ul_Pos] = pul_Heap[ul_Child];
+        ul_Pos = ul_Child;
+    }
+
+    pul_Heap[ul_Pos] = ul_Source;
+}
+
+/* Decodes the buffered raw entries of a source */
+static AiReturn uw_BMMergeDecode(TY_API_BM_MERGE_SRC *px_Src, AiUInt32 ul_Flags)
+{
+    TY_API_BM_STREAM_DECODE x_Decode;
+    AiReturn uw_RetVal;
+
+    memset(&x_Decode, 0, sizeof(x_Decode));
+    x_Decode.pul_Data       = px_Src->pul_Raw;
+    x_Decode.ul_EntryCount  = px_Src->ul_RawCount;
+    x_Decode.ul_Flags       = (ul_Flags & API_BM_MERGE_FLUSH) ? API_BM_STREAM_DECODE_FLUSH : 0;
+    x_Decode.px_Messages    = px_Src->ax_Msgs;
+    x_Decode.ul_MaxMessages = BM_MERGE_DECODE_MESSAGES;
+
+    uw_RetVal = ApiBMStreamDecode(&x_Decode);
+
+    if (uw_RetVal != API_OK)
+        return uw_RetVal;
+
+    if ((x_Decode.ul_EntriesConsumed == 0) && (px_Src->ul_RawCount == px_Src->ul_RawSize))
+        /* A single message does not fit into the buffer, drop it to make progress */
+        x_Decode.ul_EntriesConsumed = px_Src->ul_RawCount;
+
+    px_Src->ul_RawCount -= x_Decode.ul_EntriesConsumed;
+
+    if (px_Src->ul_RawCount > 0)
+        memmove(px_Src->pul_Raw, px_Src->pul_Raw + x_Decode.ul_EntriesConsumed, px_Src->ul_RawCount * sizeof(AiUInt32));
+
+    px_Src->ul_MsgPos   = 0;
+    px_Src->ul_MsgCount = x_Decode.ul_MessageCount;
+
+    return API_OK;
+}
+
+/* Makes sure the source has a decoded message if possible. The data queue is read at most once per ApiBMMergeRead */
+static AiReturn uw_BMMergeFill(TY_API_BM_MERGE_SRC *px_Src, AiUInt32 ul_Flags)
+{
+    TY_API_DATA_QUEUE_READ   x_Read;
+    TY_API_DATA_QUEUE_STATUS x_Info;
+    AiReturn uw_RetVal;
+
+    if (px_Src->ul_MsgPos < px_Src->ul_MsgCount)
+        return API_OK;
+
+    uw_RetVal = uw_BMMergeDecode(px_Src, ul_Flags);
+
+    if ((uw_RetVal != API_OK) || (px_Src->ul_MsgCount > 0) || px_Src->b_Polled)
+        return uw_RetVal;
+
+    memset(&x_Info, 0, sizeof(x_Info));
+    x_Read.id            = px_Src->x_Source.ul_QueueId;
+    x_Read.buffer        = px_Src->pul_Raw + px_Src->ul_RawCount;
+    x_Read.bytes_to_read = (px_Src->ul_RawSize - px_Src->ul_RawCount) * sizeof(AiUInt32);
+
+    uw_RetVal = ApiCmdDataQueueRead(px_Src->x_Source.ul_Module, &x_Read, &x_Info);
+
+    if (uw_RetVal != API_OK)
+        return uw_RetVal;
+
+    px_Src->b_Polled     = AiTrue;
+    px_Src->ul_RawCount += x_Info.bytes_transfered / sizeof(AiUInt32);
+
+    if (x_Info.bytes_transfered == 0)
+        px_Src->ul_IdleCount++;
+    else
+        px_Src->ul_IdleCount = 0;
+
+    return uw_BMMergeDecode(px_Src, ul_Flags);
+}
+
+static void v_BMMergeFree(TY_API_BM_MERGE *px_Merge)
+{
+    AiUInt32 i;
+
+    if (px_Merge->px_Src)
+    {
+        for (i = 0; i < px_Merge->ul_SourceCount; i++)
+        {
+            if (px_Merge->px_Src[i].b_Started)
+            {
+                ApiCmdDataQueueControl(px_Merge->px_Src[i].x_Source.ul_Module, px_Merge->px_Src[i].x_Source.ul_QueueId, API_DATA_QUEUE_CTRL_MODE_STOP);
+                ApiCmdDataQueueClose(px_Merge->px_Src[i].x_Source.ul_Module, px_Merge->px_Src[i].x_Source.ul_QueueId);
+            }
+
+            if (px_Merge->px_Src[i].pul_Raw)
+                AiOsFree(px_Merge->px_Src[i].pul_Raw);
+        }
+
+        AiOsFree(px_Merge->px_Src);
+    }
+
+    if (px_Merge->pul_Heap)
+        AiOsFree(px_Merge->pul_Heap);
+
+    AiOsFree(px_Merge);
+}
+
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiBMMergeCreate
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Data queues to merge [px_Sources, ul_SourceCount]
+//                Raw buffer size per source in bytes, 0 for default [ul_BufferSize]
+//                Empty polls after which a source no longer holds back [ul_IdlePolls]
+//
+//    Outputs   : Merge handle [ppx_Merge]
+//                Instruction execution status [status]
+//
+//    Description :
+//    This function opens and starts the BM recording data queues of several
+//    BIUs, possibly on different boards, for one merged stream in time tag
+//    order. The boards should share a common IRIG time source.
+//    A message is only passed on when every source either has a later message
+//    buffered or returned no data for ul_IdlePolls consecutive polls, so an
+//    idle bus delays the stream by at most ul_IdlePolls calls of ApiBMMergeRead.
+//
+//***************************************************************************
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeCreate(const TY_API_BM_MERGE_SOURCE *px_Sources, AiUInt32 ul_SourceCount,
+                                                   AiUInt32 ul_BufferSize, AiUInt32 ul_IdlePolls, TY_API_BM_MERGE **ppx_Merge)
+{
+    TY_API_BM_MERGE *px_Merge;
+    AiUInt32 ul_QueueSize;
+    AiReturn uw_RetVal;
+    AiUInt32 i, j;
+
+    if (NULL == px_Sources)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if (NULL == ppx_Merge)
+        return API_ERR_PARAM5_IS_NULL;
+
+    if ((ul_SourceCount == 0) || (ul_SourceCount > API_BM_MERGE_MAX_SOURCES))
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (ul_BufferSize == 0)
+        ul_BufferSize = API_BM_MERGE_DEFAULT_BUFFER;
+
+    if ((ul_BufferSize < API_BM_MERGE_MIN_BUFFER) || (ul_BufferSize % sizeof(AiUInt32)))
+        return API_ERR_PARAM3_NOT_IN_RANGE;
+
+    for (i = 0; i < ul_SourceCount; i++)
+    {
+        if (px_Sources[i].ul_QueueId > API_DATA_QUEUE_ID_BM_REC_BIU8)
+            return API_ERR_PARAM1_NOT_IN_RANGE;
+
+        /* Each queue can only be consumed once */
+        for (j = 0; j < i; j++)
+        {
+            if ((px_Sources[i].ul_Module == px_Sources[j].ul_Module) && (px_Sources[i].ul_QueueId == px_Sources[j].ul_QueueId))
+                return API_ERR_PARAM1_NOT_IN_RANGE;
+        }
+    }
+
+    *ppx_Merge = NULL;
+
+    px_Merge = (TY_API_BM_MERGE *)AiOsMalloc(sizeof(TY_API_BM_MERGE));
+
+    if (NULL == px_Merge)
+        return API_ERR_MALLOC_FAILED;
+
+    memset(px_Merge, 0, sizeof(TY_API_BM_MERGE));
+
+    px_Merge->ul_IdlePolls = ul_IdlePolls;
+    px_Merge->px_Src       = (TY_API_BM_MERGE_SRC *)AiOsMalloc(ul_SourceCount * sizeof(TY_API_BM_MERGE_SRC));
+    px_Merge->pul_Heap     = (AiUInt32 *)AiOsMalloc(ul_SourceCount * sizeof(AiUInt32));
+
+    if ((NULL == px_Merge->px_Src) || (NULL == px_Merge->pul_Heap))
+    {
+        v_BMMergeFree(px_Merge);
+        return API_ERR_MALLOC_FAILED;
+    }
+
+    memset(px_Merge->px_Src, 0, ul_SourceCount * sizeof(TY_API_BM_MERGE_SRC));
+    px_Merge->ul_SourceCount = ul_SourceCount;
+
+    for (i = 0; i < ul_SourceCount; i++)
+    {
+        px_Merge->px_Src[i].x_Source   = px_Sources[i];
+        px_Merge->px_Src[i].ul_RawSize = ul_BufferSize / sizeof(AiUInt32);
+        px_Merge->px_Src[i].pul_Raw    = (AiUInt32 *)AiOsMalloc(ul_BufferSize);
+
+        if (NULL == px_Merge->px_Src[i].pul_Raw)
+        {
+            v_BMMergeFree(px_Merge);
+            return API_ERR_MALLOC_FAILED;
+        }
+
+        uw_RetVal = ApiCmdDataQueueOpen(px_Sources[i].ul_Module, px_Sources[i].ul_QueueId, &ul_QueueSize);
+
+        if (uw_RetVal == API_OK)
+        {
+            /* Set before start so a failed start still closes the queue */
+            px_Merge->px_Src[i].b_Started = AiTrue;
+
+            uw_RetVal = ApiCmdDataQueueControl(px_Sources[i].ul_Module, px_Sources[i].ul_QueueId, API_DATA_QUEUE_CTRL_MODE_START);
+        }
+
+        if (uw_RetVal != API_OK)
+        {
+            v_BMMergeFree(px_Merge);
+            return uw_RetVal;
+        }
+    }
+
+    *ppx_Merge = px_Merge;
+
+    return API_OK;
+}
+
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiBMMergeRead
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Merge handle [px_Merge]
+//                API_BM_MERGE_FLUSH or 0 [ul_Flags]
+//                Output array and its size [px_Msgs, ul_MaxMsgs]
+//
+//    Outputs   : Number of merged messages [pul_MsgCount]
+//                Instruction execution status [status]
+//
+//    Description :
+//    This function returns the next messages of the merged stream in time
+//    tag order. Each data queue is read at most once per call. Sources are
+//    kept in a min heap keyed by the time tag of their oldest decoded message,
+//    so every message costs O(log n) for n sources.
+//
+//***************************************************************************
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeRead(TY_API_BM_MERGE *px_Merge, AiUInt32 ul_Flags, TY_API_BM_MERGE_MSG *px_Msgs,
+                                                 AiUInt32 ul_MaxMsgs, AiUInt32 *pul_MsgCount)
+{
+    TY_API_BM_MERGE_SRC *px_Src;
+    AiUInt32 ul_Count = 0;
+    AiUInt32 ul_Source;
+    AiReturn uw_RetVal = API_OK;
+    AiUInt32 i;
+
+    if (NULL == px_Merge)
+        return API_ERR_PARAM1_IS_NULL;
+
+    if ((NULL == px_Msgs) && (ul_MaxMsgs > 0))
+        return API_ERR_PARAM3_IS_NULL;
+
+    if (NULL == pul_MsgCount)
+        return API_ERR_PARAM5_IS_NULL;
+
+    for (i = 0; i < px_Merge->ul_SourceCount; i++)
+        px_Merge->px_Src[i].b_Polled = AiFalse;
+
+    /* Sources which ran out of decoded messages are not in the heap */
+    for (i = 0; i < px_Merge->ul_SourceCount; i++)
+    {
+        px_Src = &px_Merge->px_Src[i];
+
+        if (px_Src->ul_MsgPos < px_Src->ul_MsgCount)
+            continue;
+
+        uw_RetVal = uw_BMMergeFill(px_Src, ul_Flags);
+
+        if (uw_RetVal != API_OK)
+            break;
+
+        if (px_Src->ul_MsgPos < px_Src->ul_MsgCount)
+            v_BMMergeHeapPush(px_Merge, i);
+    }
+
+    while ((uw_RetVal == API_OK) && (ul_Count < ul_MaxMsgs) && (px_Merge->ul_HeapCount > 0))
+    {
+        /* A source without data may still deliver older messages, unless it is idle */
+        if (!(ul_Flags & API_BM_MERGE_FLUSH) && (px_Merge->ul_HeapCount < px_Merge->ul_SourceCount))
+        {
+            for (i = 0; i < px_Merge->ul_SourceCount; i++)
+            {
+                px_Src = &px_Merge->px_Src[i];
+
+                if ((px_Src->ul_MsgPos == px_Src->ul_MsgCount) && (px_Src->ul_IdleCount < px_Merge->ul_IdlePolls))
+                    break;
+            }
+
+            if (i < px_Merge->ul_SourceCount)
+                break;
+        }
+
+        ul_Source = px_Merge->pul_Heap[0];
+        px_Src    = &px_Merge->px_Src[ul_Source];
+
+        px_Msgs[ul_Count].ul_Source = ul_Source;
+        px_Msgs[ul_Count].x_Msg     = px_Src->ax_Msgs[px_Src->ul_MsgPos];
+        ul_Count++;
+
+        px_Src->ul_MsgPos++;
+
+        if (px_Src->ul_MsgPos == px_Src->ul_MsgCount)
+            uw_RetVal = uw_BMMergeFill(px_Src, ul_Flags);
+
+        if (px_Src->ul_MsgPos < px_Src->ul_MsgCount)
+        {
+            v_BMMergeHeapSiftDown(px_Merge, ul_Source);
+        }
+        else
+        {
+            /* Remove the source from the heap */
+            px_Merge->ul_HeapCount--;
+
+            if (px_Merge->ul_HeapCount > 0)
+                v_BMMergeHeapSiftDown(px_Merge, px_Merge->pul_Heap[px_Merge->ul_HeapCount]);
+        }
+    }
+
+    *pul_MsgCount = ul_Count;
+
+    return uw_RetVal;
+}
+
+
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiBMMergeDelete
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Merge handle [px_Merge]
+//
+//    Outputs   : Instruction execution status [status]
+//
+//    Description :
+//    This function stops and closes the data queues of a merged stream and
+//    releases the handle. Messages not read yet are discarded.
+//
+//***************************************************************************
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiBMMergeDelete(TY_API_BM_MERGE *px_Merge)
+{
+    if (NULL == px_Merge)
+        return API_ERR_PARAM1_IS_NULL;
+
+    v_BMMergeFree(px_Merge);
+
+    return API_OK;
+}
@@ -996,18 +996,13 @@ AiReturn ApiCmdRTDytagDef_(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con, AiUInt16
     return ul_RetVal;
 }
 
-AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDef(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
-                                                   AiUInt16 rt_hid, AiUInt16 mode,
-                                                   TY_API_RT_DYTAG rt_dytag[4])
+// Parameter check shared by ApiCmdRTDytagDef and ApiCmdRTDytagDefList
+static AiReturn ul_RTDytagDefCheck(AiUInt8 con, AiUInt16 rt_hid, AiUInt16 mode, TY_API_RT_DYTAG rt_dytag[4])
 {
     AiUInt32 i;
     AiReturn ul_RetVal = API_OK;
 
-    if( (bModule & API_MODULE_MASK) >= MAX_API_MODULE )
-        ul_RetVal = API_ERR_WRONG_MODULE;
-    else if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
-        ul_RetVal = API_ERR_WRONG_BIU;
-    else if( con > API_ENA )
+    if( con > API_ENA )
         ul_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
     else if( (rt_hid < MIN_HEADER_ID) || (rt_hid > MAX_HEADER_ID) )
         ul_RetVal = API_ERR_PARAM4_NOT_IN_RANGE;
@@ -1049,6 +1044,23 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDef(AiUInt32 bModule, AiUInt8 biu
         }
     }
 
+    return ul_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDef(AiUInt32 bModule, AiUInt8 biu, AiUInt8 con,
+                                                   AiUInt16 rt_hid, AiUInt16 mode,
+                                                   TY_API_RT_DYTAG rt_dytag[4])
+{
+    AiUInt32 i;
+    AiReturn ul_RetVal = API_OK;
+
+    if( (bModule & API_MODULE_MASK) >= MAX_API_MODULE )
+        ul_RetVal = API_ERR_WRONG_MODULE;
+    else if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        ul_RetVal = API_ERR_WRONG_BIU;
+    else
+        ul_RetVal = ul_RTDytagDefCheck(con, rt_hid, mode, rt_dytag);
+
     if( API_OK == ul_RetVal )
     {
     	ul_RetVal = ApiCmdRTDytagDef_(bModule, biu, con, rt_hid, mode, rt_dytag);
@@ -1078,6 +1090,105 @@ AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDef(AiUInt32 bModule, AiUInt8 biu
     return ul_RetVal;
 }
 
+//***************************************************************************
+//
+//   Module : APC_API                  Submodule : ApiCmdRTDytagDefList
+//
+//---------------------------------------------------------------------------
+//    Descriptions
+//    ------------
+//    Inputs    : Number of definitions [count],
+//                RT Dynamic Tagging definitions [pdefs]
+//
+//    Outputs   : Instruction execution status [ul_RetVal]
+//
+//    Description :
+//    This function applies a list of RT dynamic tagging definitions, one per
+//    buffer header, with as few commands as possible. Every definition is
+//    checked like with ApiCmdRTDytagDef before the first one is sent.
+//
+//***************************************************************************
+
+AiReturn ApiCmdRTDytagDefList_(AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_RT_DYTAG_DEF *pdefs)
+{
+    TY_MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT xInput;
+    TY_MIL_COM_ACK                        xOutput;
+    AiUInt32 ulDone, ulCount, i, j;
+    AiReturn ul_RetVal = API_OK;
+
+    for( ulDone = 0; ulDone < count; ulDone += ulCount )
+    {
+        ulCount = count - ulDone;
+
+        if( ulCount > MIL_COM_LS_RT_DYTAG_DEF_LIST_MAX )
+            ulCount = MIL_COM_LS_RT_DYTAG_DEF_LIST_MAX;
+
+        xInput.cnt = ulCount;
+
+        for( i = 0; i < ulCount; i++ )
+        {
+            xInput.entry[i].rt_hid = pdefs[ulDone + i].rt_hid;
+            xInput.entry[i].con    = pdefs[ulDone + i].con;
+            xInput.entry[i].mode   = pdefs[ulDone + i].mode;
+
+            for( j = 0; j < 4; j++ )
+            {
+                xInput.entry[i].tag_fct[j] = pdefs[ulDone + i].dytag[j].tag_fct;
+                xInput.entry[i].min[j]     = pdefs[ulDone + i].dytag[j].min;
+                xInput.entry[i].max[j]     = pdefs[ulDone + i].dytag[j].max;
+                xInput.entry[i].wpos[j]    = pdefs[ulDone + i].dytag[j].wpos;
+                xInput.entry[i].step[j]    = pdefs[ulDone + i].dytag[j].step;
+            }
+        }
+
+        MIL_COM_INIT( &xInput.cmd, API_STREAM(bModule), 0, MIL_COM_LS_RT_DYTAG_DEF_LIST,
+                      MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE + ulCount * sizeof(TY_MIL_COM_LS_RT_DYTAG_DEF_ENTRY), sizeof(xOutput) );
+
+        ul_RetVal = API_CMD_STRUCT_RT_DYTAG_DEF_LIST(bModule, &xInput, &xOutput);
+
+        if( API_OK != ul_RetVal )
+            break;
+    }
+
+    return ul_RetVal;
+}
+
+AI_LIB_FUNC AiReturn AI_CALL_CONV ApiCmdRTDytagDefList(AiUInt32 bModule, AiUInt8 biu, AiUInt32 count, TY_API_RT_DYTAG_DEF *pdefs)
+{
+    AiUInt32 i;
+    AiReturn ul_RetVal = API_OK;
+
+    if( (bModule & API_MODULE_MASK) >= MAX_API_MODULE )
+        ul_RetVal = API_ERR_WRONG_MODULE;
+    else if( (0 == (bModule & API_STREAM_MASK)) && ((biu < MIN_BIU) || (biu > MAX_BIU)) )
+        ul_RetVal = API_ERR_WRONG_BIU;
+    else if( 0 == count )
+        ul_RetVal = API_ERR_PARAM3_NOT_IN_RANGE;
+    else if( NULL == pdefs )
+        ul_RetVal = API_ERR_PARAM4_IS_NULL;
+
+    for( i = 0; (i < count) && (API_OK == ul_RetVal); i++ )
+        ul_RetVal = ul_RTDytagDefCheck(pdefs[i].con, pdefs[i].rt_hid, pdefs[i].mode, pdefs[i].dytag);
+
+    if( API_OK == ul_RetVal )
+    {
+    	ul_RetVal = ApiCmdRTDytagDefList_(bModule, biu, count, pdefs);
+    }
+
+    v_ExamineRetVal( "ApiCmdRTDytagDefList", ul_RetVal );
+    TRACE_BEGIN
+    TRACE("        TY_API_RT_DYTAG_DEF defs[...];\n");
+    TRACE_FCTA("ApiCmdRTDytagDefList", ul_RetVal); 
+    TRACE_PARA(bModule);
+    TRACE_PARA(biu);
+    TRACE_PARA(count);
+    TRACE_RPARE("defs");
+    TRACE_FCTE;
+    TRACE_END
+
+    return ul_RetVal;
+}
+
 //***************************************************************************
 //
 //   Module : APC_API                  Submodule : ApiCmdRTStart
@@ -536,6 +536,72 @@ AiInt16 _ApiOsWriteMemData(AiUInt32 ui_ModuleHandle, AiUInt8 memtype, AiUInt32 o
 
 
 
+//**************************************************************************
+//
+// _ApiOsMapMemory
+//
+//**************************************************************************
+static size_t _ApiOsMapSize(AiUInt32 size)
+{
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    return ((size + page_size - 1) / page_size) * page_size;
+}
+
+AiInt16 _ApiOsMapMemory(AiUInt32 ui_ModuleHandle, AiUInt8 memtype, AiUInt32 size, void** ppv_Memory)
+{
+    TY_DEVICE_INFO* p_Device = NULL;
+    int i_DeviceFileDescriptor;
+    void* pv_Memory;
+
+    p_Device = _ApiGetDeviceInfoPtrByModule(ui_ModuleHandle);
+    if (!p_Device)
+    {
+        return API_ERR_WRONG_MODULE;
+    }
+
+    if (p_Device->_hDrv == INVALID_HANDLE_VALUE)
+    {
+        return API_ERR;
+    }
+
+    i_DeviceFileDescriptor = fileno((FILE*) p_Device->_hDrv);
+    if (i_DeviceFileDescriptor == -1)
+    {
+        perror(__FUNCTION__);
+        return API_ERR;
+    }
+
+    /* The driver selects the memory type by the page offset and always maps from its start */
+    pv_Memory = mmap(NULL, _ApiOsMapSize(size), PROT_READ | PROT_WRITE, MAP_SHARED,
+                     i_DeviceFileDescriptor, AI_MMAP_OFFSET((off_t)memtype));
+
+    if (pv_Memory == MAP_FAILED)
+    {
+        DEBUGOUT(DBG_ERROR, __FUNCTION__, strerror(errno));
+        return API_ERR_PLATTFORM_NOT_SUPPORTED;
+    }
+
+    *ppv_Memory = pv_Memory;
+
+    return API_OK;
+}
+
+//**************************************************************************
+//
+// _ApiOsUnmapMemory
+//
+//**************************************************************************
+void _ApiOsUnmapMemory(void* pv_Memory, AiUInt32 size)
+{
+    if (pv_Memory)
+    {
+        munmap(pv_Memory, _ApiOsMapSize(size));
+    }
+}
+
+
+
 //**************************************************************************
 //
 //   Module : AIM_MIL_io.cpp           Submodule : _ApiLinuxGetSysDrvVersion
@@ -668,38 +734,21 @@ exit_err:
     return NULL;
 }
 
-static int mil_nl_receive_callback(struct nl_msg *msg, void *args)
+/*! \brief Dispatches one interrupt loglist entry to the installed user handler
+ *
+ * @param device the device the event was received for
+ * @param event the interrupt loglist entry to dispatch
+ * @return 0 on success, -1 if event is invalid
+ */
+static int mil_nl_dispatch_event(TY_DEVICE_INFO* device, const TY_API_INTR_LOGLIST_ENTRY* event)
 {
-    AiBoolean hs;
-    int ret = 0;
     AiUInt8 hs_flag;
     AiUInt8 biu;
     AiUInt8 int_type;
     AiUInt32 ulModHandle;
-    TY_DEVICE_INFO* device = (TY_DEVICE_INFO*) args;
-    struct nlmsghdr *nlh = nlmsg_hdr(msg);
-    struct nlattr *attrs[AIM_MIL_NL_A_MAX + 1];
-    char dbg_msg[128];
-    AiUInt32 channel_index = 0;
     TY_INT_FUNC_PTR user_handler = NULL;
     TY_API_INTR_LOGLIST_ENTRY notification_data = {0};
 
-    TY_API_INTR_LOGLIST_ENTRY* event;
-    struct genlmsghdr* genlHeader = NULL;
-    static struct nla_policy aim_mil_nl_policy[AIM_MIL_NL_A_MAX + 1];
-
-    aim_mil_nl_policy[AIM_MIL_NL_A_LOGLIST_ENTRY].type = NLA_UNSPEC;
-    aim_mil_nl_policy[AIM_MIL_NL_A_LOGLIST_ENTRY].minlen = sizeof(TY_API_INTR_LOGLIST_ENTRY);
-
-    ret = genlmsg_parse( nlh, 0, attrs, AIM_MIL_NL_A_MAX, aim_mil_nl_policy);
-    if(ret)
-    {
-        DEBUGOUT(DBG_ERROR, __FUNCTION__, "Failed to parse netlink message");
-        return NL_STOP;
-    }
-
-    event = (struct ty_api_intr_loglist_entry*) nla_data(attrs[AIM_MIL_NL_A_LOGLIST_ENTRY]);
-
     if( event->x_Lld.t.uc_IntSrc < ucMaxInterruptSouce )
         biu = aucTranslateInterrupSourceToBiu[event->x_Lld.t.uc_IntSrc];
     else
@@ -741,6 +790,50 @@ static int mil_nl_receive_callback(struct nl_msg *msg, void *args)
     return 0;
 }
 
+static int mil_nl_receive_callback(struct nl_msg *msg, void *args)
+{
+    int ret = 0;
+    TY_DEVICE_INFO* device = (TY_DEVICE_INFO*) args;
+    struct nlmsghdr *nlh = nlmsg_hdr(msg);
+    struct nlattr *attrs[AIM_MIL_NL_A_MAX + 1];
+    AiUInt32 num_events = 0;
+    AiUInt32 num_invalid = 0;
+    AiUInt32 i = 0;
+
+    TY_API_INTR_LOGLIST_ENTRY* event;
+    static struct nla_policy aim_mil_nl_policy[AIM_MIL_NL_A_MAX + 1];
+
+    aim_mil_nl_policy[AIM_MIL_NL_A_LOGLIST_ENTRY].type = NLA_UNSPEC;
+    aim_mil_nl_policy[AIM_MIL_NL_A_LOGLIST_ENTRY].minlen = sizeof(TY_API_INTR_LOGLIST_ENTRY);
+
+    ret = genlmsg_parse( nlh, 0, attrs, AIM_MIL_NL_A_MAX, aim_mil_nl_policy);
+    if(ret)
+    {
+        DEBUGOUT(DBG_ERROR, __FUNCTION__, "Failed to parse netlink message");
+        return NL_STOP;
+    }
+
+    /* The attribute may hold a batch of consecutive loglist entries */
+    event = (struct ty_api_intr_loglist_entry*) nla_data(attrs[AIM_MIL_NL_A_LOGLIST_ENTRY]);
+    num_events = nla_len(attrs[AIM_MIL_NL_A_LOGLIST_ENTRY]) / sizeof(TY_API_INTR_LOGLIST_ENTRY);
+
+    /* An invalid entry must not drop the valid entries behind it */
+    for(i = 0; i < num_events; i++)
+    {
+        if(mil_nl_dispatch_event(device, &event[i]))
+        {
+            num_invalid++;
+        }
+    }
+
+    if(num_invalid)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
 
 static void mil_event_notification_cleanup(void* socket)
 {
@@ -71,6 +71,21 @@ AiInt16 _ApiOsReadMemData(AiUInt32 ui_ModuleHandle, AiUInt8 memtype, AiUInt32 of
 AiInt16 _ApiOsWriteMemData(AiUInt32 ui_ModuleHandle, AiUInt8 memtype, AiUInt32 offset, AiUInt8 width,
                                void* data_p, AiUInt32 size, AiUInt32* pul_BytesWritten);
 
+/*! \brief Maps the start of a device memory type into the address space of the process
+
+    \param ui_ModuleHandle handle to the device
+    \param memtype memory type to map
+    \param size number of bytes to map, rounded up to full pages
+    \param ppv_Memory returns the start of the mapping
+    \return returns 0 on success, API_ERR_PLATTFORM_NOT_SUPPORTED if the driver can not map the memory */
+AiInt16 _ApiOsMapMemory(AiUInt32 ui_ModuleHandle, AiUInt8 memtype, AiUInt32 size, void** ppv_Memory);
+
+/*! \brief Releases a mapping created with _ApiOsMapMemory
+
+    \param pv_Memory start of the mapping
+    \param size size that was passed to _ApiOsMapMemory */
+void _ApiOsUnmapMemory(void* pv_Memory, AiUInt32 size);
+
 /*! \brief This function sets device specific driver flags.
 
     e.g. interrupts of the device can be enabled/disabled
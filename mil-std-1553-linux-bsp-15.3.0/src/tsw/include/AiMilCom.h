@@ -84,6 +84,7 @@ command & MIL_COM_GROUP_HS_MASK => Used to detect if command is HS requires HS b
 #define MIL_COM_BM_OFFSET            0x04000000
 #define MIL_COM_BM_LS_OFFSET         0x04000000 /* See AiMilComLsBm.h for LS BM command definitions */
 #define MIL_COM_BM_LS_DQUEUE_OFFSET  0x04010000 /* See AiMilComLsBm.h for EF BM command definitions */
+#define MIL_COM_BM_LS_STAT_OFFSET    0x04020000 /* See AiMilComLsBm.h for LS BM statistics command definitions */
 #define MIL_COM_BM_HS_OFFSET         0x04800000 /* See AiMilComHsBm.h for HS BM command definitions */
 #define MIL_COM_BM_EF_OFFSET         0x04810000 /* See AiMilComEfBm.h for EF BM command definitions */
 
@@ -40,6 +40,15 @@
 #define MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER      MIL_COM_BC_LS_OFFSET  + 26
 #define MIL_COM_LS_BC_TRAFFIC_OVERRIDE_CONTROL        MIL_COM_BC_LS_OFFSET  + 27
 #define MIL_COM_LS_BC_TRAFFIC_OVERRIDE_GET            MIL_COM_BC_LS_OFFSET  + 28
+#define MIL_COM_LS_BC_XFER_READ_BULK                  MIL_COM_BC_LS_OFFSET  + 29
+#define MIL_COM_LS_BC_ACYC_QUEUE                      MIL_COM_BC_LS_OFFSET  + 30
+#define MIL_COM_LS_BC_ACYC_QUEUE_STATUS               MIL_COM_BC_LS_OFFSET  + 31
+#define MIL_COM_LS_BC_SETUP_BULK                      MIL_COM_BC_LS_OFFSET  + 32
+#define MIL_COM_LS_BC_FRAME_SWAP                      MIL_COM_BC_LS_OFFSET  + 33
+#define MIL_COM_LS_BC_MODIFY_DEF_LIST                 MIL_COM_BC_LS_OFFSET  + 34
+#define MIL_COM_LS_BC_TIMING_CONTROL                  MIL_COM_BC_LS_OFFSET  + 35
+#define MIL_COM_LS_BC_STATUS_TIMING_READ              MIL_COM_BC_LS_OFFSET  + 36
+#define MIL_COM_LS_BC_DYTAG_DEF_LIST                  MIL_COM_BC_LS_OFFSET  + 37
 
 
 
@@ -322,6 +331,32 @@ typedef struct
     AiUInt32        wpos[4];
 }TY_MIL_COM_LS_BC_DYTAG_DEF_INPUT;
 
+/* -- MIL_COM_LS_BC_DYTAG_DEF_LIST -- */
+
+/* Maximum number of buffer header definitions in one list */
+#define MIL_COM_LS_BC_DYTAG_DEF_LIST_MAX 32
+
+#define MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + sizeof(AiUInt32))
+
+typedef struct
+{
+    AiUInt32        con;
+    AiUInt32        bc_hid;
+    AiUInt32        mode;
+    AiUInt32        tag_fct[4];
+    AiUInt32        min[4];
+    AiUInt32        max[4];
+    AiUInt32        step[4];
+    AiUInt32        wpos[4];
+}TY_MIL_COM_LS_BC_DYTAG_DEF_ENTRY;
+
+typedef struct
+{
+    TY_MIL_COM                       cmd;
+    AiUInt32                         cnt;
+    TY_MIL_COM_LS_BC_DYTAG_DEF_ENTRY entry[MIL_COM_LS_BC_DYTAG_DEF_LIST_MAX];
+}TY_MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT;
+
 /* -- MIL_COM_LS_BC_DYTAG_DEF_GET -- */
 typedef struct
 {
@@ -418,6 +453,43 @@ typedef struct
 } TY_MIL_COM_LS_BC_XFER_READ_OUTPUT;
 
 
+/* -- MIL_COM_LS_BC_XFER_READ_BULK -- */
+
+/* Maximum number of transfers in one bulk read */
+#define MIL_COM_LS_BC_XFER_READ_BULK_MAX 500
+
+#define MIL_COM_LS_BC_XFER_READ_BULK_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + 3 * sizeof(AiUInt32))
+
+typedef struct
+{
+    TY_MIL_COM      cmd;
+    AiUInt32        xid_first; /* first ID of a range or 0 to read the IDs given in xid */
+    AiUInt32        count;
+    AiUInt32        clr;
+    AiUInt32        xid[MIL_COM_LS_BC_XFER_READ_BULK_MAX];
+}TY_MIL_COM_LS_BC_XFER_READ_BULK_INPUT;
+
+typedef struct
+{
+    AiUInt32 msg_cnt;
+    AiUInt32 err_cnt;
+    AiUInt32 st2_st1;  /* last status words */
+    AiUInt32 brw_bid;  /* buffer report word and current buffer ID */
+    AiUInt32 ttag;
+} TY_MIL_COM_LS_BC_XFER_STATE;
+
+typedef struct
+{
+    TY_MIL_COM_ACK              xAck;
+    AiUInt32                    count;
+    TY_MIL_COM_LS_BC_XFER_STATE xfer[MIL_COM_LS_BC_XFER_READ_BULK_MAX];
+} TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT;
+
+/* Acknowledge size of a bulk read with the given number of transfers */
+#define MIL_COM_LS_BC_XFER_READ_BULK_ACK_SIZE(count) \
+    (sizeof(TY_MIL_COM_ACK) + sizeof(AiUInt32) + (count) * sizeof(TY_MIL_COM_LS_BC_XFER_STATE))
+
+
 /* -- MIL_COM_LS_BC_SRVW_REQ_READ -- */
 typedef struct
 {
@@ -489,6 +561,88 @@ typedef struct
 } TY_MIL_COM_LS_BC_MODIFY_DEF_OUTPUT;
 
 
+/* -- MIL_COM_LS_BC_MODIFY_DEF_LIST -- */
+
+/* Maximum number of modify descriptors in one list */
+#define MIL_COM_LS_BC_MODIFY_DEF_LIST_MAX 64
+
+#define MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + 2 * sizeof(AiUInt32))
+
+typedef struct
+{
+    AiUInt32                     id;
+    TY_API_BC_MODIFY_INSTRUCTION modify;
+}TY_MIL_COM_LS_BC_MODIFY_DEF_ENTRY;
+
+typedef struct
+{
+    TY_MIL_COM                        cmd;
+    AiUInt32                          mode;
+    AiUInt32                          cnt;
+    TY_MIL_COM_LS_BC_MODIFY_DEF_ENTRY entry[MIL_COM_LS_BC_MODIFY_DEF_LIST_MAX];
+}TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT;
+
+
+typedef struct
+{
+    TY_MIL_COM_ACK  xAck;
+    AiUInt32        offset[MIL_COM_LS_BC_MODIFY_DEF_LIST_MAX];
+} TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_OUTPUT;
+
+
+/* -- MIL_COM_LS_BC_TIMING_CONTROL -- */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     con;
+    AiUInt32     tolerance; /* overrun tolerance in us, applied on enable */
+} TY_MIL_COM_LS_BC_TIMING_CONTROL_INPUT;
+
+
+/* -- MIL_COM_LS_BC_STATUS_TIMING_READ -- */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     xid_first;
+    AiUInt32     xid_count; /* max MIL_COM_LS_BC_TIMING_MAX_XFER */
+} TY_MIL_COM_LS_BC_STATUS_TIMING_READ_INPUT;
+
+
+typedef struct
+{
+    AiUInt32 count;
+    AiUInt32 min;
+    AiUInt32 max;
+    AiUInt32 mean;
+} TY_MIL_COM_LS_BC_TIMING_TIME;
+
+
+typedef struct
+{
+    TY_MIL_COM_ACK               xAck;
+    AiUInt32                     status;        /* same as MIL_COM_LS_BC_STATUS_READ */
+    AiUInt32                     hxfer;
+    AiUInt32                     bc_mc;
+    AiUInt32                     bc_ec;
+    AiUInt32                     mfc;
+    AiUInt32                     hip;
+    AiUInt32                     ftime;         /* programmed minor frame time in us */
+    AiUInt32                     frame_overrun; /* minor frames started later than ftime plus tolerance after the previous one */
+    TY_MIL_COM_LS_BC_TIMING_TIME interval;      /* minor frame start to start in us */
+    AiUInt32                     count;         /* number of transfer entries (xid_count) */
+    AiUInt32                     data[1];       /* count x (count, min, max, mean offset from minor frame start in us, overrun) */
+} TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT;
+
+/* Maximum number of transfers in one timing read */
+#define MIL_COM_LS_BC_TIMING_MAX_XFER 256
+
+/* Acknowledge size of a timing read with the given number of transfer entries */
+#define MIL_COM_LS_BC_STATUS_TIMING_READ_ACK_SIZE(count) \
+    (sizeof(TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT) - sizeof(AiUInt32) + (count) * 5 * sizeof(AiUInt32))
+
+
 /* -- MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER -- */
 typedef struct
 {
@@ -507,4 +661,102 @@ typedef struct
 } MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER_OUTPUT;
 
 
+/* -- MIL_COM_LS_BC_ACYC_QUEUE -- */
+
+/* Maximum number of instructions in one queued acyclic burst */
+#define MIL_COM_LS_BC_ACYC_QUEUE_MAX 30
+
+#define MIL_COM_LS_BC_ACYC_QUEUE_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + sizeof(AiUInt32))
+
+typedef struct
+{
+    TY_MIL_COM        cmd;
+    AiUInt32          xfer_cnt;
+    TY_BC_INSTRUCTION data[MIL_COM_LS_BC_ACYC_QUEUE_MAX];
+}TY_MIL_COM_LS_BC_ACYC_QUEUE_INPUT;
+
+
+/* -- MIL_COM_LS_BC_ACYC_QUEUE / MIL_COM_LS_BC_ACYC_QUEUE_STATUS -- */
+typedef struct
+{
+    TY_MIL_COM_ACK  xAck;
+    AiUInt32        pending;  /* queued bursts not yet started */
+    AiUInt32        running;  /* 1 if a queued burst is executed */
+    AiUInt32        free;     /* bursts that can be queued */
+    AiUInt32        done;     /* bursts completed since BC init/halt */
+} TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT;
+
+
+/* -- MIL_COM_LS_BC_SETUP_BULK -- */
+
+/* Buffer header entry, fields as in TY_MIL_COM_LS_BC_BH_DEF_INPUT */
+typedef struct
+{
+    AiUInt32        hid;
+    AiUInt32        bid;
+    AiUInt32        sid;
+    AiUInt32        eid;
+    AiUInt32        qsize;
+    AiUInt32        bqm;
+    AiUInt32        bsm;
+    AiUInt32        sqm;
+    AiUInt32        eqm;
+    AiUInt32        dbm;
+}TY_MIL_COM_LS_BC_BULK_BH;
+
+/* Transfer entry, fields as in TY_MIL_COM_LS_BC_XFER_DEF_INPUT */
+typedef struct
+{
+    AiUInt32        xid;
+    AiUInt32        hid;
+    AiUInt32        xfer_type;
+    AiUInt32        chn;
+    AiUInt32        xmt_rt;
+    AiUInt32        rcv_rt;
+    AiUInt32        xmt_sa;
+    AiUInt32        rcv_sa;
+    AiUInt32        wcnt;
+    AiUInt32        xfer_ir;
+    AiUInt32        xfer_hlt;
+    AiUInt32        rte;
+    AiUInt32        sxh;
+    AiUInt32        rsp;
+    AiUInt32        res;
+    AiUInt32        swxm;
+    AiUInt32        err_type;
+    AiUInt32        err_wpos;
+    AiUInt32        err_bpos;
+    AiUInt32        err_sync;
+    AiUInt32        err_contig;
+    AiUInt32        err_bc_bits;
+    AiUInt32        delay_mode;
+    AiUInt32        gap;
+}TY_MIL_COM_LS_BC_BULK_XFER;
+
+/* Minor frame entry, followed by xfer_cnt instructions */
+typedef struct
+{
+    AiUInt32          frame_id;
+    AiUInt32          xfer_cnt;
+    TY_BC_INSTRUCTION data[1];
+}TY_MIL_COM_LS_BC_BULK_FRAME;
+
+#define MIL_COM_LS_BC_BULK_FRAME_SIZE(xfer_cnt) (2 * sizeof(AiUInt32) + (xfer_cnt) * sizeof(TY_BC_INSTRUCTION))
+
+#define MIL_COM_LS_BC_SETUP_BULK_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + 4 * sizeof(AiUInt32))
+
+/* data holds bh_cnt buffer headers, xfer_cnt transfers, frame_cnt
+   minor frames and mframe_cnt minor frame ids, in this order.
+   A mframe_cnt of 0 leaves the major frame unchanged. */
+typedef struct
+{
+    TY_MIL_COM        cmd;
+    AiUInt32          bh_cnt;
+    AiUInt32          xfer_cnt;
+    AiUInt32          frame_cnt;
+    AiUInt32          mframe_cnt;
+    AiUInt32          data[1];
+}TY_MIL_COM_LS_BC_SETUP_BULK_INPUT;
+
+
 #endif /* __MIL_COM_LS_BC_H__ */
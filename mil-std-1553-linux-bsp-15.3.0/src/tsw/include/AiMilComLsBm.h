@@ -36,6 +36,8 @@
 #define MIL_COM_LS_BM_MSG_REC_FLT      MIL_COM_BM_LS_OFFSET + 22
 #define MIL_COM_LS_BM_DYNTAG_MON_DEF   MIL_COM_BM_LS_OFFSET + 23
 #define MIL_COM_LS_BM_DYNTAG_MON_READ  MIL_COM_BM_LS_OFFSET + 24
+#define MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT MIL_COM_BM_LS_OFFSET + 25
+#define MIL_COM_LS_BM_DYNTAG_MON_READ_BULK MIL_COM_BM_LS_OFFSET + 26
 
 
 /* -- Data Queue commands --- */
@@ -44,6 +46,11 @@
 #define MIL_COM_LS_BM_DATAQUEUE_CLOSE   MIL_COM_BM_LS_DQUEUE_OFFSET + 2
 
 
+/* -- Bus statistics commands --- */
+#define MIL_COM_LS_BM_STAT_CONTROL      MIL_COM_BM_LS_STAT_OFFSET + 0
+#define MIL_COM_LS_BM_STAT_READ         MIL_COM_BM_LS_STAT_OFFSET + 1
+
+
 
 
 /*****************************************************************************/
@@ -363,6 +370,30 @@ typedef struct
 } TY_MIL_COM_LS_BM_RT_SA_ACT_READ_OUTPUT;
 
 
+/* MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     rt_first;
+    AiUInt32     rt_count;
+    AiUInt32     sa_type;
+} TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_INPUT;
+
+
+
+typedef struct
+{
+    TY_MIL_COM_ACK xAck;
+    AiUInt32 count;   /* number of RT/SA entries (rt_count * 32) */
+    AiUInt32 data[1]; /* count x (cc,ec) followed by count/2 lwords with two 16 bit et values each */
+} TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT;
+
+/* Acknowledge size of a snapshot with the given number of RT/SA entries */
+#define MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_ACK_SIZE(count) \
+    (sizeof(TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT) - sizeof(AiUInt32) + ((count) * 2 + (count) / 2) * sizeof(AiUInt32))
+
+
 
 /* MIL_COM_LS_BM_INI_MSG_REC_FLT */
 
@@ -434,6 +465,40 @@ typedef struct
 } TY_MIL_COM_LS_BM_DYNTAG_MON_READ_OUTPUT;
 
 
+/* MIL_COM_LS_BM_DYNTAG_MON_READ_BULK */
+
+/* Maximum number of dytag monitors in one bulk read */
+#define MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_MAX 64
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     id_first; /* first ID of a range or 0 to read the IDs given in id */
+    AiUInt32     count;
+    AiUInt32     id[MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_MAX];
+} TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_INPUT;
+
+
+typedef struct
+{
+    AiUInt32 stale_cnt;
+    AiUInt32 bad_cnt;
+    AiUInt32 good_cnt;
+} TY_MIL_COM_LS_BM_DYNTAG_MON_STATE;
+
+
+typedef struct
+{
+    TY_MIL_COM_ACK xAck;
+    AiUInt32 count;
+    TY_MIL_COM_LS_BM_DYNTAG_MON_STATE state[MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_MAX];
+} TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_OUTPUT;
+
+/* Acknowledge size of a bulk read with the given number of monitors */
+#define MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_ACK_SIZE(count) \
+    (sizeof(TY_MIL_COM_ACK) + sizeof(AiUInt32) + (count) * sizeof(TY_MIL_COM_LS_BM_DYNTAG_MON_STATE))
+
+
 
 
 /*****************************************************************************/
@@ -482,5 +547,70 @@ typedef struct
 } TY_MIL_COM_LS_BM_DATAQUEUE_CONTROL_INPUT;
 
 
+/* MIL_COM_LS_BM_DATAQUEUE_CONTROL with mode API_DATA_QUEUE_CTRL_FILTER */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     id;
+    AiUInt32     mode;
+    AiUInt32     enable;
+    AiUInt32     rt_mask;
+    AiUInt32     rx_sa_mask;
+    AiUInt32     tx_sa_mask;
+    AiUInt32     error_mask;
+} TY_MIL_COM_LS_BM_DATAQUEUE_FILTER_INPUT;
+
+
+
+/* MIL_COM_LS_BM_STAT_CONTROL */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     con;  /* 0=disable, 1=enable, 2=reset */
+} TY_MIL_COM_LS_BM_STAT_CONTROL_INPUT;
+
+
+/* MIL_COM_LS_BM_STAT_READ */
+
+typedef struct
+{
+    TY_MIL_COM   cmd;
+    AiUInt32     rt_first;
+    AiUInt32     rt_count; /* max MIL_COM_LS_BM_STAT_MAX_RT */
+} TY_MIL_COM_LS_BM_STAT_READ_INPUT;
+
+
+typedef struct
+{
+    AiUInt32 count;
+    AiUInt32 min;
+    AiUInt32 max;
+    AiUInt32 mean;
+} TY_MIL_COM_LS_BM_STAT_TIME;
+
+
+typedef struct
+{
+    TY_MIL_COM_ACK             xAck;
+    AiUInt32                   msg_cnt;
+    AiUInt32                   err_cnt;
+    AiUInt32                   err_hist[16];  /* messages per error word bit */
+    TY_MIL_COM_LS_BM_STAT_TIME gap;           /* intermessage gap in 0.25us */
+    TY_MIL_COM_LS_BM_STAT_TIME interval;      /* message start to start in us */
+    TY_MIL_COM_LS_BM_STAT_TIME resp[32];      /* response time per RT in 0.25us */
+    AiUInt32                   count;         /* number of RT/SA entries (rt_count * 32) */
+    AiUInt32                   data[1];       /* count x (rcv msg, rcv err, xmt msg, xmt err) */
+} TY_MIL_COM_LS_BM_STAT_READ_OUTPUT;
+
+/* Maximum number of RTs in one statistics read */
+#define MIL_COM_LS_BM_STAT_MAX_RT 16
+
+/* Acknowledge size of a statistics read with the given number of RT/SA entries */
+#define MIL_COM_LS_BM_STAT_READ_ACK_SIZE(count) \
+    (sizeof(TY_MIL_COM_LS_BM_STAT_READ_OUTPUT) - sizeof(AiUInt32) + (count) * 4 * sizeof(AiUInt32))
+
+
 
 #endif /* __MIL_COM_LS_BC_H__ */
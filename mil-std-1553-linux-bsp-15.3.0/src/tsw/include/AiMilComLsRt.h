@@ -43,6 +43,7 @@
 #define MIL_COM_LS_RT_MODE_CTRL    MIL_COM_RT_LS_OFFSET + 22
 #define MIL_COM_LS_RT_DWC_SET      MIL_COM_RT_LS_OFFSET + 23
 #define MIL_COM_LS_RT_DWC_GET      MIL_COM_RT_LS_OFFSET + 24
+#define MIL_COM_LS_RT_DYTAG_DEF_LIST MIL_COM_RT_LS_OFFSET + 25
 
 
 
@@ -222,6 +223,31 @@ typedef struct
 } TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT;
 
 
+/* Maximum number of buffer header definitions in one list */
+#define MIL_COM_LS_RT_DYTAG_DEF_LIST_MAX 32
+
+#define MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE (sizeof(TY_MIL_COM) + sizeof(AiUInt32))
+
+typedef struct
+{
+    AiUInt32   rt_hid;
+    AiUInt32   con;
+    AiUInt32   mode;
+    AiUInt32   tag_fct[4];
+    AiUInt32   min[4];
+    AiUInt32   max[4];
+    AiUInt32   step[4];
+    AiUInt32   wpos[4];
+} TY_MIL_COM_LS_RT_DYTAG_DEF_ENTRY;
+
+typedef struct
+{
+    TY_MIL_COM                       cmd;
+    AiUInt32                         cnt;
+    TY_MIL_COM_LS_RT_DYTAG_DEF_ENTRY entry[MIL_COM_LS_RT_DYTAG_DEF_LIST_MAX];
+} TY_MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT;
+
+
 
 
 typedef struct
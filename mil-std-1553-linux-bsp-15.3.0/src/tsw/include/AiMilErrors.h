@@ -305,6 +305,8 @@
 #define API_ERR_REPLAY_NOT_AVAILABLE              0x1037
 #define API_ERR_ERROR_INJECTION_NOT_AVAILABLE     0x1038
 #define API_ERR_DWC_NOT_AVAILABLE                 0x1039
+#define API_ERR_FILE_ACCESS                       0x103A
+#define API_ERR_FILE_FORMAT                       0x103B
 
 
 
@@ -600,6 +602,8 @@ static const TY_MIL_ERR_TRANSLATE_TABLE axMilErrorDescription[] =
             {API_ERR_REPLAY_NOT_AVAILABLE               ,"Replay not available"},                                               \
             {API_ERR_ERROR_INJECTION_NOT_AVAILABLE      ,"Error injection not available"},                                      \
             {API_ERR_DWC_NOT_AVAILABLE                  ,"Defined Word Count Check not available"},                             \
+            {API_ERR_FILE_ACCESS                        ,"Failed to access file"},                                              \
+            {API_ERR_FILE_FORMAT                        ,"Invalid file format"},                                                \
                                                                                                                                 \
                                                                                                                                 \
             {API_ERR_MAXIMUM                            ,"No description available for this error code"},                       \
@@ -488,6 +488,8 @@
   #define MAX_API_BC_EQ        512   /* Event Queue */
   #define MAX_API_BC_SKIP_CNT  128   /* Skip Count */
 
+  #define API_BC_XFER_READ_BULK_SYNC_ALL 16 /* Bulk transfer read: USB mirror of all transfers is synchronized at once from this count */
+
   #define MAX_API_BC_XFER_IN_FRAME       128 /* Maximum Transfers in Minor Frame */
   #define MAX_API_BC_FRAME_IN_MFRAME     512 /* Maximum Minor Frames in Major Frame */
   #define MAX_API_BC_FRAME_IN_MFRAME_DEF 64
@@ -567,6 +569,19 @@
   #define API_BC_ACYC_SEND_TTAG           1
   #define API_BC_ACYC_RUN_AT_END_OF_FRAME 2
 
+  #define API_BC_ACYC_QUEUE_SLOTS         4 /* Acyclic burst queue: slots in the acyclic instruction list */
+  #define API_BC_ACYC_QUEUE_SLOT_SIZE     (MAX_API_BC_ACYC_INSTR / API_BC_ACYC_QUEUE_SLOTS) /* burst + SKIP + RET */
+
+  #define API_BC_MODIFY_LIST_IMMEDIATE    0
+  #define API_BC_MODIFY_LIST_MAJOR_FRAME  1
+  #define API_BC_MODIFY_LIST_MAX          64 /* Modify descriptors in one batched list */
+
+  #define API_BC_TIMING_DIS               0
+  #define API_BC_TIMING_ENA               1
+  #define API_BC_TIMING_RESET             2
+  #define API_BC_TIMING_HOUR_US           3600000000UL /* Time tags wrap after one hour */
+  #define API_BC_TIMING_TOLERANCE_MIN     1            /* Time tag resolution in us */
+
   #define API_SEND_SRVW_ON_SA0     0
   #define API_SEND_SRVW_ON_SA31    1
 
@@ -651,11 +666,29 @@
   #define API_BM_CMOD_REC         2
   #define API_BM_CMOD_MSG_FLT_REC 3
 
+  #define API_BM_MSG_FLT_MODE_INCR 0x10 /* Message filter recording: keep cursor instead of stopping BM on full output */
+  #define API_BM_MSG_FLT_MORE      2    /* Message filter recording: output full, remaining records pending */
+
   #define API_BM_STACK_STP        0
   #define API_BM_STACK_CTP        1
   #define API_BM_STACK_ETP        2
   #define API_BM_STACK_ABS        3
 
+  #define API_BM_SEARCH_TTAG      0x8000 /* Search spec: binary search by time tag */
+  #define API_BM_TTAG_PROBE_ENTRIES 40   /* Entries synchronized at once per probe */
+
+  #define API_BM_ENTRY_TTAG_LOW   2
+  #define API_BM_ENTRY_TTAG_HIGH  3
+  #define API_BM_ENTRY_ERROR      1
+  #define API_BM_ENTRY_CW1        0x8 /* bit 2 of type is the bus flag */
+  #define API_BM_ENTRY_CW2        0x9
+  #define API_BM_ENTRY_SW         0xB
+  #define API_BM_ENTRY_GAP_MASK   0x01FF0000
+
+  #define API_BM_STAT_DIS         0
+  #define API_BM_STAT_ENA         1
+  #define API_BM_STAT_RESET       2
+
   #define API_BM_TAT_DEF          10000L
   #define API_BM_SWXM_DEF         0x000007FFUL
 
@@ -708,6 +741,7 @@
   #define API_DATA_QUEUE_CTRL_STOP        1
   #define API_DATA_QUEUE_CTRL_SUSPEND     2
   #define API_DATA_QUEUE_CTRL_FLUSH       3
+  #define API_DATA_QUEUE_CTRL_FILTER      4
 
   #define API_DATA_QUEUE_STATUS_START      0x80000000
   #define API_DATA_QUEUE_STATUS_CAP_SINGLE 0x00800000
@@ -1047,6 +1081,12 @@
   #define API_SYSTAG_COMP          7
   #define API_SYSTAG_CHECKSUM      8
 
+  /* Interrupt pass a System Dynamic Data word is calculated in */
+  #define API_SYSTAG_PASS_NONE     0x00
+  #define API_SYSTAG_PASS_WORD     0x01
+  #define API_SYSTAG_PASS_COMP     0x02
+  #define API_SYSTAG_PASS_CHECKSUM 0x04
+
 /* Service Request and Vector Word handling */
   #define API_BC_SRVW_ID_NONE      0
   #define API_BC_SRVW_ID_SINGLE    1
@@ -1062,6 +1102,7 @@
   #define MAX_API_BC_SRVW_RT       32
   #define MAX_API_BC_SRVW_SAMID    128
   #define MAX_API_BC_SRVW_ID       8
+  #define API_BC_SRVW_HASH_SIZE    256 /* Duplicate filter of the service request subtable, > 2*MAX_API_BC_XFER_IN_FRAME */
 
   #define API_BC_SRVW_DIS          0x00
   #define API_BC_SRVW_ENA          0x01
@@ -1171,8 +1212,14 @@
   #define API_DATA_QUEUE_ID_BM_REC_BIU8   7
   #define API_DATA_QUEUE_ID_MIL_SCOPE     8
   #define API_DATA_QUEUE_ID_GENERIC_ACQ   9  /* Generic Data Queue Support */
+  #define API_DATA_QUEUE_ID_XFER_EVENT    10 /* BC/RT Transfer Events */
+
+  #define API_MAX_DATA_QUEUE_ID           API_DATA_QUEUE_ID_XFER_EVENT
 
-  #define API_MAX_DATA_QUEUE_ID           API_DATA_QUEUE_ID_GENERIC_ACQ
+  /* Transfer Event Queue entry: header, status words, status queue control word, time tag */
+  #define API_DATA_QUEUE_XFER_EVENT_SIZE  16
+  #define API_DATA_QUEUE_XFER_EVENT_BC    1
+  #define API_DATA_QUEUE_XFER_EVENT_RT    2
   #define API_MAX_SDP_ID                  1024
 
   #define API_SCOPE_PBI_MASK              0xF /* Board Sub Type / MilScope PBI identification */
@@ -571,6 +571,76 @@ struct ty_api_bc_acyc_ttag
   L_WORD ttag_lo;
 };
 
+struct ty_api_bc_acyc_queue
+{
+  L_WORD put;   /* queued bursts, written by command handler */
+  L_WORD get;   /* started bursts */
+  L_WORD done;  /* completed bursts, written by interrupt handler */
+  L_WORD tail[ API_BC_ACYC_QUEUE_SLOTS ]; /* PBI relative address of the SKIP instruction ending each slot */
+  struct ai_tsw_os_lock * lock;           /* serializes starting a burst between command and interrupt handler */
+};
+
+struct ty_api_bc_mframe_list
+{
+  L_WORD first;  /* start of the list in the BC instruction list area in instructions */
+  L_WORD cnt;    /* instructions in the list */
+  L_WORD jmp;    /* offset of the JMP back to the major frame start */
+  L_WORD sinst;  /* address of the Stop SKIP instruction if non-cyclic, else 0 */
+  L_WORD mod_cnt;    /* modify descriptor copies behind the list, used instead of the original descriptors */
+  L_WORD mod_first;  /* start of the copies in the BC instruction list area in instructions */
+  L_WORD mod_id[ API_BC_MODIFY_LIST_MAX ];
+};
+
+struct ty_api_bc_frame_swap
+{
+  L_WORD ena;         /* API_ON while the BC runs a list built by api_bc_program_biu */
+  L_WORD pending;     /* API_ON until the BC entered the shadow list, cleared by interrupt handler */
+  L_WORD marker;      /* PBI relative address of the SKIP instruction starting the shadow list */
+  L_WORD modify_ids;  /* highest modify descriptor id, these are located at the end of the area */
+  struct ty_api_bc_mframe_list active;
+  struct ty_api_bc_mframe_list shadow;
+};
+
+struct ty_api_bc_timing_time
+{
+  L_WORD cnt;
+  L_WORD min;
+  L_WORD max;
+  AiUInt64 sum;
+};
+
+struct ty_api_bc_timing_xfer
+{
+  struct ty_api_bc_timing_time offset;  /* transfer start relative to the minor frame start in us */
+  L_WORD overrun;                       /* transfers started later than the minor frame time plus tolerance */
+};
+
+struct ty_api_bc_timing_marker
+{
+  L_WORD offs;  /* SKIP instruction in the BC instruction list area in instructions */
+  L_WORD xid;   /* time tagged transfer in front of the SKIP, 0 if the minor frame has none */
+};
+
+struct ty_api_bc_timing_list
+{
+  L_WORD cnt;   /* minor frames in the list */
+  struct ty_api_bc_timing_marker *marker;  /* indexed by the minor frame position */
+};
+
+/* On-target BC schedule timing, evaluated from the transfer time tags */
+struct ty_api_bc_timing
+{
+  BYTE frame_valid;       /* frame_start holds the start of the minor frame at frame_pos */
+  L_WORD frame_pos;
+  L_WORD frame_start;     /* in us within the hour */
+  L_WORD frame_overrun;   /* minor frames started later than the minor frame time plus tolerance after the previous one */
+  L_WORD tolerance;       /* in us, a frame or transfer is only counted as overrun beyond the minor frame time plus this */
+  struct ty_api_bc_timing_time interval;  /* minor frame start to start in us */
+  L_WORD xfer_cnt;
+  struct ty_api_bc_timing_xfer *xfer;
+  struct ty_api_bc_timing_list list[ 2 ];  /* markers of the active and the shadow list */
+};
+
 typedef struct
 {
   WORD xid[ MAX_API_BC_XFER *MAX_MEM_MUL ];
@@ -714,6 +784,43 @@ struct ty_api_bm_stackp_dsp
   L_WORD etp;
 };
 
+struct ty_api_bm_stat_time
+{
+  L_WORD cnt;
+  L_WORD min;
+  L_WORD max;
+  AiUInt64 sum;
+};
+
+struct ty_api_bm_stat_values
+{
+  L_WORD msg_cnt;
+  L_WORD err_cnt;
+  L_WORD err_hist[ 16 ];
+  struct ty_api_bm_stat_time gap;
+  struct ty_api_bm_stat_time interval;
+  struct ty_api_bm_stat_time resp[ MAX_API_RT ];
+  L_WORD sa_cnt[ MAX_API_RT ][ MAX_API_RT_MC_SA ][ 4 ]; /* rcv msg, rcv err, xmt msg, xmt err */
+};
+
+/* On-target bus statistics, evaluated from the BM buffer */
+struct ty_api_bm_stat
+{
+  L_WORD pos;            /* next BM buffer entry to evaluate */
+  BYTE sync;             /* first message start found */
+  BYTE cw_valid;         /* cw holds the first command word of the open message */
+  BYTE rt2;              /* transmitting RT of an RT-RT message, 0xFF if none */
+  BYTE sw_cnt;           /* status words of the open message */
+  L_WORD cw;
+  L_WORD err;            /* accumulated error word of the open message */
+  L_WORD ttag_hi;
+  BYTE prev_valid;
+  AiUInt64 prev_start;   /* start time of the previous message in us */
+
+  struct ty_api_bm_stat_values val;   /* updated by the evaluation */
+  struct ty_api_bm_stat_values snap;  /* taken by the first read chunk, returned by all chunks */
+};
+
 struct ty_api_bm_msg_flt_dsp
 {
   BYTE cnt;
@@ -733,6 +840,7 @@ struct ty_api_bm_msg_flt_dsp
   L_WORD cur_ttag_high;
   L_WORD cur_ttag_low;
   BYTE trigd; 
+  BYTE incr;        /* incremental readout, output full does not stop the BM */
   L_WORD cur_cw[2]; /* info for RTRT transfers, first/second command word */
   L_WORD cur_sw[2]; /* info for RTRT transfers, first/second status word */
 };
@@ -804,6 +912,19 @@ struct ty_api_c1760_setup
 /* System Dynamic Data Words           */
 /***************************************/
   #ifdef CMPL4SIM
+struct TY_API_DEV;
+struct ty_api_ls_systag_entry;
+
+/* Local copy of a data buffer, transferred 32 bit wide from/to Global Memory */
+typedef union
+{
+  AiUInt32 l[ MAX_API_BUF_SIZE / 4 ];
+  WORD     w[ MAX_API_BUF_SIZE / 2 ];
+} TY_API_LS_SYSTAG_BUF;
+
+/* Calculation of one System Dynamic Data word within the data buffer copy */
+typedef void (*TY_API_LS_SYSTAG_FUNC)(struct TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf);
+
 struct ty_api_ls_systag_entry
 {
   BYTE mode;
@@ -820,6 +941,10 @@ struct ty_api_ls_systag_entry
   WORD mask;
   BYTE init;
   WORD index;
+  BYTE pass;                  /* API_SYSTAG_PASS_xxx, set on definition */
+  BYTE wfirst;                /* first data word read or written */
+  BYTE wlast;                 /* last data word read or written */
+  TY_API_LS_SYSTAG_FUNC calc; /* function for pass API_SYSTAG_PASS_xxx */
 };
 struct ty_api_ls_systag_setup
 {
@@ -1121,6 +1246,17 @@ typedef volatile struct
 } TY_API_DATA_QUEUE_HEADER;
 
 
+/* Target side message filter of a BM recording data queue */
+typedef struct
+{
+  L_WORD enable;
+  L_WORD rt_mask;    /* bit n set => RT n passes */
+  L_WORD rx_sa_mask; /* bit n set => receive SA/MC n passes */
+  L_WORD tx_sa_mask; /* bit n set => transmit SA/MC n passes */
+  L_WORD error_mask; /* 0 => no error filter, else only messages with error word bits set in mask pass */
+} TY_API_DATA_QUEUE_FILTER;
+
+
 
 typedef struct TY_API_DEV
 {
@@ -1229,6 +1365,10 @@ typedef struct TY_API_DEV
   struct ty_api_bc_srvw_t bc_srvw_tab[ MAX_BIU ];
   struct ty_api_bc_frame_setup bc_srvw_subframe[ MAX_BIU ];
   struct ty_api_bc_acyc_ttag bc_acyc_ttag_start[ MAX_BIU ];
+  struct ty_api_bc_acyc_queue bc_acyc_queue[ MAX_BIU ];
+  struct ty_api_bc_frame_swap bc_frame_swap[ MAX_BIU ];
+  struct ty_api_bc_timing *bc_timing[ MAX_BIU ];
+  struct ai_tsw_os_lock *bc_timing_lock[ MAX_BIU ];  /* serializes the timing monitor between command and interrupt handler */
 
   #endif 
 
@@ -1249,6 +1389,8 @@ typedef struct TY_API_DEV
   BYTE bm_msg_flt_mode[ MAX_BIU ]; 
   struct ty_api_bm_ls_dyntagm_table bm_ls_dyntagm_lut[ MAX_BIU ];
   struct ty_api_bm_ls_dyntagm_setup bm_ls_dyntagm_set[ MAX_BIU ];
+  struct ty_api_bm_stat *bm_stat[ MAX_BIU ];
+  struct ai_tsw_os_lock *bm_stat_lock[ MAX_BIU ];  /* serializes the statistics between command and interrupt handler */
 
   BYTE uc_BmIniClearBuffer;  /* initializing the BM buffer may take some time. */
 
@@ -1427,6 +1569,7 @@ typedef struct TY_API_DEV
   TY_API_TRACK_DEF hs_track[ API39_MAX_STREAM ][ API_MAX_MUX_BUFFER ];
 
   L_WORD dataqueue_header_offsets[ API_MAX_DATA_QUEUE_ID+1 ]; /* API Data Queue LogList */
+  TY_API_DATA_QUEUE_FILTER dataqueue_filter[ API_MAX_DATA_QUEUE_ID+1 ]; /* API Data Queue message filter */
 
   TY_API_ISR_IRIG_TIME api_irg_time;
   L_WORD SrecCheckSum;
@@ -1509,6 +1652,7 @@ typedef struct TY_API_DEV
   struct ai_tsw_os_lock * TransferListLock[MAX_BIU];
   struct ai_list_head     RTBufferList[MAX_BIU];
   struct ai_tsw_os_lock * RTBufferListLock[MAX_BIU];
+  L_WORD                  UsbMonitorSyncOffset[MAX_BIU]; /* monitor buffer offset up to which the mirror holds final data */
 #endif
 
 
@@ -404,17 +404,30 @@ L_WORD api_bc_xfer_bh_info_get(          TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC
 L_WORD api_bc_major_frame_get(           TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_LS_BC_MAJOR_FRAME_GET_OUTPUT *out);
 L_WORD api_bc_minor_frame_get(           TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MINOR_FRAME_GET_INPUT * in, TY_MIL_COM_LS_BC_MINOR_FRAME_GET_OUTPUT *out);
 L_WORD api_bc_dytag_def(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_INPUT * in, TY_MIL_COM_ACK * out );
+L_WORD api_bc_dytag_def_list(            TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_bc_dytag_def_get(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_GET_INPUT * in, TY_MIL_COM_LS_BC_DYTAG_DEF_GET_OUTPUT * out );
 L_WORD api_bc_frame_def_cmd(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MINOR_FRAME_DEF_INPUT * in, TY_MIL_COM_ACK *out );
 L_WORD api_bc_mframe_def_cmd(            TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MAJOR_FRAME_DEF_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_bc_status_read_cmd(           TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_LS_BC_STATUS_READ_OUTPUT * out );
 L_WORD api_bc_xfer_read_cmd(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_XFER_READ_INPUT * in, TY_MIL_COM_LS_BC_XFER_READ_OUTPUT * out );
+L_WORD api_bc_xfer_read_bulk(            TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_XFER_READ_BULK_INPUT * in, TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT * out );
 L_WORD api_bc_srvw_req_read(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_SRVW_REQ_READ_INPUT * in, TY_MIL_COM_LS_BC_SRVW_REQ_READ_OUTPUT * out );
 L_WORD api_bc_srvw_req_con(              TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_SRVW_REQ_CON_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_bc_acyc_msg_prep(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_INPUT * in, TY_MIL_COM_ACK *out );
 L_WORD api_bc_acyc_msg_send_cmd(         TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_SEND_INPUT * in, TY_MIL_COM_ACK *out );
+L_WORD api_bc_acyc_queue(                TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_QUEUE_INPUT * in, TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT * out );
+L_WORD api_bc_acyc_queue_status(         TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT * out );
+L_WORD api_bc_setup_bulk(                TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_SETUP_BULK_INPUT * in, TY_MIL_COM_ACK * out );
+L_WORD api_bc_frame_swap(                TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_ACK * out );
+void api_bc_frame_swap_reset(            TY_API_DEV *p_api_dev, short biu );
+void api_bc_frame_swap_skip(             TY_API_DEV *p_api_dev, short biu, L_WORD addr );
+void api_bc_acyc_queue_reset(            TY_API_DEV *p_api_dev, short biu );
+void api_bc_acyc_queue_skip(             TY_API_DEV *p_api_dev, short biu, L_WORD addr );
 L_WORD api_bc_mode_ctrl(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODE_CTRL_INPUT * in, TY_MIL_COM_ACK * out);
 L_WORD api_bc_modify_def(                TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODIFY_DEF_INPUT * in, TY_MIL_COM_LS_BC_MODIFY_DEF_OUTPUT * out);
+L_WORD api_bc_modify_def_list(           TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT * in, TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_OUTPUT * out);
+L_WORD api_bc_timing_control(            TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_TIMING_CONTROL_INPUT * in, TY_MIL_COM_ACK * out );
+L_WORD api_bc_status_timing_read(        TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_STATUS_TIMING_READ_INPUT * in, TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT * out );
 L_WORD api_bc_traffic_override_control( TY_API_DEV *p_api_dev, TY_MIL_COM_WITH_VALUE * in, TY_MIL_COM_ACK * out);
 L_WORD api_bc_traffic_override_get(     TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_ACK_WITH_VALUE * out);
 
@@ -431,7 +444,10 @@ L_WORD api_bc_frame_def(                 TY_API_DEV *p_api_dev, BYTE frame_id, B
 L_WORD api_bc_mframe_def(                TY_API_DEV *p_api_dev, L_WORD frame_cnt, L_WORD *frame_ids);
 L_WORD api_bc_status_read(               TY_API_DEV *p_api_dev);
 L_WORD api_bc_xfer_read(                 TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode);
+L_WORD api_bc_xfer_read_internal(        TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode, BYTE sync);
 void api_bc_acyc_check_ttag(             TY_API_DEV *p_api_dev);
+void api_bc_timing_reset(                TY_API_DEV *p_api_dev, short biu);
+void api_bc_timing_free(                 TY_API_DEV *p_api_dev, short biu);
 L_WORD api_bc_acyc_prep_and_send_transfer(TY_API_DEV *p_api_dev, MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER_INPUT * in, MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER_OUTPUT * out);
 
 
@@ -451,6 +467,7 @@ L_WORD api_rt_sa_con_cmd(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_R
 L_WORD api_rt_sa_err_con(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_SA_ERR_CON_INPUT   * in, TY_MIL_COM_ACK * out );
 L_WORD api_rt_sa_err_get(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_SA_ERR_GET_INPUT   * in, TY_MIL_COM_LS_RT_SA_ERR_GET_OUTPUT * out );
 L_WORD api_rt_dytag_def(                  TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT    * in, TY_MIL_COM_ACK * out );
+L_WORD api_rt_dytag_def_list(             TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_rt_dytag_get(                  TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_GET_INPUT    * in, TY_MIL_COM_LS_RT_DYTAG_GET_OUTPUT * out );
 L_WORD api_rt_start(                      TY_API_DEV *p_api_dev, TY_MIL_COM                          * in, TY_MIL_COM_ACK * out );
 L_WORD api_rt_halt(                       TY_API_DEV *p_api_dev, TY_MIL_COM                          * in, TY_MIL_COM_ACK * out );
@@ -503,18 +520,25 @@ L_WORD api_bm_ini_tci(                   TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM
 L_WORD api_bm_ini_tcb(                   TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_INI_TCB_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_bm_rt_act_read(               TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_RT_ACT_READ_INPUT * in, TY_MIL_COM_LS_BM_RT_ACT_READ_OUTPUT * out );
 L_WORD api_bm_rt_sa_act_read_cmd(        TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_RT_SA_ACT_READ_INPUT * in, TY_MIL_COM_LS_BM_RT_SA_ACT_READ_OUTPUT * out );
+L_WORD api_bm_rt_sa_act_snapshot(        TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_INPUT * in, TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT * out );
+L_WORD api_bm_stat_control(              TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_STAT_CONTROL_INPUT * in, TY_MIL_COM_ACK * out );
+L_WORD api_bm_stat_read(                 TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_STAT_READ_INPUT * in, TY_MIL_COM_LS_BM_STAT_READ_OUTPUT * out );
 L_WORD api_bm_ini_msg_flt_rec(           TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_INI_MSG_FLT_REC_INPUT * in, TY_MIL_COM_ACK * out);
 L_WORD api_bm_read_msg_flt_rec(          TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_MSG_FLT_REC_INPUT * in, TY_MIL_COM_LS_BM_MSG_FLT_REC_OUTPUT * out );
 L_WORD api_bm_dyntag_mon_def(            TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DYNTAG_DEF_INPUT * in, TY_MIL_COM_ACK * out );
 L_WORD api_bm_dyntag_mon_read(           TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_INPUT * in, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_OUTPUT * out );
+L_WORD api_bm_dyntag_mon_read_bulk(      TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_INPUT * in, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_OUTPUT * out );
 
 
 void api_ls_bm_command_table( TY_MIL_COM_TABLE_ENTRY ** table, AiUInt32 * size );
+void api_ls_bm_stat_command_table( TY_MIL_COM_TABLE_ENTRY ** table, AiUInt32 * size );
 L_WORD api_bm_stack_ptr_read_ir(TY_API_DEV *p_api_dev, short dest_biu, TY_MIL_COM_LS_BM_STACK_PTR_READ_OUTPUT * out);
 
 
 /* -- TSW internal --- */
 L_WORD api_bm_ini(                        TY_API_DEV *p_api_dev);
+void   api_bm_stat_reset(                 TY_API_DEV *p_api_dev, short biu);
+void   api_bm_stat_free(                  TY_API_DEV *p_api_dev, short biu);
 L_WORD api_bm_ini_intr(                   TY_API_DEV *p_api_dev, BYTE imod, BYTE smod);
 L_WORD api_bm_ini_cap(                    TY_API_DEV *p_api_dev, BYTE cmod, L_WORD tat, WORD mcc, WORD fsize);
 L_WORD api_bm_mode(                       TY_API_DEV *p_api_dev, BYTE con);
@@ -635,6 +659,7 @@ void api_io_bc_xfer_def                  (TY_API_DEV *p_api_dev, WORD xid, WORD
                                                                  BYTE rsp, BYTE res, L_WORD swxm, BYTE type, BYTE wpos, BYTE bpos, BYTE sync, BYTE contig, BYTE bc_bits, BYTE delay_mode, WORD gap);
 void api_io_bc_xfer_ctrl                 (TY_API_DEV *p_api_dev, WORD xid, BYTE mode); 
 L_WORD api_io_bc_modify_def              (TY_API_DEV *p_api_dev, L_WORD id, TY_API_BC_MODIFY_INSTRUCTION * modify, L_WORD * pbi_relative_offset);
+void   api_io_bc_modify_write            (TY_API_DEV *p_api_dev, L_WORD offset, TY_API_BC_MODIFY_INSTRUCTION * modify);
 void api_io_bc_xfer_dytag_con            (TY_API_DEV *p_api_dev, WORD xid, WORD dytag_i);
 void api_io_bc_bh_eq_con                 (TY_API_DEV *p_api_dev, WORD con, L_WORD bc_hid);
 void api_io_bc_fw_dytag_dis              (TY_API_DEV *p_api_dev, WORD bc_hid);
@@ -731,6 +756,7 @@ void api_ir_transp(                       TY_API_DEV *p_api_dev, short dest_biu
 void api_ir_mode_con(                     TY_API_DEV *p_api_dev, short dest_biu, BYTE mode, BYTE con);
 void api_ir_calculate_checksum(           TY_API_DEV *p_api_dev, short dest_biu, WORD systag_id, L_WORD dbp );
 void api_ir_systag(                       TY_API_DEV *p_api_dev, short dest_biu, BYTE bc_rt_mode, WORD xid_rtsa, L_WORD dbp);
+void api_ir_systag_compile(               struct ty_api_ls_systag_entry *p_tag );
 void api_ir_bcrt_queue(                   TY_API_DEV *p_api_dev, short dest_biu, WORD fifo_i, L_WORD dbp);
 void api_ir_bc_srvw(                      TY_API_DEV *p_api_dev, short dest_biu, BYTE rt_addr, WORD vw, L_WORD xid);
 void api_ir_bc(                           TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2);
@@ -739,12 +765,14 @@ void api_ir_rt(                           TY_API_DEV *p_api_dev, short dest_biu,
 void api_ir_bm_rec(                       TY_API_DEV *p_api_dev, short dest_biu, L_WORD addr);
 void api_ir_bm_dyntagm(                   TY_API_DEV *p_api_dev, short dest_biu, L_WORD addr); 
 void api_ir_bm(                           TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2);
+void api_ir_bm_stat(                      TY_API_DEV *p_api_dev, short dest_biu);
 void api_ir_rep(                          TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2);
 void api_ir_tt(                           TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2);
 void api1553_gen_int2host(                TY_API_DEV *p_api_dev, L_WORD mask); 
 void api_ir_track(                        TY_API_DEV *p_api_dev, short biu, BYTE uTrackId, TY_API_TRACK_DEF *pTrack, TY_API_TRACK_DEF *pTrackList, L_WORD dbp, L_WORD sqp);
 void api_ir_data_queue(                   TY_API_DEV *p_api_dev, AiUInt8 id);
 void api_ir_data_queue_generic_acq       (TY_API_DEV *p_api_dev, TY_API_DATA_QUEUE_HEADER *pDataQueue, L_WORD id, L_WORD size, L_WORD *data);
+void api_ir_data_queue_xfer_event        (TY_API_DEV *p_api_dev, short dest_biu, L_WORD type, L_WORD w1, L_WORD id, L_WORD sqp);
 void api_ir_enque_aye_discretes_from_fpga(TY_API_DEV *p_api_dev, L_WORD id, L_WORD tt_hi, L_WORD tt_lo, L_WORD val);
 
 
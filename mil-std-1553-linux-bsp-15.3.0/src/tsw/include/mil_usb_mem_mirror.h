@@ -152,6 +152,20 @@ AiInt32 UsbSynchronizeBM(TY_API_DEV* p_api_dev, short uc_Biu, enum SYNCH_DIRECTI
 AiInt32 UsbSynchronizeMonitorDataBuffer(TY_API_DEV* p_api_dev, short uc_Biu, 
                                         enum SYNCH_DIRECTION direction);
 
+/* Restarts the incremental monitor data buffer synchronization of a specific BIU
+   at the start of its monitor buffer. Has to be called whenever the monitor fill pointer is reset.
+   Parameters: TY_API_DEV - pointer to target vars structure
+               unsigned char - ID of BIU */
+void UsbMonitorDataBufferSyncReset(TY_API_DEV* p_api_dev, short uc_Biu);
+
+/* Synchronizes only the monitor data that was written since the last call, i.e. the area
+   between the last synchronized offset and the current monitor fill pointer, from global memory
+   into its mirror. The area is read with at most two transfers (two if the monitor wrapped around).
+   Parameters: TY_API_DEV - pointer to target vars structure
+               unsigned char - ID of BIU
+   Return: return 0, if synch was successful */
+AiInt32 UsbSynchronizeMonitorDataBufferNewData(TY_API_DEV* p_api_dev, short uc_Biu);
+
 /* Synchronizes the monitor activity/filtering page of a specific BIU 
    between global memory and its mirror
    Parameters: TY_API_DEV - pointer to target vars structure
@@ -27,6 +27,8 @@
 #define UsbSynchronizeRTSystemControlBlock(          a, b, c             )
 #define UsbSynchronizeBM(                            a, b, c             )
 #define UsbSynchronizeMonitorDataBuffer(             a, b, c             )
+#define UsbMonitorDataBufferSyncReset(               a, b                )
+#define UsbSynchronizeMonitorDataBufferNewData(      a, b                )
 #define UsbSynchronizeMonitorActivityFilteringPage(  a, b, c             )
 #define UsbSynchronizeTriggerControlBlockArea(       a, b, c             )
 #define UsbSynchronizeBMSystemControlBlock(          a, b, c             )
@@ -44,6 +44,15 @@ TY_MIL_COM_TABLE_ENTRY axTargetLsBcCommands[] = {
   { MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER, (TY_MIL_COM_FUNC_PTR)api_bc_acyc_prep_and_send_transfer, "api_bc_acyc_prep_and_send_transfer", sizeof(MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER_INPUT), sizeof(MIL_COM_LS_BC_ACYC_PREP_AND_SEND_TRANSFER_OUTPUT) },
   { MIL_COM_LS_BC_TRAFFIC_OVERRIDE_CONTROL, (TY_MIL_COM_FUNC_PTR)api_bc_traffic_override_control, "api_bc_traffic_override_control", sizeof(TY_MIL_COM_WITH_VALUE), sizeof(TY_MIL_COM_ACK) },
   { MIL_COM_LS_BC_TRAFFIC_OVERRIDE_GET, (TY_MIL_COM_FUNC_PTR)api_bc_traffic_override_get, "api_bc_traffic_override_get", sizeof(TY_MIL_COM), sizeof(TY_MIL_COM_ACK_WITH_VALUE) },
+  { MIL_COM_LS_BC_XFER_READ_BULK, (TY_MIL_COM_FUNC_PTR)api_bc_xfer_read_bulk, "api_bc_xfer_read_bulk", MIL_COM_LS_BC_XFER_READ_BULK_INPUT_MINIMUM_SIZE, 0 /* variable */ },
+  { MIL_COM_LS_BC_ACYC_QUEUE, (TY_MIL_COM_FUNC_PTR)api_bc_acyc_queue, "api_bc_acyc_queue", MIL_COM_LS_BC_ACYC_QUEUE_INPUT_MINIMUM_SIZE, sizeof(TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT) },
+  { MIL_COM_LS_BC_ACYC_QUEUE_STATUS, (TY_MIL_COM_FUNC_PTR)api_bc_acyc_queue_status, "api_bc_acyc_queue_status", sizeof(TY_MIL_COM), sizeof(TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT) },
+  { MIL_COM_LS_BC_SETUP_BULK, (TY_MIL_COM_FUNC_PTR)api_bc_setup_bulk, "api_bc_setup_bulk", MIL_COM_LS_BC_SETUP_BULK_INPUT_MINIMUM_SIZE, sizeof(TY_MIL_COM_ACK) },
+  { MIL_COM_LS_BC_FRAME_SWAP, (TY_MIL_COM_FUNC_PTR)api_bc_frame_swap, "api_bc_frame_swap", sizeof(TY_MIL_COM), sizeof(TY_MIL_COM_ACK) },
+  { MIL_COM_LS_BC_MODIFY_DEF_LIST, (TY_MIL_COM_FUNC_PTR)api_bc_modify_def_list, "api_bc_modify_def_list", MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT_MINIMUM_SIZE, sizeof(TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_OUTPUT) },
+  { MIL_COM_LS_BC_TIMING_CONTROL, (TY_MIL_COM_FUNC_PTR)api_bc_timing_control, "api_bc_timing_control", sizeof(TY_MIL_COM_LS_BC_TIMING_CONTROL_INPUT), sizeof(TY_MIL_COM_ACK) },
+  { MIL_COM_LS_BC_STATUS_TIMING_READ, (TY_MIL_COM_FUNC_PTR)api_bc_status_timing_read, "api_bc_status_timing_read", sizeof(TY_MIL_COM_LS_BC_STATUS_TIMING_READ_INPUT), 0 /* variable */ },
+  { MIL_COM_LS_BC_DYTAG_DEF_LIST, (TY_MIL_COM_FUNC_PTR)api_bc_dytag_def_list, "api_bc_dytag_def_list", MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE, sizeof(TY_MIL_COM_ACK) },
 };
 
 
@@ -185,6 +194,10 @@ BYTE api_bc_ini(TY_API_DEV *p_api_dev, BYTE retr, BYTE svrq, BYTE tbm, BYTE gsb)
     p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ j ] = 0L;
 
   p_api_dev->ul_XferCntForAcyclic = 0;
+  api_bc_acyc_queue_reset(p_api_dev, p_api_dev->biu);
+  api_bc_frame_swap_reset(p_api_dev, p_api_dev->biu);
+  p_api_dev->bc_frame_swap[ p_api_dev->biu ].modify_ids = 0;
+  api_bc_timing_free(p_api_dev, p_api_dev->biu);
   return 0;
 
 } /* end: api_bc_ini */
@@ -613,44 +626,50 @@ L_WORD api_bc_xfer_ctrl(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_XFER_CTRL_INPUT
 /*                                                                           */
 /*****************************************************************************/
 
-L_WORD api_bc_dytag_def(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_INPUT * in, TY_MIL_COM_ACK * out )
+static void api_bc_dytag_def_hid(TY_API_DEV *p_api_dev, AiUInt32 con, AiUInt32 bc_hid, AiUInt32 mode, AiUInt32 *tag_fct,
+                                 AiUInt32 *min, AiUInt32 *max, AiUInt32 *step, AiUInt32 *wpos)
 {
-    if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_BC_EVENT_QUEUE))
-        return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
-
-    if( in->bc_hid < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_eq_area)
+    if(con == API_BC_DYTAG_ENA)
     {
-        if(in->con == API_BC_DYTAG_ENA)
+        /* Enable Dynamic Data Function */
+        if(p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ bc_hid ].ena == API_OFF)
         {
-            /* Enable Dynamic Data Function */
-            if(p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ in->bc_hid ].ena == API_OFF)
-            {
-                p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ in->bc_hid ].ena = API_ON;
+            p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ bc_hid ].ena = API_ON;
 
-                /* Enable Event Queue processing */
-                api_io_bc_bh_eq_con(p_api_dev, API_ON, in->bc_hid);
+            /* Enable Event Queue processing */
+            api_io_bc_bh_eq_con(p_api_dev, API_ON, bc_hid);
 
-                /* Init Event Queue Descriptor */
-                api_io_bc_dytag_def( p_api_dev, (WORD)in->bc_hid, (WORD)in->mode, (WORD)in->tag_fct[0], (WORD)in->min[0], (WORD)in->max[0], (WORD)in->step[0], (WORD)in->wpos[0],
-                                                                                  (WORD)in->tag_fct[1], (WORD)in->min[1], (WORD)in->max[1], (WORD)in->step[1], (WORD)in->wpos[1],
-                                                                                  (WORD)in->tag_fct[2], (WORD)in->min[2], (WORD)in->max[2], (WORD)in->step[2], (WORD)in->wpos[2],
-                                                                                  (WORD)in->tag_fct[3], (WORD)in->min[3], (WORD)in->max[3], (WORD)in->step[3], (WORD)in->wpos[3]);
-            }
+            /* Init Event Queue Descriptor */
+            api_io_bc_dytag_def( p_api_dev, (WORD)bc_hid, (WORD)mode, (WORD)tag_fct[0], (WORD)min[0], (WORD)max[0], (WORD)step[0], (WORD)wpos[0],
+                                                                      (WORD)tag_fct[1], (WORD)min[1], (WORD)max[1], (WORD)step[1], (WORD)wpos[1],
+                                                                      (WORD)tag_fct[2], (WORD)min[2], (WORD)max[2], (WORD)step[2], (WORD)wpos[2],
+                                                                      (WORD)tag_fct[3], (WORD)min[3], (WORD)max[3], (WORD)step[3], (WORD)wpos[3]);
         }
-        else
+    }
+    else
+    {
+        /* Disable Dynamic Data Function */
+        if(p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ bc_hid ].ena == API_ON)
         {
-            /* Disable Dynamic Data Function */
-            if(p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ in->bc_hid ].ena == API_ON)
-            {
-                p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ in->bc_hid ].ena = API_OFF;
+            p_api_dev->bc_setup[ p_api_dev->biu ].ls_dytag[ bc_hid ].ena = API_OFF;
 
-                /* Disable Event Queue processing */
-                api_io_bc_bh_eq_con(p_api_dev, API_OFF, in->bc_hid);
+            /* Disable Event Queue processing */
+            api_io_bc_bh_eq_con(p_api_dev, API_OFF, bc_hid);
 
-                /* Reset Event Queue Descriptor */
-                api_io_bc_eq_ini(p_api_dev, (WORD)in->bc_hid);
-            }
+            /* Reset Event Queue Descriptor */
+            api_io_bc_eq_ini(p_api_dev, (WORD)bc_hid);
         }
+    }
+}
+
+L_WORD api_bc_dytag_def(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_INPUT * in, TY_MIL_COM_ACK * out )
+{
+    if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_BC_EVENT_QUEUE))
+        return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
+
+    if( in->bc_hid < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_eq_area)
+    {
+        api_bc_dytag_def_hid(p_api_dev, in->con, in->bc_hid, in->mode, in->tag_fct, in->min, in->max, in->step, in->wpos);
 
         return 0;
     }
@@ -660,6 +679,53 @@ L_WORD api_bc_dytag_def(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_INPUT
 
 } /* end: api_bc_dytag_def */
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_DYTAG_DEF_LIST     */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Number of definitions [cnt]                                */
+/*                Dynamic tagging definitions [entry]                        */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'MIL_COM_LS_BC_DYTAG_DEF_LIST' instruction.  */
+/*    It applies a list of BC dynamic tagging definitions in one command.    */
+/*    All buffer header ids are checked before the first entry is applied.   */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bc_dytag_def_list(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT * in, TY_MIL_COM_ACK * out )
+{
+    TY_MIL_COM_LS_BC_DYTAG_DEF_ENTRY *entry;
+    L_WORD i;
+
+    if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_BC_EVENT_QUEUE))
+        return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
+
+    if ((in->cnt == 0) || (in->cnt > MIL_COM_LS_BC_DYTAG_DEF_LIST_MAX))
+        return API_ERR_PARAM2_NOT_IN_RANGE;
+
+    if (in->cmd.ulSize < (MIL_COM_LS_BC_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE + in->cnt * sizeof(TY_MIL_COM_LS_BC_DYTAG_DEF_ENTRY)))
+        return API_ERR_WRONG_CMD_SIZE;
+
+    for (i = 0; i < in->cnt; i++)
+        if (in->entry[i].bc_hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_eq_area)
+            return API_NAK;
+
+    for (i = 0; i < in->cnt; i++)
+    {
+        entry = &in->entry[i];
+        api_bc_dytag_def_hid(p_api_dev, entry->con, entry->bc_hid, entry->mode, entry->tag_fct, entry->min, entry->max, entry->step, entry->wpos);
+    }
+
+    return 0;
+
+} /* end: api_bc_dytag_def_list */
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BC                   Submodule : API_BC_DYTAG_DEF_GET      */
@@ -1059,6 +1125,147 @@ L_WORD api_bc_mframe_def_cmd( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MAJOR_FRAM
 }
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_SETUP_BULK         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Amount of Buffer Headers [bh_cnt],                         */
+/*                Amount of BC Transfers [xfer_cnt],                         */
+/*                Amount of Minor Frames [frame_cnt],                        */
+/*                Amount of Minor Frames in the Major Frame [mframe_cnt],    */
+/*                Packed definitions in this order [data]                    */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_SETUP_BULK' instruction to define    */
+/*    BC Buffer Headers, BC Transfers, Minor Frames and the Major Frame with */
+/*    one command. The command size and all identifiers are checked before   */
+/*    the first definition is applied.                                       */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bc_setup_bulk(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_SETUP_BULK_INPUT * in, TY_MIL_COM_ACK * out )
+{
+    TY_MIL_COM_LS_BC_BULK_BH    *bh;
+    TY_MIL_COM_LS_BC_BULK_XFER  *xfer;
+    TY_MIL_COM_LS_BC_BULK_FRAME *frame;
+    L_WORD *frames;
+    L_WORD *mframe;
+    L_WORD *next;
+    L_WORD size;
+    L_WORD retval;
+    L_WORD i;
+
+    if( (in->bh_cnt > MAX_API_CMD_SIZE) || (in->xfer_cnt > MAX_API_CMD_SIZE) || (in->frame_cnt > MAX_API_BC_FRAME) )
+        return API_ERR_WRONG_CMD_SIZE;
+
+    if( in->mframe_cnt > MAX_API_BC_FRAME_IN_MFRAME )
+        return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+    bh     = (TY_MIL_COM_LS_BC_BULK_BH*)in->data;
+    xfer   = (TY_MIL_COM_LS_BC_BULK_XFER*)(bh + in->bh_cnt);
+    frames = (L_WORD*)(xfer + in->xfer_cnt);
+
+    size = MIL_COM_LS_BC_SETUP_BULK_INPUT_MINIMUM_SIZE
+         + in->bh_cnt   * sizeof(TY_MIL_COM_LS_BC_BULK_BH)
+         + in->xfer_cnt * sizeof(TY_MIL_COM_LS_BC_BULK_XFER);
+
+    if( size > in->cmd.ulSize )
+        return API_ERR_WRONG_CMD_SIZE;
+
+    /* Check all definitions before the first one is applied */
+    for( i = 0; i < in->bh_cnt; i++ )
+    {
+        if( (bh[ i ].hid == 0) || (bh[ i ].hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area) )
+            return API_ERR_INVALID_HID;
+    }
+
+    for( i = 0; i < in->xfer_cnt; i++ )
+    {
+        if( (xfer[ i ].xid == 0) || (xfer[ i ].xid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_xfer_desc) )
+            return API_ERR_XID_NOT_IN_RANGE;
+
+        if( (xfer[ i ].hid == 0) || (xfer[ i ].hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area) )
+            return API_ERR_HID_NOT_IN_RANGE;
+    }
+
+    next = frames;
+
+    for( i = 0; i < in->frame_cnt; i++ )
+    {
+        frame = (TY_MIL_COM_LS_BC_BULK_FRAME*)next;
+
+        if( size + MIL_COM_LS_BC_BULK_FRAME_SIZE(0) > in->cmd.ulSize )
+            return API_ERR_WRONG_CMD_SIZE;
+
+        if( (frame->frame_id == 0) || (frame->frame_id > MAX_API_BC_FRAME) )
+            return API_ERR_FRAME_ID_NOT_IN_RANGE;
+
+        if( (frame->xfer_cnt == 0) || (frame->xfer_cnt > MAX_API_BC_XFER_IN_FRAME) )
+            return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+        size += MIL_COM_LS_BC_BULK_FRAME_SIZE(frame->xfer_cnt);
+
+        if( size > in->cmd.ulSize )
+            return API_ERR_WRONG_CMD_SIZE;
+
+        next = (L_WORD*)((BYTE*)next + MIL_COM_LS_BC_BULK_FRAME_SIZE(frame->xfer_cnt));
+    }
+
+    mframe = next;
+
+    if( size + in->mframe_cnt * sizeof(AiUInt32) > in->cmd.ulSize )
+        return API_ERR_WRONG_CMD_SIZE;
+
+    for( i = 0; i < in->mframe_cnt; i++ )
+    {
+        if( (mframe[ i ] == 0) || (mframe[ i ] > MAX_API_BC_FRAME) )
+            return API_ERR_FRAME_ID_NOT_IN_RANGE;
+    }
+
+    /* Apply definitions in dependency order */
+    for( i = 0; i < in->bh_cnt; i++ )
+    {
+        retval = api_bc_bhd_def( p_api_dev, (WORD)bh[ i ].hid, (WORD)bh[ i ].bid, (WORD)bh[ i ].sid, (WORD)bh[ i ].eid, (BYTE)bh[ i ].qsize, (BYTE)bh[ i ].bqm, (BYTE)bh[ i ].bsm, (BYTE)bh[ i ].sqm, (BYTE)bh[ i ].eqm, (BYTE)bh[ i ].dbm );
+
+        if( retval != 0 )
+            return retval;
+    }
+
+    for( i = 0; i < in->xfer_cnt; i++ )
+    {
+        retval = api_bc_xfer_def( p_api_dev, (WORD)xfer[ i ].xid, (WORD)xfer[ i ].hid, (BYTE)xfer[ i ].xfer_type, (BYTE)xfer[ i ].chn, (BYTE)xfer[ i ].xmt_rt, (BYTE)xfer[ i ].rcv_rt, (BYTE)xfer[ i ].xmt_sa, (BYTE)xfer[ i ].rcv_sa, (BYTE)xfer[ i ].wcnt, (BYTE)xfer[ i ].xfer_ir, (BYTE)xfer[ i ].xfer_hlt, (BYTE)xfer[ i ].rte, (BYTE)xfer[ i ].sxh, (BYTE)xfer[ i ].rsp, (BYTE)xfer[ i ].res, (WORD)xfer[ i ].swxm, (BYTE)xfer[ i ].err_type, (BYTE)xfer[ i ].err_wpos, (BYTE)xfer[ i ].err_bpos, (BYTE)xfer[ i ].err_sync, (BYTE)xfer[ i ].err_contig, (BYTE)xfer[ i ].err_bc_bits, (BYTE)xfer[ i ].delay_mode, (WORD)xfer[ i ].gap, NULL );
+
+        if( retval != 0 )
+            return retval;
+    }
+
+    next = frames;
+
+    for( i = 0; i < in->frame_cnt; i++ )
+    {
+        frame = (TY_MIL_COM_LS_BC_BULK_FRAME*)next;
+
+        retval = api_bc_frame_def( p_api_dev, (BYTE)frame->frame_id, (BYTE)frame->xfer_cnt, frame->data );
+
+        if( retval != 0 )
+            return retval;
+
+        next = (L_WORD*)((BYTE*)next + MIL_COM_LS_BC_BULK_FRAME_SIZE(frame->xfer_cnt));
+    }
+
+    if( in->mframe_cnt > 0 )
+        return api_bc_mframe_def( p_api_dev, in->mframe_cnt, mframe );
+
+    return 0;
+
+} /* end: api_bc_setup_bulk */
+
+
 L_WORD api_bc_mframe_def(TY_API_DEV *p_api_dev, L_WORD frame_cnt, L_WORD *frame_ids)
 {
     AiUInt32  i   = 0;
@@ -1096,180 +1303,131 @@ L_WORD api_bc_mframe_def(TY_API_DEV *p_api_dev, L_WORD frame_cnt, L_WORD *frame_
 
 /*****************************************************************************/
 /*                                                                           */
-/*   Module : API_BC                   Submodule : API_BC_MODE               */
-/*                                                                           */
-/*   Author : Rolf Heitzmann           Project   : API1553-DS                */
+/*   Module : API_BC                   Submodule : API_BC_SRVW_SUBFRAME_ADD  */
 /*                                                                           */
-/*   Source : C                        Tools     : PC/AT; Norton Editor;     */
-/*                                                 CYGNUS, GNU-C, As, and LD */
-/*                                                 IDT-C 5.1 Toolkit         */
-/*---------------------------------------------------------------------------*/
-/*   Create :09.03.00   Update : 28.08.02                                    */
 /*---------------------------------------------------------------------------*/
 /*    Descriptions                                                           */
 /*    ------------                                                           */
-/*    Inputs    : API1553T BC Start Mode (Immed./Ext Trg./DBA) [smod],       */
-/*                API1553T BC mode (Cyclic/n times execution) [cnt],         */
-/*                API1553T BC minor frame time in usec [ftime]               */
+/*    Inputs    : Duplicate filter of the subtable [hash]                    */
+/*                BC Transfer Identifier [xid]                               */
 /*                                                                           */
 /*    Outputs   :                                                            */
 /*                                                                           */
 /*    Description :                                                          */
-/*    This function handles the the BIU programming for 'API_BC_START'       */
-/*    instruction.                                                           */
+/*    This function appends the transfer instruction of a BC Transfer to the */
+/*    service request subtable, unless it is already contained or the table  */
+/*    is full. The filter is an open addressed hash of subtable index + 1,   */
+/*    so the duplicate check does not scan the subtable.                     */
 /*                                                                           */
 /*****************************************************************************/
 
-static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_WORD ftime, L_WORD *major_frame, L_WORD *minor_frames)
+static void api_bc_srvw_subframe_add(TY_API_DEV *p_api_dev, BYTE *hash, WORD xid)
 {
-  L_WORD addr, offs, instr, tmpl, frame_cnt;
-  short i, j, k, l, m, flag;
-  WORD tmpw;
-  BYTE fid;
-
-  /* Init Globals */
-  p_api_dev->bc_bh_def.bid = 0;
-  p_api_dev->bc_bh_def.sid = 0;
-  p_api_dev->bc_bh_def.eid = 0;
-  p_api_dev->bc_bh_def.nbufs = 0;
-  p_api_dev->bc_bh_def.hid_addr = 0L;
-  p_api_dev->bc_bh_def.bid_addr = 0L;
-  p_api_dev->bc_bh_def.sid_addr = 0L;
-  p_api_dev->bc_bh_def.eid_addr = 0L;
-
-  /* Init Globals */
-  p_api_dev->bc_xfer_dsp.cw1 = 0x0000;
-  p_api_dev->bc_xfer_dsp.st1 = 0xFFFF;
-  p_api_dev->bc_xfer_dsp.cw2 = 0x0000;
-  p_api_dev->bc_xfer_dsp.st2 = 0xFFFF;
-  p_api_dev->bc_xfer_dsp.cur_bid = 0x0000;
-  p_api_dev->bc_xfer_dsp.cur_brw = 0x0000;
-  p_api_dev->bc_xfer_dsp.cur_buf = 0L;
-  p_api_dev->bc_xfer_dsp.cur_ttag = 0L;
-  p_api_dev->bc_xfer_dsp.msg_cnt = 0L;
-  p_api_dev->bc_xfer_dsp.err_cnt = 0L;
+  struct ty_api_bc_frame_setup *subframe = &p_api_dev->bc_srvw_subframe[ p_api_dev->biu ];
+  L_WORD addr, instr, h;
 
-  /* Clear Global BC Message and Error Counter */
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].msg_cnt = 0L;
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].err_cnt = 0L;
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].hip = 0L;
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].mfc = 0L;
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].res1 = 0L;
-  p_api_dev->bc_status_cnt[ p_api_dev->biu ].res2 = 0L;
-  api_io_bc_glb_cnt_ini(p_api_dev);
+  if(subframe->cnt >= MAX_API_BC_XFER_IN_FRAME)
+    return;
 
+  addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_xfer_desc)) +
+         (xid * MAX_API_BC_XFER_DESC_SIZE);
+  instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
 
-  /* Service Request and Vector Word handling */
-  for(j = 0; j < MAX_API_BC_SRVW_RT; j++)
+  for(h = (xid * 157UL) % API_BC_SRVW_HASH_SIZE; hash[ h ] != 0; h = (h + 1) % API_BC_SRVW_HASH_SIZE)
   {
-    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].xid = 0x0000;
-    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].lvw = 0x0000;
-    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].src = 0L;
+    if(subframe->instr[ hash[ h ] - 1 ] == instr)
+      return;
   }
 
-  p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt = 0;
-  for(j = 0; j < MAX_API_BC_XFER_IN_FRAME; j++)
-    p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ j ] = 0L;
+  hash[ h ] = (BYTE)(subframe->cnt + 1);
+  subframe->instr[ subframe->cnt ] = instr;
+  subframe->cnt++;
 
-  if(p_api_dev->bc_srvw_con[ p_api_dev->biu ] == API_ON)
-  {
-    /* Init first subtable instruction to RETURN */
-    *(p_api_dev->bc_lip_instr_p[ p_api_dev->biu ] + 0) = BSWAP32(MAKE_INSTR(API_BC_INSTR_RET, 0) );
+} /* end: api_bc_srvw_subframe_add */
 
-    /* Seach on multiple Transaction types */
-    for(k = 0; k < MAX_API_BC_SRVW_RT; k++)
-    {
-      for(l = 0; l < MAX_API_BC_SRVW_SAMID; l++)
-      {
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_MFRAME_BUILD       */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : API1553T BC Start Mode [smod],                             */
+/*                API1553T BC mode (Cyclic/n times execution) [cnt],         */
+/*                Instructions already written to the list [offs],           */
+/*                Instruction the major frame loops back to [loop],          */
+/*                Available instructions from the list start [size],         */
+/*                Start of the list in the BC Instr. List area [list->first] */
+/*                                                                           */
+/*    Outputs   : Minor Frame addresses if smod is SETUP [minor_frames],     */
+/*                Size, loop back JMP and Stop SKIP of the list [list]       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function writes the Major Frame defined in 'bc_setup' to a BC     */
+/*    Instruction List. The list is only written if it fits into size.       */
+/*                                                                           */
+/*****************************************************************************/
 
-        /* Put all TX Transactions in subtable */
-        tmpw = p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_TX ].ta[ k ].sa_mid[ l ].xid;
-        if(tmpw != 0)
-        {
-          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_TX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
-          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_DELETE_TX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
-          if(p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt < MAX_API_BC_XFER_IN_FRAME)
-          {
-            addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_xfer_desc)) +
-                   ((tmpw & 0x7FFF) * MAX_API_BC_XFER_DESC_SIZE);
-            instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
-            for(m = 0, flag = 0; m < p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt; m++)
-            {
-              if(p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ m ] == instr)
-              {
-                flag = 1;
-                break;
-              }
-            }
-            if(flag == 0)
-            {
-              p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt ] = instr;
-              p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt++;
-            }
-          }
-        }
+/* Redirects a MODIFY instruction to the copy of its descriptor if the list holds one */
+static L_WORD api_bc_modify_copy_instr(TY_API_DEV *p_api_dev, struct ty_api_bc_mframe_list *list, L_WORD instr)
+{
+  L_WORD hip_base = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr;
+  L_WORD hip_end  = hip_base + p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr;
+  L_WORD k;
 
-        /* Put all RX Transactions in subtable */
-        tmpw = p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_RX ].ta[ k ].sa_mid[ l ].xid;
-        if(tmpw != 0)
-        {
-          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_RX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
-          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_DELETE_RX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
-          if(p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt < MAX_API_BC_XFER_IN_FRAME)
-          {
-            addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_xfer_desc)) +
-                   ((tmpw & 0x7FFF) * MAX_API_BC_XFER_DESC_SIZE);
-            instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
-            for(m = 0, flag = 0; m < p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt; m++)
-            {
-              if(p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ m ] == instr)
-              {
-                flag = 1;
-                break;
-              }
-            }
-            if(flag == 0)
-            {
-              p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt ] = instr;
-              p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt++;
-            }
-          }
-        }
-      }
-    }
+  for(k = 0; k < list->mod_cnt; k++)
+  {
+    if( (instr & 0x03FFFFFFL) == API_GLB_GLOBREL_TO_PBIREL(hip_end - list->mod_id[ k ] * 6 * sizeof(L_WORD)) )
+      return MAKE_INSTR(API_BC_INSTR_MODIFY, API_GLB_GLOBREL_TO_PBIREL(hip_base) + (list->mod_first + k * 6) * 4L);
   }
 
-  /* Clear BC Transfer Message and Error Counter locations */
-  for(i = 0; (unsigned)i < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_xfer_desc; i++)
-    api_io_bc_xfer_desc_tc_ini(p_api_dev, (WORD)i);
-
-  offs = 0L;
+  return instr;
+}
 
-  /* Store Address of Stop Instruction */
-  p_api_dev->bc_setup[ p_api_dev->biu ].sinst = 0L;
+/* Returns the position of the first transfer of the Minor Frame that can be time tagged by the timing monitor, -1 if none */
+static short api_bc_timing_first_xfer(TY_API_DEV *p_api_dev, BYTE fid, L_WORD *xid)
+{
+  L_WORD base = API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_xfer_desc);
+  L_WORD instr;
+  short j;
 
-  /* Insert Wait for External Trigger Event instruction */
-  if(smod == API_BC_XFER_RUN_ETR)
+  for(j = 0; j < p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].cnt; j++)
   {
-    instr = MAKE_INSTR(API_BC_INSTR_WTRG, 0);
-    *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ]) = BSWAP32(instr | 0x02); /* Sync Start */
-    offs++;
+    instr = p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].instr[ j ];
 
-    /* Insert a BC Branch Instruction that raises an interrupt, when BC is triggered */
-    instr = MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L);
-    *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+    if( ((instr >> 26) != API_BC_INSTR_XFER) || ((instr & 0x03FFFFFFL) < base) )
+      continue;
 
-    /* Store address of BC Trigger Instr */
-    p_api_dev->bc_setup[p_api_dev->biu].bc_triggered_inst = API_GLB_TSWPTR_TO_PBIREL((uintptr_t)(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs));
-    
-    offs++;
+    *xid = ((instr & 0x03FFFFFFL) - base) / MAX_API_BC_XFER_DESC_SIZE;
+
+    if( (*xid != 0) && (*xid < p_api_dev->bc_timing[ p_api_dev->biu ]->xfer_cnt) )
+      return j;
   }
 
-  /* Clear return value for  Major Frame Start Address */
-  *major_frame = API_GLB_TSWPTR_TO_GLOBREL(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ]);
+  *xid = 0;
+  return -1;
+}
+
+static BYTE api_bc_mframe_build(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_WORD offs, L_WORD loop, L_WORD size,
+                                L_WORD *minor_frames, struct ty_api_bc_mframe_list *list)
+{
+  L_WORD *instr_p = p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + list->first;
+  L_WORD base = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr)) + list->first * 4L;
+  struct ty_api_bc_timing_list *timing = NULL;
+  L_WORD addr, instr, tmpl, frame_cnt, mxid;
+  short i, j, mj;
+  BYTE fid;
+
+  /* The timing monitor needs a SKIP with interrupt in each Minor Frame */
+  if(p_api_dev->bc_timing[ p_api_dev->biu ] != NULL)
+    timing = &p_api_dev->bc_timing[ p_api_dev->biu ]->list[ (list == &p_api_dev->bc_frame_swap[ p_api_dev->biu ].shadow) ? 1 : 0 ];
+
+  list->cnt   = 0L;
+  list->jmp   = 0L;
+  list->sinst = 0L;
 
-  /* Pre-Check if amount of instructions fit in available BC Instr. List area */
-  frame_cnt = 0L;
+  /* Pre-Check if amount of instructions fit in available size */
+  frame_cnt = offs;
   for(i = 0; i < p_api_dev->bc_setup[ p_api_dev->biu ].mframe.cnt; i++)
   {
     fid = p_api_dev->bc_setup[ p_api_dev->biu ].mframe.fr[ i ] - 1; /* Minor Frame ID */
@@ -1277,7 +1435,9 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
     {
       /* Count the Instructions */
       frame_cnt += p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].cnt;
-      frame_cnt += 1; /* add instruction for WMFT */
+      frame_cnt += 1; /* add instruction for WMFT or WTRG */
+      if(timing != NULL)
+        frame_cnt += 1; /* add timing monitor SKIP */
       if(p_api_dev->bc_srvw_con[ p_api_dev->biu ] == API_ON)
         frame_cnt += 1;
        /* add instruction if SVR-REQUEST handling was enabled */
@@ -1285,26 +1445,30 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
     else
     {
       /* error */
-      frame_cnt = 0xFFFFFFFFL;
-      break;
+      return API_ERR;
     }
   }
 
-  /* Check on available size */
-  if(frame_cnt >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr / 4)
-  {
-    *major_frame = 0xFFFFFFFFL; /* indicate ERRROR */
+  /* add JMP and HALT, DJZ and SKIP if non-cyclic */
+  if(p_api_dev->bc_setup[ p_api_dev->biu ].mframe.cnt > 0)
+    frame_cnt += (cnt != 0) ? 4 : 2;
+
+  /* Check on available size, copies of modify descriptors follow the list */
+  if( (frame_cnt + list->mod_cnt * 6) >= size)
     return API_ERR;
-  }
 
+  list->mod_first = list->first + frame_cnt;
+
+  if(timing != NULL)
+    timing->cnt = p_api_dev->bc_setup[ p_api_dev->biu ].mframe.cnt;
 
   /*** Major Frame ***/
   for(i = 0; i < p_api_dev->bc_setup[ p_api_dev->biu ].mframe.cnt; i++)
   {
 
     /* Store Minor Frame address values */
-    if(smod == API_BC_XFER_RUN_SETUP)
-      minor_frames[ i ] = API_GLB_TSWPTR_TO_GLOBREL((ptrdiff_t) p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + (ptrdiff_t) offs);
+    if( (smod == API_BC_XFER_RUN_SETUP) && (minor_frames != NULL) )
+      minor_frames[ i ] = API_GLB_TSWPTR_TO_GLOBREL((ptrdiff_t) instr_p + (ptrdiff_t) offs);
 
     fid = p_api_dev->bc_setup[ p_api_dev->biu ].mframe.fr[ i ] - 1; /* Minor Frame ID */
     if(fid < MAX_API_BC_FRAME)
@@ -1312,15 +1476,42 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
       if(smod == API_BC_XFER_RUN_EXT)
       {
         instr = MAKE_INSTR(API_BC_INSTR_WTRG, 0);
-        *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+        *(instr_p + offs) = BSWAP32(instr);
         offs++;
       }
 
+      /* The timing monitor SKIP follows the first transfer, the start of a frame without transfer is not time tagged */
+      mj = -1;
+      if(timing != NULL)
+      {
+        mj = api_bc_timing_first_xfer(p_api_dev, fid, &mxid);
+        if(mj < 0)
+        {
+          timing->marker[ i ].offs = list->first + offs;
+          timing->marker[ i ].xid  = 0;
+          *(instr_p + offs) = BSWAP32(MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L) );
+          offs++;
+        }
+      }
+
       /* Minor Frames */
       for(j = 0; j < p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].cnt; j++)
       {
-        *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].instr[ j ]);
+        instr = p_api_dev->bc_setup[ p_api_dev->biu ].frame[ fid ].instr[ j ];
+
+        if( (list->mod_cnt != 0) && ((instr >> 26) == API_BC_INSTR_MODIFY) )
+          instr = api_bc_modify_copy_instr(p_api_dev, list, instr);
+
+        *(instr_p + offs) = BSWAP32(instr);
         offs++;
+
+        if(j == mj)
+        {
+          timing->marker[ i ].offs = list->first + offs;
+          timing->marker[ i ].xid  = mxid;
+          *(instr_p + offs) = BSWAP32(MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L) );
+          offs++;
+        }
       }
 
       /* Service Request and Vector Word handling */
@@ -1329,7 +1520,7 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
         /* Insert subtable CALL at the end of each minor frame */
         instr = MAKE_INSTR(API_BC_INSTR_CALL, 
                            (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_lip_instr)) );
-        *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+        *(instr_p + offs) = BSWAP32(instr);
         offs++;
       }
 
@@ -1340,10 +1531,10 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
         /* Decrement and Jump on Zero if non-cyclic */
         if(cnt != 0)
         {
-          addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr)) +
+          addr = base +
                  offs * 4L + 3 * 4L; /* Jump to Skip+Interrupt */
           instr = MAKE_INSTR(API_BC_INSTR_DJZ, addr);
-          *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+          *(instr_p + offs) = BSWAP32(instr);
           offs++;
         }
 
@@ -1351,50 +1542,214 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
         if(smod != API_BC_XFER_RUN_EXT)
         {
           instr = MAKE_INSTR(API_BC_INSTR_WMFT, 0);
-          *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+          *(instr_p + offs) = BSWAP32(instr);
           offs++;
         }
 
         /* Unconditional Jump */
-        if(smod == API_BC_XFER_RUN_ETR)
+        list->jmp = offs;
+        addr = base + loop * 4L;
+        instr = MAKE_INSTR(API_BC_INSTR_JMP, addr);
+        *(instr_p + offs) = BSWAP32(instr);
+        offs++;
+
+        /* Skip + Interrupt if non-cyclic */
+        if(cnt != 0)
         {
-          /* Leave out 'wait for external trigger' and 'bc start interrupt' instruction = 8 Byte */
-          addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr)) + 8;
+          tmpl = 0x02000001L;
+          instr = MAKE_INSTR(API_BC_INSTR_SKIP, tmpl);
+          *(instr_p + offs) = BSWAP32(instr);
+          list->sinst = offs * 4+ API_GLB_TSWPTR_TO_GLOBREL(instr_p);
+          offs++;
         }
-        else
-          addr = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr));
-        instr = MAKE_INSTR(API_BC_INSTR_JMP, addr);
-        *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+
+        /* HALT */
+        instr = MAKE_INSTR(API_BC_INSTR_HALT, 0);
+        *(instr_p + offs) = BSWAP32(instr);
         offs++;
+      }
+      else
+      {
+        if(smod != API_BC_XFER_RUN_EXT)
+        {
+          /* Wait for Next Minor Frame Time slot */
+          instr = MAKE_INSTR(API_BC_INSTR_WMFT, 0);
+          *(instr_p + offs) = BSWAP32(instr);
+          offs++;
+        }
+      }
+    }
+  }
+
+
+  list->cnt = offs;
+
+  return API_OK;
+
+} /* end: api_bc_mframe_build */
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_MODE               */
+/*                                                                           */
+/*   Author : Rolf Heitzmann           Project   : API1553-DS                */
+/*                                                                           */
+/*   Source : C                        Tools     : PC/AT; Norton Editor;     */
+/*                                                 CYGNUS, GNU-C, As, and LD */
+/*                                                 IDT-C 5.1 Toolkit         */
+/*---------------------------------------------------------------------------*/
+/*   Create :09.03.00   Update : 28.08.02                                    */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : API1553T BC Start Mode (Immed./Ext Trg./DBA) [smod],       */
+/*                API1553T BC mode (Cyclic/n times execution) [cnt],         */
+/*                API1553T BC minor frame time in usec [ftime]               */
+/*                                                                           */
+/*    Outputs   :                                                            */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the the BIU programming for 'API_BC_START'       */
+/*    instruction.                                                           */
+/*                                                                           */
+/*****************************************************************************/
+
+static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_WORD ftime, L_WORD *major_frame, L_WORD *minor_frames)
+{
+  struct ty_api_bc_mframe_list *list;
+  L_WORD offs, instr;
+  short i, j, k, l;
+  WORD tmpw;
+  BYTE srvw_hash[ API_BC_SRVW_HASH_SIZE ];
+
+  /* Init Globals */
+  p_api_dev->bc_bh_def.bid = 0;
+  p_api_dev->bc_bh_def.sid = 0;
+  p_api_dev->bc_bh_def.eid = 0;
+  p_api_dev->bc_bh_def.nbufs = 0;
+  p_api_dev->bc_bh_def.hid_addr = 0L;
+  p_api_dev->bc_bh_def.bid_addr = 0L;
+  p_api_dev->bc_bh_def.sid_addr = 0L;
+  p_api_dev->bc_bh_def.eid_addr = 0L;
+
+  /* Init Globals */
+  p_api_dev->bc_xfer_dsp.cw1 = 0x0000;
+  p_api_dev->bc_xfer_dsp.st1 = 0xFFFF;
+  p_api_dev->bc_xfer_dsp.cw2 = 0x0000;
+  p_api_dev->bc_xfer_dsp.st2 = 0xFFFF;
+  p_api_dev->bc_xfer_dsp.cur_bid = 0x0000;
+  p_api_dev->bc_xfer_dsp.cur_brw = 0x0000;
+  p_api_dev->bc_xfer_dsp.cur_buf = 0L;
+  p_api_dev->bc_xfer_dsp.cur_ttag = 0L;
+  p_api_dev->bc_xfer_dsp.msg_cnt = 0L;
+  p_api_dev->bc_xfer_dsp.err_cnt = 0L;
+
+  /* Clear Global BC Message and Error Counter */
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].msg_cnt = 0L;
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].err_cnt = 0L;
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].hip = 0L;
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].mfc = 0L;
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].res1 = 0L;
+  p_api_dev->bc_status_cnt[ p_api_dev->biu ].res2 = 0L;
+  api_io_bc_glb_cnt_ini(p_api_dev);
+
+
+  /* Service Request and Vector Word handling */
+  for(j = 0; j < MAX_API_BC_SRVW_RT; j++)
+  {
+    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].xid = 0x0000;
+    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].lvw = 0x0000;
+    p_api_dev->bc_srvw_rt_dsp[ p_api_dev->biu ].rt[ j ].src = 0L;
+  }
+
+  p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].cnt = 0;
+  for(j = 0; j < MAX_API_BC_XFER_IN_FRAME; j++)
+    p_api_dev->bc_srvw_subframe[ p_api_dev->biu ].instr[ j ] = 0L;
+
+  if(p_api_dev->bc_srvw_con[ p_api_dev->biu ] == API_ON)
+  {
+    memset(srvw_hash, 0, sizeof(srvw_hash) );
+
+    /* Init first subtable instruction to RETURN */
+    *(p_api_dev->bc_lip_instr_p[ p_api_dev->biu ] + 0) = BSWAP32(MAKE_INSTR(API_BC_INSTR_RET, 0) );
 
-        /* Skip + Interrupt if non-cyclic */
-        if(cnt != 0)
+    /* Seach on multiple Transaction types */
+    for(k = 0; k < MAX_API_BC_SRVW_RT; k++)
+    {
+      for(l = 0; l < MAX_API_BC_SRVW_SAMID; l++)
+      {
+
+        /* Put all TX Transactions in subtable */
+        tmpw = p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_TX ].ta[ k ].sa_mid[ l ].xid;
+        if(tmpw != 0)
         {
-          tmpl = 0x02000001L;
-          instr = MAKE_INSTR(API_BC_INSTR_SKIP, tmpl);
-          *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
-          p_api_dev->bc_setup[ p_api_dev->biu ].sinst = offs * 4+ API_GLB_TSWPTR_TO_GLOBREL(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ]);
-          offs++;
+          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_TX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
+          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_DELETE_TX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
+          api_bc_srvw_subframe_add(p_api_dev, srvw_hash, (WORD)(tmpw & 0x7FFF) );
         }
 
-        /* HALT */
-        instr = MAKE_INSTR(API_BC_INSTR_HALT, 0);
-        *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
-        offs++;
-      }
-      else
-      {
-        if(smod != API_BC_XFER_RUN_EXT)
+        /* Put all RX Transactions in subtable */
+        tmpw = p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_RX ].ta[ k ].sa_mid[ l ].xid;
+        if(tmpw != 0)
         {
-          /* Wait for Next Minor Frame Time slot */
-          instr = MAKE_INSTR(API_BC_INSTR_WMFT, 0);
-          *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
-          offs++;
+          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_MULTIP_RX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
+          p_api_dev->bc_srvw_tab[ p_api_dev->biu ].t[ API_BC_SRVW_ID_DELETE_RX ].ta[ k ].sa_mid[ l ].xid &= 0x7FFF;
+          api_bc_srvw_subframe_add(p_api_dev, srvw_hash, (WORD)(tmpw & 0x7FFF) );
         }
       }
     }
   }
 
+  /* Clear BC Transfer Message and Error Counter locations */
+  for(i = 0; (unsigned)i < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_xfer_desc; i++)
+    api_io_bc_xfer_desc_tc_ini(p_api_dev, (WORD)i);
+
+  offs = 0L;
+
+  /* Store Address of Stop Instruction */
+  p_api_dev->bc_setup[ p_api_dev->biu ].sinst = 0L;
+
+  /* Insert Wait for External Trigger Event instruction */
+  if(smod == API_BC_XFER_RUN_ETR)
+  {
+    instr = MAKE_INSTR(API_BC_INSTR_WTRG, 0);
+    *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ]) = BSWAP32(instr | 0x02); /* Sync Start */
+    offs++;
+
+    /* Insert a BC Branch Instruction that raises an interrupt, when BC is triggered */
+    instr = MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L);
+    *(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs) = BSWAP32(instr);
+
+    /* Store address of BC Trigger Instr */
+    p_api_dev->bc_setup[p_api_dev->biu].bc_triggered_inst = API_GLB_TSWPTR_TO_PBIREL((uintptr_t)(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + offs));
+    
+    offs++;
+  }
+
+  /* Clear return value for  Major Frame Start Address */
+  *major_frame = API_GLB_TSWPTR_TO_GLOBREL(p_api_dev->bc_hip_instr_p[ p_api_dev->biu ]);
+
+  /*** Major Frame ***/
+  list = &p_api_dev->bc_frame_swap[ p_api_dev->biu ].active;
+  list->first   = 0;
+  list->mod_cnt = 0;
+
+  api_bc_timing_reset(p_api_dev, p_api_dev->biu);
+
+  /* With external trigger the jump back leaves out 'wait for external trigger' and 'bc start interrupt' instruction */
+  if(api_bc_mframe_build(p_api_dev, smod, cnt, offs, (smod == API_BC_XFER_RUN_ETR) ? 2 : 0,
+                         p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr / 4, minor_frames, list) != API_OK)
+  {
+    *major_frame = 0xFFFFFFFFL; /* indicate ERRROR */
+    return API_ERR;
+  }
+
+  p_api_dev->bc_setup[ p_api_dev->biu ].sinst = list->sinst;
+
+  /* The list may now be replaced by api_bc_frame_swap */
+  p_api_dev->bc_frame_swap[ p_api_dev->biu ].ena     = API_ON;
+  p_api_dev->bc_frame_swap[ p_api_dev->biu ].pending = API_OFF;
+
   p_api_dev->bc_setup[ p_api_dev->biu ].smod = smod;
   p_api_dev->bc_setup[ p_api_dev->biu ].cnt = cnt;
   p_api_dev->bc_setup[ p_api_dev->biu ].ftime = ftime;
@@ -1409,13 +1764,6 @@ static BYTE api_bc_program_biu(TY_API_DEV *p_api_dev, BYTE smod, L_WORD cnt, L_W
 
   /* Set High Priority BC Instruction List Pointer */
   (*p_api_dev->cb_p[ p_api_dev->biu ]).hip = BSWAP32(API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr));
-    
-  /* Check on available size */
-  if(offs >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr / 4)
-  {
-    *major_frame = 0xFFFFFFFFL; /* indicate ERRROR */
-    return API_ERR;
-  }
 
   return API_OK;
 
@@ -1689,6 +2037,7 @@ static L_WORD api_bc_start(TY_API_DEV *p_api_dev, L_WORD smod, L_WORD cnt, L_WOR
                 break;
 
             case API_BC_XFER_RUN_TBL:
+                api_bc_frame_swap_reset(p_api_dev, p_api_dev->biu);
                 api_bc_program_biu_tbl(p_api_dev, (BYTE)smod, saddr, cnt, ftime);
                 p_api_dev->bc_status[ p_api_dev->biu ] = API_BUSY;
                 p_api_dev->bc_trg_status[ p_api_dev->biu ] = API_HALT;
@@ -1699,6 +2048,7 @@ static L_WORD api_bc_start(TY_API_DEV *p_api_dev, L_WORD smod, L_WORD cnt, L_WOR
                 break;
 
             case API_BC_XFER_RUN_TBL_DBA:
+                api_bc_frame_swap_reset(p_api_dev, p_api_dev->biu);
                 api_bc_program_biu_tbl(p_api_dev, (BYTE)smod, saddr, cnt, ftime);
                 p_api_dev->bc_status[ p_api_dev->biu ] = API_HALT;
                 p_api_dev->bc_trg_status[ p_api_dev->biu ] = API_HALT;
@@ -1763,6 +2113,10 @@ static L_WORD api_bc_halt(TY_API_DEV *p_api_dev)
     p_api_dev->bc_trg_status[ p_api_dev->biu ] = API_HALT;
     p_api_dev->bc_dbc_start_status[ p_api_dev->biu ] = API_HALT;
 
+    /* Queued acyclic bursts are dropped */
+    api_bc_acyc_queue_reset(p_api_dev, p_api_dev->biu);
+    api_bc_frame_swap_reset(p_api_dev, p_api_dev->biu);
+
     return 0;
 } /* end: api_bc_halt */
 
@@ -1798,6 +2152,186 @@ L_WORD api_bc_halt_cmd( TY_API_DEV * p_api_dev, TY_MIL_COM * in, TY_MIL_COM_ACK
     return api_bc_halt( p_api_dev );
 }
 
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_FRAME_SWAP         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : none                                                       */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_FRAME_SWAP' instruction to replace   */
+/*    the Major Frame of the running BC with the Minor and Major Frames      */
+/*    currently defined. The new list is written to the unused part of the   */
+/*    BC Instr. List area and entered by patching the JMP at the end of the  */
+/*    running Major Frame, so the BC switches at a Major Frame boundary.     */
+/*    The SKIP instruction at the start of the new list signals the switch.  */
+/*                                                                           */
+/*****************************************************************************/
+
+/* Writes the shadow list, with copies of the modify descriptors in mod, and enters it at the next Major Frame boundary */
+static L_WORD api_bc_frame_swap_start(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODIFY_DEF_ENTRY *mod, L_WORD mod_cnt)
+{
+  struct ty_api_bc_frame_swap *swap = &p_api_dev->bc_frame_swap[ p_api_dev->biu ];
+  L_WORD hip_base = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr;
+  L_WORD *list_p;
+  L_WORD *jmp_p;
+  L_WORD size, used, addr, i, k;
+
+  if(swap->ena != API_ON)
+    return API_ERR_BC_NOT_AVAILABLE;
+
+  /* The previous list may still be executed */
+  if(swap->pending == API_ON)
+    return API_ERR_AGAIN;
+
+  if(p_api_dev->bc_setup[ p_api_dev->biu ].mframe.cnt == 0)
+    return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+  /* Use the space behind or in front of the running list, modify descriptors are located at the end of the area */
+  if(swap->active.first == 0)
+  {
+    size = p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr / 4;
+    used = swap->active.cnt + swap->active.mod_cnt * 6 + swap->modify_ids * 6;
+
+    if(used >= size)
+      return API_ERR_NO_SPACE_LEFT;
+
+    swap->shadow.first = swap->active.cnt + swap->active.mod_cnt * 6;
+    size -= used;
+  }
+  else
+  {
+    swap->shadow.first = 0;
+    size = swap->active.first;
+  }
+
+  /* An id listed twice uses one descriptor copy */
+  swap->shadow.mod_cnt = 0;
+
+  for(i = 0; i < mod_cnt; i++)
+  {
+    for(k = 0; (k < swap->shadow.mod_cnt) && (swap->shadow.mod_id[ k ] != mod[ i ].id); k++)
+      ;
+
+    if(k == swap->shadow.mod_cnt)
+      swap->shadow.mod_id[ swap->shadow.mod_cnt++ ] = mod[ i ].id;
+  }
+
+  list_p = p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + swap->shadow.first;
+
+  /* SKIP to the next instruction with interrupt is only executed when entering the list */
+  *list_p = BSWAP32(MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L) );
+
+  if(api_bc_mframe_build(p_api_dev, (BYTE)p_api_dev->bc_setup[ p_api_dev->biu ].smod, p_api_dev->bc_setup[ p_api_dev->biu ].cnt,
+                         1, 1, size, NULL, &swap->shadow) != API_OK)
+    return API_ERR_NO_SPACE_LEFT;
+
+  UsbSynchronizeMemoryArea(p_api_dev, API_GLB_MEM_ADDR_REL(list_p), swap->shadow.cnt * 4, Out);
+
+  /* In list order, so the last entry of an id is the one used */
+  for(i = 0; i < mod_cnt; i++)
+  {
+    for(k = 0; swap->shadow.mod_id[ k ] != mod[ i ].id; k++)
+      ;
+
+    api_io_bc_modify_write(p_api_dev, hip_base + (swap->shadow.mod_first + k * 6) * 4L, &mod[ i ].modify);
+  }
+
+  swap->marker  = API_GLB_TSWPTR_TO_PBIREL((uintptr_t)list_p);
+  swap->pending = API_ON;
+
+  /* Redirect the JMP back to the running Major Frame start */
+  addr  = (API_GLB_GLOBREL_TO_PBIREL(p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr)) + swap->shadow.first * 4L;
+  jmp_p = p_api_dev->bc_hip_instr_p[ p_api_dev->biu ] + swap->active.first + swap->active.jmp;
+
+  *jmp_p = BSWAP32(MAKE_INSTR(API_BC_INSTR_JMP, addr) );
+
+  UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(jmp_p), Out);
+
+  return 0;
+}
+
+L_WORD api_bc_frame_swap(TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_ACK * out )
+{
+  return api_bc_frame_swap_start(p_api_dev, NULL, 0);
+
+} /* end: api_bc_frame_swap */
+
+void api_bc_frame_swap_reset(TY_API_DEV *p_api_dev, short biu)
+{
+  p_api_dev->bc_frame_swap[ biu ].ena     = API_OFF;
+  p_api_dev->bc_frame_swap[ biu ].pending = API_OFF;
+
+  /* Timing monitor markers only exist in lists built by api_bc_program_biu */
+  ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ biu ]);
+
+  if(p_api_dev->bc_timing[ biu ] != NULL)
+  {
+    p_api_dev->bc_timing[ biu ]->frame_valid   = API_OFF;
+    p_api_dev->bc_timing[ biu ]->list[ 0 ].cnt = 0;
+    p_api_dev->bc_timing[ biu ]->list[ 1 ].cnt = 0;
+  }
+
+  ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ biu ]);
+}
+
+/* Called from the BC skip interrupt. Makes the shadow list the running one if addr is its starting SKIP */
+void api_bc_frame_swap_skip(TY_API_DEV *p_api_dev, short biu, L_WORD addr)
+{
+  struct ty_api_bc_frame_swap *swap = &p_api_dev->bc_frame_swap[ biu ];
+  struct ty_api_bc_timing *timing;
+  struct ty_api_bc_timing_list tlist;
+  L_WORD hip_end = p_api_dev->glb_mem.biu[ biu ].base.bc_hip_instr + p_api_dev->glb_mem.biu[ biu ].size.bc_hip_instr;
+  L_WORD *src_p;
+  L_WORD *dst_p;
+  L_WORD i, k;
+
+  if( (swap->pending != API_ON) || (swap->marker != addr) )
+    return;
+
+  swap->active = swap->shadow;
+  p_api_dev->bc_setup[ biu ].sinst = swap->active.sinst;
+
+  ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ biu ]);
+
+  timing = p_api_dev->bc_timing[ biu ];
+
+  if(timing != NULL)
+  {
+    /* The last Minor Frame of the previous list is followed by the first one of the new list */
+    if(timing->frame_pos == timing->list[ 0 ].cnt - 1)
+      timing->frame_pos = timing->list[ 1 ].cnt - 1;
+    else
+      timing->frame_valid = API_OFF;
+
+    tlist             = timing->list[ 0 ];
+    timing->list[ 0 ] = timing->list[ 1 ];
+    timing->list[ 1 ] = tlist;
+  }
+
+  ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ biu ]);
+
+  /* The original descriptors are no longer used by the running list, update them for the next list */
+  for(k = 0; k < swap->active.mod_cnt; k++)
+  {
+    src_p = p_api_dev->bc_hip_instr_p[ biu ] + swap->active.mod_first + k * 6;
+    dst_p = (L_WORD*)API_GLB_GLOBREL_TO_TSWPTR(hip_end - swap->active.mod_id[ k ] * 6 * sizeof(L_WORD));
+
+    for(i = 0; i < 6; i++)
+      dst_p[ i ] = src_p[ i ];
+
+    UsbSynchronizeMemoryArea(p_api_dev, API_GLB_MEM_ADDR_REL(dst_p), 6 * sizeof(L_WORD), Out);
+  }
+
+  swap->pending = API_OFF;
+}
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BC                   Submodule : API_BC_STATUS_READ        */
@@ -1872,6 +2406,216 @@ L_WORD api_bc_status_read(TY_API_DEV *p_api_dev)
 
 } /* end: api_bc_status_read */
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_TIMING             */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Timing monitor control [con]                               */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_TIMING_CONTROL' instruction to       */
+/*    enable, disable or reset the on-target BC schedule timing monitor.     */
+/*    While enabled, each Minor Frame built on BC start or frame swap gets   */
+/*    a SKIP with interrupt behind its first transfer. The interrupt handler */
+/*    takes the Minor Frame start from the time tag of this transfer and     */
+/*    the transfer offsets from the time tags of interrupting transfers.     */
+/*    The interrupt handler updates the monitor while the BC is running, so  */
+/*    it can only be disabled or reset while the BC is halted. Interrupts    */
+/*    still pending after the halt are serialized by bc_timing_lock.         */
+/*    On enable the overrun tolerance is set, at least the time tag          */
+/*    resolution of API_BC_TIMING_TOLERANCE_MIN us.                          */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_bc_timing_init(struct ty_api_bc_timing *timing)
+{
+    timing->frame_valid   = API_OFF;
+    timing->frame_pos     = 0;
+    timing->frame_start   = 0;
+    timing->frame_overrun = 0;
+
+    memset(&timing->interval, 0, sizeof(timing->interval));
+    memset(timing->xfer, 0, timing->xfer_cnt * sizeof(struct ty_api_bc_timing_xfer));
+}
+
+void api_bc_timing_reset(TY_API_DEV *p_api_dev, short biu)
+{
+    ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ biu ]);
+
+    if( p_api_dev->bc_timing[ biu ] != NULL )
+        api_bc_timing_init(p_api_dev->bc_timing[ biu ]);
+
+    ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ biu ]);
+}
+
+void api_bc_timing_free(TY_API_DEV *p_api_dev, short biu)
+{
+    struct ty_api_bc_timing *timing;
+
+    /* Unpublish first, so that the interrupt handler can no longer use the monitor */
+    ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ biu ]);
+
+    timing = p_api_dev->bc_timing[ biu ];
+    p_api_dev->bc_timing[ biu ] = NULL;
+
+    ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ biu ]);
+
+    if( timing != NULL )
+        FREE(timing);
+}
+
+L_WORD api_bc_timing_control(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_TIMING_CONTROL_INPUT * in, TY_MIL_COM_ACK * out )
+{
+    struct ty_api_bc_timing *timing;
+    L_WORD tolerance;
+    L_WORD xfer_cnt;
+
+    if( (in->con != API_BC_TIMING_ENA) && (p_api_dev->bc_status[ p_api_dev->biu ] == API_BUSY) )
+        return API_ERR_BC_SIMULATION_ACTIVE;
+
+    switch( in->con )
+    {
+    case API_BC_TIMING_DIS:
+        api_bc_timing_free(p_api_dev, p_api_dev->biu);
+        break;
+
+    case API_BC_TIMING_ENA:
+        tolerance = (in->tolerance < API_BC_TIMING_TOLERANCE_MIN) ? API_BC_TIMING_TOLERANCE_MIN : in->tolerance;
+
+        if( p_api_dev->bc_timing[ p_api_dev->biu ] != NULL )
+        {
+            /* An enabled monitor keeps its statistics and only takes the new tolerance */
+            ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+            p_api_dev->bc_timing[ p_api_dev->biu ]->tolerance = tolerance;
+            ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+            break;
+        }
+
+        /* Transfer statistics and the markers of both lists follow the structure */
+        xfer_cnt = p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_xfer_desc;
+
+        timing = (struct ty_api_bc_timing *) MALLOC(sizeof(struct ty_api_bc_timing)
+                                                    + xfer_cnt * sizeof(struct ty_api_bc_timing_xfer)
+                                                    + 2 * MAX_API_BC_FRAME_IN_MFRAME * sizeof(struct ty_api_bc_timing_marker));
+
+        if( timing == NULL )
+            return API_ERR_MALLOC_FAILED;
+
+        timing->xfer_cnt         = xfer_cnt;
+        timing->xfer             = (struct ty_api_bc_timing_xfer *)(timing + 1);
+        timing->list[ 0 ].cnt    = 0;
+        timing->list[ 0 ].marker = (struct ty_api_bc_timing_marker *)(timing->xfer + xfer_cnt);
+        timing->list[ 1 ].cnt    = 0;
+        timing->list[ 1 ].marker = timing->list[ 0 ].marker + MAX_API_BC_FRAME_IN_MFRAME;
+        timing->tolerance        = tolerance;
+
+        api_bc_timing_init(timing);
+
+        ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+        p_api_dev->bc_timing[ p_api_dev->biu ] = timing;
+        ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+        break;
+
+    case API_BC_TIMING_RESET:
+        api_bc_timing_reset(p_api_dev, p_api_dev->biu);
+        break;
+
+    default:
+        return API_ERR_INVALID_CON;
+    }
+
+    return 0;
+} /* end: api_bc_timing_control */
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_STATUS_TIMING_READ */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : First Transfer ID [xid_first]                              */
+/*                Number of Transfers [xid_count]                            */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_STATUS_TIMING_READ' instruction to   */
+/*    read the BC status as 'API_BC_STATUS_READ' does, extended by the Minor */
+/*    Frame timing and the per transfer timing of the given range of IDs.    */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_bc_timing_time_read(struct ty_api_bc_timing_time *p_time, TY_MIL_COM_LS_BC_TIMING_TIME *p_out)
+{
+    p_out->count = p_time->cnt;
+    p_out->min   = p_time->min;
+    p_out->max   = p_time->max;
+    p_out->mean  = p_time->cnt ? (AiUInt32)(p_time->sum / p_time->cnt) : 0;
+}
+
+L_WORD api_bc_status_timing_read(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_STATUS_TIMING_READ_INPUT * in, TY_MIL_COM_LS_BC_STATUS_TIMING_READ_OUTPUT * out )
+{
+    struct ty_api_bc_timing *timing = p_api_dev->bc_timing[ p_api_dev->biu ];
+    TY_MIL_COM_LS_BC_TIMING_TIME offset;
+    L_WORD ack_size;
+    L_WORD xid;
+    L_WORD *data;
+
+    /* Commands are serialized, so the monitor can not be freed while this command runs */
+    if( timing == NULL )
+        return API_ERR_BC_NOT_AVAILABLE;
+
+    if( (in->xid_count == 0) || (in->xid_count > MIL_COM_LS_BC_TIMING_MAX_XFER) || (in->xid_first >= timing->xfer_cnt) || (in->xid_count > (timing->xfer_cnt - in->xid_first)) )
+        return API_ERR_XID_NOT_IN_RANGE;
+
+    ack_size = MIL_COM_LS_BC_STATUS_TIMING_READ_ACK_SIZE(in->xid_count);
+
+    if( ack_size > in->cmd.ulExpectedAckSize )
+        return API_ERR_WRONG_ACK_SIZE;
+
+    api_bc_status_read( p_api_dev );
+
+    /* Take a consistent snapshot of the values the interrupt handler updates */
+    ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+
+    out->status = p_api_dev->bc_status_dsp[ p_api_dev->biu ].status;
+    out->hxfer  = p_api_dev->bc_status_dsp[ p_api_dev->biu ].hxfer;
+    out->bc_mc  = p_api_dev->bc_status_cnt[ p_api_dev->biu ].msg_cnt;
+    out->bc_ec  = p_api_dev->bc_status_cnt[ p_api_dev->biu ].err_cnt;
+    out->hip    = p_api_dev->bc_status_cnt[ p_api_dev->biu ].hip;
+    out->mfc    = p_api_dev->bc_status_cnt[ p_api_dev->biu ].mfc;
+
+    out->ftime         = p_api_dev->bc_setup[ p_api_dev->biu ].ftime;
+    out->frame_overrun = timing->frame_overrun;
+    api_bc_timing_time_read(&timing->interval, &out->interval);
+
+    out->count = in->xid_count;
+    data       = out->data;
+
+    for( xid = in->xid_first; xid < in->xid_first + in->xid_count; xid++ )
+    {
+        api_bc_timing_time_read(&timing->xfer[ xid ].offset, &offset);
+
+        *data++ = offset.count;
+        *data++ = offset.min;
+        *data++ = offset.max;
+        *data++ = offset.mean;
+        *data++ = timing->xfer[ xid ].overrun;
+    }
+
+    ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ p_api_dev->biu ]);
+
+    out->xAck.ulSize = ack_size;
+
+    return 0;
+} /* end: api_bc_status_timing_read */
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BC                   Submodule : API_BC_XFER_READ          */
@@ -1921,12 +2665,14 @@ L_WORD api_bc_xfer_read_cmd(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_XFER_READ_IN
 
 L_WORD api_bc_xfer_read(TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode)
 {
-    L_WORD hid, addr, tmpl, sqid;
-    L_WORD ul_SqAddr;
-    L_WORD ul_CurrentBufIndex = 0;
-    L_WORD sq_mode; /* Status Queue Mode */
-    L_WORD bq_mode; /* Buffer Queue Mode */
-    L_WORD ul_qsize; /* Queue Size */
+    return api_bc_xfer_read_internal( p_api_dev, xid, clr_mode, API_ON );
+}
+
+
+/* Checks that xid is in range and references a valid buffer header, returns its ID in hid */
+static L_WORD api_bc_xfer_read_check(TY_API_DEV *p_api_dev, WORD xid, L_WORD *hid)
+{
+    L_WORD addr;
 
     if( (xid == 0) || (xid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_xfer_desc) )
     {
@@ -1938,17 +2684,38 @@ L_WORD api_bc_xfer_read(TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode)
     /* Calculate Buffer Header ID */
     addr = ul_ConvertGRAMPtrToTSWPtr( p_api_dev, p_api_dev->biu, (*p_api_dev->bc_xfer_desc_p[ p_api_dev->biu ])[ xid ].bhd_ptr & BSWAP32(0x03ffffffUL) );
     addr -= p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_bh_area;
-    hid = addr / MAX_API_BC_BH_DESC_SIZE;
+    *hid = addr / MAX_API_BC_BH_DESC_SIZE;
 
 
-    if(hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area)
+    if(*hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area)
     {
-        PRINTF2("ERROR: HID NOT IN RANGE (0..%d..%d)\n\r", hid, p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area);
+        PRINTF2("ERROR: HID NOT IN RANGE (0..%d..%d)\n\r", *hid, p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.bc_bh_area);
         return API_ERR_INVALID_HID;
     }
 
+    return 0;
+}
 
-    if(p_api_dev->bc_status[p_api_dev->biu] == API_BUSY)
+
+/* Reads the transfer status into p_api_dev->bc_xfer_dsp.
+   The transfer is synchronized from the USB device if sync is API_ON. */
+L_WORD api_bc_xfer_read_internal(TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode, BYTE sync)
+{
+    L_WORD hid, addr, tmpl, sqid;
+    L_WORD ul_SqAddr;
+    L_WORD ul_CurrentBufIndex = 0;
+    L_WORD sq_mode; /* Status Queue Mode */
+    L_WORD bq_mode; /* Buffer Queue Mode */
+    L_WORD ul_qsize; /* Queue Size */
+    L_WORD retval;
+
+    retval = api_bc_xfer_read_check( p_api_dev, xid, &hid );
+
+    if( retval != 0 )
+        return retval;
+
+
+    if( (sync == API_ON) && (p_api_dev->bc_status[p_api_dev->biu] == API_BUSY) )
     {
         UsbSynchronizeTransferByID(p_api_dev, p_api_dev->biu, xid, FALSE, In);
     }
@@ -2074,6 +2841,92 @@ L_WORD api_bc_xfer_read(TY_API_DEV *p_api_dev, WORD xid, WORD clr_mode)
 
 } /* end: api_bc_xfer_read */
 
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_XFER_READ_BULK     */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : First BC Transfer Identifier of a range or 0 [xid_first]   */
+/*                Number of BC Transfers [count]                             */
+/*                Reset Buffer Status Bits after Command call [clr]          */
+/*                BC Transfer Identifier list, if xid_first is 0 [xid]       */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_XFER_READ_BULK' instruction to read  */
+/*    message/error counter, last status words, current buffer and time tag  */
+/*    of a range or a list of BC Transfers with one command. The states are  */
+/*    returned in request order. All transfers are checked before the first  */
+/*    one is read, so no buffer status is reset if the request fails.        */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bc_xfer_read_bulk(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_XFER_READ_BULK_INPUT * in, TY_MIL_COM_LS_BC_XFER_READ_BULK_OUTPUT * out )
+{
+    L_WORD retval;
+    L_WORD ack_size;
+    L_WORD xid, hid, i;
+    BYTE   sync = API_ON;
+
+    if( (in->count == 0) || (in->count > MIL_COM_LS_BC_XFER_READ_BULK_MAX) )
+        return API_ERR_INVALID_ID;
+
+    if( (in->xid_first == 0) && (in->cmd.ulSize < MIL_COM_LS_BC_XFER_READ_BULK_INPUT_MINIMUM_SIZE + in->count * sizeof(AiUInt32)) )
+        return API_ERR_WRONG_CMD_SIZE;
+
+    ack_size = MIL_COM_LS_BC_XFER_READ_BULK_ACK_SIZE(in->count);
+
+    if( ack_size > in->cmd.ulExpectedAckSize )
+        return API_ERR_WRONG_ACK_SIZE;
+
+    if( (in->count >= API_BC_XFER_READ_BULK_SYNC_ALL) && (p_api_dev->bc_status[p_api_dev->biu] == API_BUSY) )
+    {
+        /* Synchronize all transfers at once instead of searching each one */
+        UsbSynchronizeTransfers(p_api_dev, p_api_dev->biu, In);
+        sync = API_OFF;
+    }
+
+    /* Check all transfers first, so no counters are cleared if the request fails */
+    for( i = 0; i < in->count; i++ )
+    {
+        xid = in->xid_first ? (in->xid_first + i) : in->xid[ i ];
+
+        if( xid > 0xFFFF )
+            return API_ERR_INVALID_ID;
+
+        retval = api_bc_xfer_read_check( p_api_dev, (WORD)xid, &hid );
+
+        if( retval != 0 )
+            return retval;
+    }
+
+    for( i = 0; i < in->count; i++ )
+    {
+        xid = in->xid_first ? (in->xid_first + i) : in->xid[ i ];
+
+        retval = api_bc_xfer_read_internal( p_api_dev, (WORD)xid, (WORD)in->clr, sync );
+
+        if( retval != 0 )
+            return retval;
+
+        out->xfer[ i ].msg_cnt = p_api_dev->bc_xfer_dsp.msg_cnt;
+        out->xfer[ i ].err_cnt = p_api_dev->bc_xfer_dsp.err_cnt;
+        out->xfer[ i ].st2_st1 = ((L_WORD)p_api_dev->bc_xfer_dsp.st2 << 16) | p_api_dev->bc_xfer_dsp.st1;
+        out->xfer[ i ].brw_bid = ((L_WORD)p_api_dev->bc_xfer_dsp.cur_brw << 16) | (p_api_dev->bc_xfer_dsp.cur_bid & 0xFFFF);
+        out->xfer[ i ].ttag    = p_api_dev->bc_xfer_dsp.cur_ttag;
+    }
+
+    out->count       = in->count;
+    out->xAck.ulSize = ack_size;
+
+    return 0;
+
+} /* end: api_bc_xfer_read_bulk */
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BC                   Submodule : API_BC_SRVW_REQ_READ      */
@@ -2160,45 +3013,31 @@ L_WORD api_bc_srvw_req_con(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_SRVW_REQ_CON_
 
 /*****************************************************************************/
 /*                                                                           */
-/*   Module : API_BC                   Submodule : API_BC_ACYC_MSG_PREP      */
-/*                                                                           */
-/*   Author : Marco Motz               Project   : API1553-DS                */
+/*   Module : API_BC                   Submodule : API_BC_ACYC_INSTR_WRITE   */
 /*                                                                           */
-/*   Source : C                        Tools     : PC/AT; Norton Editor;     */
-/*                                                 CYGNUS, GNU-C, As, and LD */
-/*                                                 IDT-C 5.1 Toolkit         */
-/*---------------------------------------------------------------------------*/
-/*   Create : 01.05.98   Update : 11.12.00                                   */
 /*---------------------------------------------------------------------------*/
 /*    Descriptions                                                           */
 /*    ------------                                                           */
-/*    Inputs    : Reserved [res],                                            */
-/*                Acyclic transfers in Minor Frame [xfer_cnt],               */
-/*                Instruction Code and Data [instr]                          */
+/*    Inputs    : Acyclic Instruction List to write [list],                  */
+/*                Instruction Code and Data [data],                          */
+/*                Acyclic transfers [p_xfer_cnt]                             */
 /*                                                                           */
-/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*    Outputs   : Number of written instructions [p_xfer_cnt]                */
 /*                                                                           */
 /*    Description :                                                          */
+/*    This function converts the acyclic instructions of the host into BC    */
+/*    instructions and writes them to the given list. HS and EFEX transfers  */
+/*    may occupy two list entries, so the number of written instructions is  */
+/*    returned in p_xfer_cnt. No RET instruction is appended.                */
 /*                                                                           */
 /*****************************************************************************/
 
-L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_INPUT * in, TY_MIL_COM_ACK *out )
+static L_WORD api_bc_acyc_instr_write(TY_API_DEV *p_api_dev, L_WORD *list, TY_BC_INSTRUCTION *data, L_WORD *p_xfer_cnt)
 {
   L_WORD i, input_index, flag;
   L_WORD instr, addr;
   WORD op, dw, dw1;
-  TY_BC_INSTRUCTION *data = in->data;
-  L_WORD xfer_cnt = in->xfer_cnt;
-
-  if( (xfer_cnt == 0) || (xfer_cnt >= MAX_API_BC_ACYC_INSTR) )
-      return API_ERR_FRAME_CNT_NOT_IN_RANGE;
-
-    /* Clear BC Acyclic Instruction List */
-    instr = MAKE_INSTR(API_BC_INSTR_HALT, 0);
-    for(i = 0; i < MAX_API_BC_ACYC_INSTR; i++)
-    {
-      *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
-    }
+  L_WORD xfer_cnt = *p_xfer_cnt;
 
     /* Copy and check BC Transfer IDs */
     for(i = 0, input_index = 0, flag = API_OK; (i < xfer_cnt) && (flag == API_OK); i++, input_index++)
@@ -2227,7 +3066,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                 instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
 
                 /* Write to Instruction List */
-                *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                *(list + i) = BSWAP32(instr);
 
                 if( ( (x_api39_bc_xfer_desc[ p_api_dev->hs_stream ][ dw ].uw_type & API39_BC_XFER_TYPE_MASK) == API39_BC_XFER_TYPE_HSRTRT) || ( ( (x_api39_bc_xfer_desc[ p_api_dev->hs_stream ][ dw ].uw_type &API39_BC_XFER_TYPE_MASK) == API39_BC_XFER_TYPE_HSRTBR) ) )
                 {
@@ -2244,7 +3083,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                   instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
 
                   /* Write to Instruction List */
-                  *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                  *(list + i) = BSWAP32(instr);
                 }
               }
               else
@@ -2268,7 +3107,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                     instr = MAKE_INSTR(API_BC_INSTR_XFER_EFEX, dw);
 
                     /* Write to Instruction List */
-                    *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                    *(list + i) = BSWAP32(instr);
                   }
                   else
                   {
@@ -2282,7 +3121,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                     instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
 
                     /* Write to Instruction List */
-                    *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                    *(list + i) = BSWAP32(instr);
 
                     if( ( (x_api39_bc_xfer_desc[ p_api_dev->hs_stream ][ dw ].uw_type & API39_BC_XFER_TYPE_MASK) == APIEF_BC_XFER_TYPE_EERTRT) ||
                         ( (x_api39_bc_xfer_desc[ p_api_dev->hs_stream ][ dw ].uw_type &API39_BC_XFER_TYPE_MASK) == APIEF_BC_XFER_TYPE_E_RTBR) ||
@@ -2299,7 +3138,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                       /* Opcode */
                       instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
                       /* Write to Instruction List */
-                      *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                      *(list + i) = BSWAP32(instr);
 
                     }
                   }
@@ -2323,7 +3162,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                 instr = MAKE_INSTR(API_BC_INSTR_XFER, addr);
 
                 /* Write to Instruction List */
-                *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+                *(list + i) = BSWAP32(instr);
               }
               else
                 flag = API_ERR_XID_NOT_IN_RANGE;
@@ -2344,7 +3183,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
                 instr |= 0x02000000L;
 
               /* Write to Instruction List */
-              *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+              *(list + i) = BSWAP32(instr);
             }
             else
               flag = API_ERR_XID_NOT_IN_RANGE;
@@ -2355,7 +3194,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
             instr = MAKE_INSTR(API_BC_INSTR_WAIT, dw);
 
             /* Write to temporary Instruction List */
-            *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+            *(list + i) = BSWAP32(instr);
             break;
 
           case API_BC_INSTR_TSTR_CODE:
@@ -2364,7 +3203,7 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
             instr = MAKE_INSTR(API_BC_INSTR_STR, 0);
 
             /* Write to Instruction List */
-            *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+            *(list + i) = BSWAP32(instr);
             break;
 
 
@@ -2378,10 +3217,64 @@ L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_IN
         instr = MAKE_W2LWORD(op, dw);
 
         /* Write to Instruction List */
-        *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+        *(list + i) = BSWAP32(instr);
       }
     }
 
+    *p_xfer_cnt = xfer_cnt;
+
+    return flag;
+
+} /* end: api_bc_acyc_instr_write */
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_ACYC_MSG_PREP      */
+/*                                                                           */
+/*   Author : Marco Motz               Project   : API1553-DS                */
+/*                                                                           */
+/*   Source : C                        Tools     : PC/AT; Norton Editor;     */
+/*                                                 CYGNUS, GNU-C, As, and LD */
+/*                                                 IDT-C 5.1 Toolkit         */
+/*---------------------------------------------------------------------------*/
+/*   Create : 01.05.98   Update : 11.12.00                                   */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Reserved [res],                                            */
+/*                Acyclic transfers in Minor Frame [xfer_cnt],               */
+/*                Instruction Code and Data [instr]                          */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bc_acyc_msg_prep(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_PREP_INPUT * in, TY_MIL_COM_ACK *out )
+{
+  L_WORD i, flag;
+  L_WORD instr;
+  L_WORD xfer_cnt = in->xfer_cnt;
+
+  if( (xfer_cnt == 0) || (xfer_cnt >= MAX_API_BC_ACYC_INSTR) )
+      return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+  /* The acyclic instruction list is in use by queued bursts */
+  if( p_api_dev->bc_acyc_queue[ p_api_dev->biu ].put != p_api_dev->bc_acyc_queue[ p_api_dev->biu ].done )
+      return API_ERR_AGAIN;
+
+    /* Clear BC Acyclic Instruction List */
+    instr = MAKE_INSTR(API_BC_INSTR_HALT, 0);
+    for(i = 0; i < MAX_API_BC_ACYC_INSTR; i++)
+    {
+      *(p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + i) = BSWAP32(instr);
+    }
+
+    /* Copy and check BC Transfer IDs */
+    flag = api_bc_acyc_instr_write(p_api_dev, p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ], in->data, &xfer_cnt);
+    i    = xfer_cnt;
+
     /* Append RET instruction */
     if(flag == API_OK)
     {
@@ -2487,6 +3380,10 @@ static L_WORD api_bc_acyc_msg_send(TY_API_DEV *p_api_dev, L_WORD mode, L_WORD ti
   L_WORD instr = 0;
   L_WORD ret = 0;
 
+  /* The acyclic instruction list is in use by queued bursts */
+  if( p_api_dev->bc_acyc_queue[ p_api_dev->biu ].put != p_api_dev->bc_acyc_queue[ p_api_dev->biu ].done )
+      return API_ERR_AGAIN;
+
   /* Added Mode for Acyclic Message sent on Time Tag */
   switch(mode)
   {
@@ -2544,6 +3441,168 @@ L_WORD api_bc_acyc_msg_send_cmd(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_SEN
 }
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_ACYC_QUEUE         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Acyclic transfers of the burst [xfer_cnt],                 */
+/*                Instruction Code and Data [data]                           */
+/*                                                                           */
+/*    Outputs   : Queue state [pending, running, free, done]                 */
+/*                                                                           */
+/*    Description :                                                          */
+/*    The acyclic instruction list is split into API_BC_ACYC_QUEUE_SLOTS     */
+/*    slots, used as a ring of acyclic bursts. Each slot ends with an        */
+/*    interrupting SKIP instruction followed by RET. The first burst is      */
+/*    started immediately, each following burst is started from the BC      */
+/*    skip interrupt of its predecessor (see api_bc_acyc_queue_skip), so the */
+/*    host does not need to wait for a burst to complete before queueing the */
+/*    next one. One slot is kept unused so the slot of the burst that just   */
+/*    completed is not overwritten while its RET may still be executed.      */
+/*    The command and the interrupt handler both start bursts, so advancing  */
+/*    the queue indices and writing the acyclic instruction pointer is done  */
+/*    with the queue lock held.                                              */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_bc_acyc_queue_start(TY_API_DEV *p_api_dev, short biu)
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ biu ];
+  L_WORD slot, addr;
+
+  /* Previous burst still running or nothing to start */
+  if( (queue->get != queue->done) || (queue->get == queue->put) )
+    return;
+
+  slot = queue->get % API_BC_ACYC_QUEUE_SLOTS;
+  queue->get++;
+
+  addr = p_api_dev->glb_mem.biu[ biu ].base.bc_acyc_instr + (slot * API_BC_ACYC_QUEUE_SLOT_SIZE * MAX_API_BC_XFER_INST_SIZE);
+  (*p_api_dev->cb_p[ biu ]).aip = ul_ConvertTSWPtrToGRAMPtr(p_api_dev, biu, addr);
+
+  if(p_api_dev->bc_status[ biu ] == API_BUSY)
+  {
+    UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(&p_api_dev->cb_p[ biu ]->aip), Out);
+  }
+}
+
+static void api_bc_acyc_queue_state(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT * out)
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ p_api_dev->biu ];
+  L_WORD put  = queue->put;
+  L_WORD get  = queue->get;
+  L_WORD done = queue->done;
+
+  out->pending = put - get;
+  out->running = get - done;
+  out->free    = (API_BC_ACYC_QUEUE_SLOTS - 1) - (put - done);
+  out->done    = done;
+}
+
+L_WORD api_bc_acyc_queue(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_ACYC_QUEUE_INPUT * in, TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT * out )
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ p_api_dev->biu ];
+  L_WORD *list;
+  L_WORD slot, flag;
+  L_WORD xfer_cnt = in->xfer_cnt;
+  L_WORD max_cnt  = MIL_COM_LS_BC_ACYC_QUEUE_MAX;
+
+  /* HS and EFEX transfers may need two instructions */
+  if( ul_StreamIsHS( p_api_dev, p_api_dev->biu ) )
+    max_cnt /= 2;
+
+  if( (xfer_cnt == 0) || (xfer_cnt > max_cnt) )
+    return API_ERR_FRAME_CNT_NOT_IN_RANGE;
+
+  if( in->cmd.ulSize < (MIL_COM_LS_BC_ACYC_QUEUE_INPUT_MINIMUM_SIZE + xfer_cnt * sizeof(TY_BC_INSTRUCTION)) )
+    return API_ERR_WRONG_CMD_SIZE;
+
+  if( (queue->put - queue->done) >= (API_BC_ACYC_QUEUE_SLOTS - 1) )
+    return API_ERR_AGAIN;
+
+  slot = queue->put % API_BC_ACYC_QUEUE_SLOTS;
+  list = p_api_dev->bc_acyc_instr_p[ p_api_dev->biu ] + (slot * API_BC_ACYC_QUEUE_SLOT_SIZE);
+
+  flag = api_bc_acyc_instr_write(p_api_dev, list, in->data, &xfer_cnt);
+
+  if(flag != API_OK)
+    return flag;
+
+  /* SKIP to the next instruction with interrupt marks the end of the burst */
+  *(list + xfer_cnt) = BSWAP32(MAKE_INSTR(API_BC_INSTR_SKIP, 0x02000001L) );
+  queue->tail[ slot ] = API_GLB_TSWPTR_TO_PBIREL((uintptr_t)(list + xfer_cnt));
+
+  *(list + xfer_cnt + 1) = BSWAP32(MAKE_INSTR(API_BC_INSTR_RET, 0) );
+
+  if(p_api_dev->bc_status[p_api_dev->biu] == API_BUSY)
+  {
+    UsbSynchronizeMemoryArea(p_api_dev, API_GLB_MEM_ADDR_REL(list), (xfer_cnt + 2) * MAX_API_BC_XFER_INST_SIZE, Out);
+  }
+
+  ai_tsw_os_lock_aquire(queue->lock);
+
+  queue->put++;
+
+  api_bc_acyc_queue_start(p_api_dev, p_api_dev->biu);
+
+  api_bc_acyc_queue_state(p_api_dev, out);
+
+  ai_tsw_os_lock_release(queue->lock);
+
+  return 0;
+
+} /* end: api_bc_acyc_queue */
+
+L_WORD api_bc_acyc_queue_status(TY_API_DEV *p_api_dev, TY_MIL_COM * in, TY_MIL_COM_LS_BC_ACYC_QUEUE_OUTPUT * out )
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ p_api_dev->biu ];
+
+  ai_tsw_os_lock_aquire(queue->lock);
+
+  /* Restart a burst that was queued while the previous one completed */
+  api_bc_acyc_queue_start(p_api_dev, p_api_dev->biu);
+
+  api_bc_acyc_queue_state(p_api_dev, out);
+
+  ai_tsw_os_lock_release(queue->lock);
+
+  return 0;
+}
+
+void api_bc_acyc_queue_reset(TY_API_DEV *p_api_dev, short biu)
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ biu ];
+
+  ai_tsw_os_lock_aquire(queue->lock);
+
+  queue->put  = 0L;
+  queue->get  = 0L;
+  queue->done = 0L;
+
+  ai_tsw_os_lock_release(queue->lock);
+}
+
+/* Called from the BC skip interrupt. Completes the running burst if addr is its ending SKIP and starts the next one */
+void api_bc_acyc_queue_skip(TY_API_DEV *p_api_dev, short biu, L_WORD addr)
+{
+  struct ty_api_bc_acyc_queue *queue = &p_api_dev->bc_acyc_queue[ biu ];
+
+  ai_tsw_os_lock_aquire(queue->lock);
+
+  if( (queue->get != queue->done) && (queue->tail[ queue->done % API_BC_ACYC_QUEUE_SLOTS ] == addr) )
+  {
+    queue->done++;
+
+    api_bc_acyc_queue_start(p_api_dev, biu);
+  }
+
+  ai_tsw_os_lock_release(queue->lock);
+}
+
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BC                   Submodule : API_BC_ACYC_CHECK_TTAT    */
@@ -3112,15 +4171,128 @@ L_WORD api_bc_mode_ctrl( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODE_CTRL_INPUT
 
 
 
+/* Updates the copies of a modify descriptor used by the running and the pending list */
+static void api_bc_modify_copy_update(TY_API_DEV *p_api_dev, L_WORD id, TY_API_BC_MODIFY_INSTRUCTION * modify)
+{
+    struct ty_api_bc_frame_swap *swap = &p_api_dev->bc_frame_swap[ p_api_dev->biu ];
+    L_WORD hip_base = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr;
+    L_WORD k;
+
+    if (swap->ena != API_ON)
+        return;
+
+    for (k = 0; k < swap->active.mod_cnt; k++)
+        if (swap->active.mod_id[k] == id)
+            api_io_bc_modify_write(p_api_dev, hip_base + (swap->active.mod_first + k * 6) * 4L, modify);
+
+    if (swap->pending != API_ON)
+        return;
+
+    for (k = 0; k < swap->shadow.mod_cnt; k++)
+        if (swap->shadow.mod_id[k] == id)
+            api_io_bc_modify_write(p_api_dev, hip_base + (swap->shadow.mod_first + k * 6) * 4L, modify);
+}
+
+
 L_WORD api_bc_modify_def(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODIFY_DEF_INPUT * in, TY_MIL_COM_LS_BC_MODIFY_DEF_OUTPUT * out)
 {
+    L_WORD ret;
+
     if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_BC_MODIFY_INSTRUCTION))
         return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
 
-    return api_io_bc_modify_def(p_api_dev, in->id, &in->modify, &out->offset);
+    ret = api_io_bc_modify_def(p_api_dev, in->id, &in->modify, &out->offset);
+
+    if (ret == 0)
+        api_bc_modify_copy_update(p_api_dev, in->id, &in->modify);
+
+    return ret;
 }
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BC                   Submodule : API_BC_MODIFY_DEF_LIST    */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Apply mode [mode]                                          */
+/*                Number of modify descriptors [cnt]                         */
+/*                Modify descriptor ids and definitions [entry]              */
+/*                                                                           */
+/*    Outputs   : PBI relative descriptor offsets [offset]                   */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BC_MODIFY_DEF_LIST' instruction to      */
+/*    define a list of modify descriptors together. In MAJOR_FRAME mode the  */
+/*    running Major Frame is swapped for one using copies of the listed      */
+/*    descriptors, so all of them take effect at the same Major Frame        */
+/*    boundary. While the BC is halted they are written immediately. A       */
+/*    running Major Frame that does not support swapping is rejected, as     */
+/*    immediate writes would take effect at different positions in it.       */
+/*    Immediate writes stop at the first descriptor that fails.              */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bc_modify_def_list(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT * in, TY_MIL_COM_LS_BC_MODIFY_DEF_LIST_OUTPUT * out)
+{
+    struct ty_api_bc_frame_swap *swap = &p_api_dev->bc_frame_swap[ p_api_dev->biu ];
+    L_WORD hip_end = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bc_hip_instr + p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bc_hip_instr;
+    L_WORD ret;
+    L_WORD i;
+
+    if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_BC_MODIFY_INSTRUCTION))
+        return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
+
+    if (in->mode > API_BC_MODIFY_LIST_MAJOR_FRAME)
+        return API_ERR_INVALID_MODE;
+
+    if ((in->cnt == 0) || (in->cnt > API_BC_MODIFY_LIST_MAX))
+        return API_ERR_PARAM4_NOT_IN_RANGE;
+
+    if (in->cmd.ulSize < (MIL_COM_LS_BC_MODIFY_DEF_LIST_INPUT_MINIMUM_SIZE + in->cnt * sizeof(TY_MIL_COM_LS_BC_MODIFY_DEF_ENTRY)))
+        return API_ERR_WRONG_CMD_SIZE;
+
+    for (i = 0; i < in->cnt; i++)
+        if (in->entry[i].id < 1)
+            return API_ERR_INVALID_ID;
+
+    /* A running Major Frame without swap support has no boundary the list could wait for */
+    if ((in->mode == API_BC_MODIFY_LIST_MAJOR_FRAME) && (swap->ena != API_ON) && (p_api_dev->bc_status[ p_api_dev->biu ] == API_BUSY))
+        return API_ERR_BC_NOT_AVAILABLE;
+
+    if ((in->mode == API_BC_MODIFY_LIST_IMMEDIATE) || (swap->ena != API_ON))
+    {
+        for (i = 0; i < in->cnt; i++)
+        {
+            ret = api_io_bc_modify_def(p_api_dev, in->entry[i].id, &in->entry[i].modify, &out->offset[i]);
+            if (ret != 0)
+                return ret;
+
+            api_bc_modify_copy_update(p_api_dev, in->entry[i].id, &in->entry[i].modify);
+        }
+
+        return 0;
+    }
+
+    if (swap->pending == API_ON)
+        return API_ERR_AGAIN;
+
+    /* The original descriptors are written when the BC entered the new list */
+    for (i = 0; i < in->cnt; i++)
+    {
+        if (in->entry[i].id > swap->modify_ids)
+            swap->modify_ids = in->entry[i].id;
+
+        out->offset[i] = API_GLB_GLOBREL_TO_PBIREL(hip_end - in->entry[i].id * 6 * sizeof(L_WORD));
+    }
+
+    return api_bc_frame_swap_start(p_api_dev, in->entry, in->cnt);
+
+} /* end: api_bc_modify_def_list */
+
+
 
 
 L_WORD api_bc_traffic_override_control(TY_API_DEV *p_api_dev, TY_MIL_COM_WITH_VALUE * in, TY_MIL_COM_ACK * out)
@@ -37,6 +37,8 @@ TY_MIL_COM_TABLE_ENTRY axTargetLsBmCommands[] = {
   {MIL_COM_LS_BM_MSG_REC_FLT,     (TY_MIL_COM_FUNC_PTR)api_bm_read_msg_flt_rec,   "api_bm_read_msg_flt_rec",   sizeof(TY_MIL_COM_LS_BM_MSG_FLT_REC_INPUT),     sizeof(TY_MIL_COM_LS_BM_MSG_FLT_REC_OUTPUT)  },
   {MIL_COM_LS_BM_DYNTAG_MON_DEF,  (TY_MIL_COM_FUNC_PTR)api_bm_dyntag_mon_def,     "api_bm_dyntag_mon_def",     sizeof(TY_MIL_COM_LS_BM_DYNTAG_DEF_INPUT),      sizeof(TY_MIL_COM_ACK)  },
   {MIL_COM_LS_BM_DYNTAG_MON_READ, (TY_MIL_COM_FUNC_PTR)api_bm_dyntag_mon_read,    "api_bm_dyntag_mon_read",    sizeof(TY_MIL_COM_LS_BM_DYNTAG_MON_READ_INPUT), sizeof(TY_MIL_COM_LS_BM_DYNTAG_MON_READ_OUTPUT)  },
+  {MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT, (TY_MIL_COM_FUNC_PTR)api_bm_rt_sa_act_snapshot, "api_bm_rt_sa_act_snapshot", sizeof(TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_INPUT), 0 /* variable */  },
+  {MIL_COM_LS_BM_DYNTAG_MON_READ_BULK, (TY_MIL_COM_FUNC_PTR)api_bm_dyntag_mon_read_bulk, "api_bm_dyntag_mon_read_bulk", sizeof(TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_INPUT), 0 /* variable */  },
 
 };
 
@@ -47,6 +49,19 @@ void api_ls_bm_command_table( TY_MIL_COM_TABLE_ENTRY ** table, AiUInt32 * size )
 }
 
 
+TY_MIL_COM_TABLE_ENTRY axTargetLsBmStatCommands[] = {
+  {MIL_COM_LS_BM_STAT_CONTROL,    (TY_MIL_COM_FUNC_PTR)api_bm_stat_control,       "api_bm_stat_control",       sizeof(TY_MIL_COM_LS_BM_STAT_CONTROL_INPUT),    sizeof(TY_MIL_COM_ACK)  },
+  {MIL_COM_LS_BM_STAT_READ,       (TY_MIL_COM_FUNC_PTR)api_bm_stat_read,          "api_bm_stat_read",          sizeof(TY_MIL_COM_LS_BM_STAT_READ_INPUT),       0 /* variable */  },
+
+};
+
+void api_ls_bm_stat_command_table( TY_MIL_COM_TABLE_ENTRY ** table, AiUInt32 * size )
+{
+    *size = sizeof(axTargetLsBmStatCommands) / sizeof(TY_MIL_COM_TABLE_ENTRY);
+    *table = axTargetLsBmStatCommands;
+}
+
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BM                   Submodule : API_BM_INI                */
@@ -142,6 +157,9 @@ L_WORD api_bm_ini(TY_API_DEV *p_api_dev)
     p_api_dev->bm_msg_flt_dsp[ p_api_dev->biu ].cur_sw[0] = 0L;
     p_api_dev->bm_msg_flt_dsp[ p_api_dev->biu ].cur_sw[1] = 0L;
 
+    /* Bus statistics */
+    api_bm_stat_free(p_api_dev, p_api_dev->biu);
+
 
     if( ul_StreamIsHS( p_api_dev, p_api_dev->biu ) )
         retval = api39_bm_ini(p_api_dev);
@@ -351,6 +369,7 @@ L_WORD api_bm_mode(TY_API_DEV *p_api_dev, BYTE con)
             (*p_api_dev->cb_p[ p_api_dev->biu ]).bm_get = ul_ConvertTSWPtrToGRAMPtr(p_api_dev, p_api_dev->biu, p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bm_buf);
             (*p_api_dev->cb_p[ p_api_dev->biu ]).mbfp = ul_ConvertTSWPtrToGRAMPtr(p_api_dev, p_api_dev->biu, p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bm_buf);
             (*p_api_dev->cb_p[ p_api_dev->biu ]).mstp = ul_ConvertTSWPtrToGRAMPtr(p_api_dev, p_api_dev->biu, p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bm_buf);
+            UsbMonitorDataBufferSyncReset(p_api_dev, p_api_dev->biu);
 
             /* Recording Mode */
             if( (p_api_dev->bm_rec[ p_api_dev->biu ].mode == API_ON) || (p_api_dev->bm_msg_flt_mode[ p_api_dev->biu ] == API_ON) )
@@ -362,6 +381,13 @@ L_WORD api_bm_mode(TY_API_DEV *p_api_dev, BYTE con)
                 p_api_dev->bm_rec[ p_api_dev->biu ].size = 0L;
             }
 
+            /* Bus statistics are evaluated on each Monitor Buffer Full Interrupt */
+            if( p_api_dev->bm_stat[ p_api_dev->biu ] != NULL )
+            {
+                api_io_bm_imod_set(p_api_dev, API_SCB_IMOD_BUF_FULL);
+                api_bm_stat_reset(p_api_dev, p_api_dev->biu);
+            }
+
             /* Clear Global BM Message and Error Counter */
             p_api_dev->bm_status_cnt[ p_api_dev->biu ].msg_cnt = 0L;
             p_api_dev->bm_status_cnt[ p_api_dev->biu ].err_cnt = 0L;
@@ -390,6 +416,10 @@ L_WORD api_bm_mode(TY_API_DEV *p_api_dev, BYTE con)
 
         /* BM OFF */
         api_io_mode_con(p_api_dev, API_BM_MODE, API_OFF);
+
+        /* Evaluate the remaining entries while the BM buffer is still synchronized */
+        api_ir_bm_stat(p_api_dev, p_api_dev->biu);
+
         p_api_dev->bm_status[ p_api_dev->biu ] = API_HALT;
         p_api_dev->bm_status_dsp[ p_api_dev->biu ] = API_BM_STATUS_HALT;
 
@@ -1284,6 +1314,189 @@ static short api_bm_stack_find_entry(TY_API_DEV *p_api_dev, WORD fspec, WORD fwo
 
 } /* end: api_bm_stack_find_entry */
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_STACK_TTAG_PROBE   */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Address of the oldest monitor entry [start]                */
+/*                Number of valid monitor entries [count]                    */
+/*                Entry index to start the scan on [index]                   */
+/*                Entry index to stop the scan on [end]                      */
+/*                                                                           */
+/*    Outputs   : Entry index of the message found or [end] if none          */
+/*                Time tag of the message found [ttag_high], [ttag_low]      */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function resynchronizes to the next message start, i.e. the next  */
+/*    Time Tag High entry followed by a Time Tag Low entry, at or behind the  */
+/*    given entry index. Entry indices are relative to the oldest entry.     */
+/*    On USB devices the entries are synchronized in small areas instead of  */
+/*    one by one.                                                            */
+/*                                                                           */
+/*****************************************************************************/
+
+static L_WORD api_bm_stack_ttag_probe(TY_API_DEV *p_api_dev, L_WORD start, L_WORD count, L_WORD index, L_WORD end,
+                                      L_WORD *ttag_high, L_WORD *ttag_low)
+{
+  L_WORD buf_start, buf_end, addr, entry, synced, sync_count;
+  L_WORD volatile *ptr;
+
+  buf_start = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bm_buf;
+  buf_end   = buf_start + p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bm_buf;
+  synced    = index;
+
+  for( ; index < end; index++)
+  {
+    addr = start + (index * 4);
+    if(addr >= buf_end)
+      addr -= p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bm_buf;
+
+    if( (p_api_dev->bm_status[p_api_dev->biu] == API_BUSY) && (index >= synced) )
+    {
+      /* Synchronize the entries up to the next message start at once.
+         The TTLow entry behind the last one is synchronized as well */
+      sync_count = API_BM_TTAG_PROBE_ENTRIES;
+      if(sync_count > count - index)
+        sync_count = count - index;
+      if(sync_count > (buf_end - addr) / 4)
+        sync_count = (buf_end - addr) / 4;
+
+      UsbSynchronizeMemoryArea(p_api_dev, addr, sync_count * 4, In);
+      synced = index + sync_count;
+    }
+
+    ptr = (L_WORD*)API_GLB_MEM_ADDR_ABS(addr);
+    entry = BSWAP32(*ptr);
+
+    if( (entry >> 28) != API_BM_ENTRY_TTAG_HIGH)
+      continue;
+
+    if( (index + 1) >= count)
+      break;
+
+    /* Get the Time Tag Low entry of the message */
+    addr += 4;
+    if(addr >= buf_end)
+      addr = buf_start;
+
+    if( (p_api_dev->bm_status[p_api_dev->biu] == API_BUSY) && ( (index + 1) >= synced) )
+    {
+      UsbSynchronizeLWord(p_api_dev, addr, In);
+    }
+
+    ptr = (L_WORD*)API_GLB_MEM_ADDR_ABS(addr);
+
+    if( (BSWAP32(*ptr) >> 28) != API_BM_ENTRY_TTAG_LOW)
+      continue;
+
+    *ttag_high = entry & 0x03FFFFFF;
+    *ttag_low  = BSWAP32(*ptr) & 0x03FFFFFF;
+
+    return index;
+  }
+
+  return end;
+
+} /* end: api_bm_stack_ttag_probe */
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_STACK_FIND_TTAG    */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Time Tag High to find [ttag_high]                          */
+/*                Time Tag Low to find [ttag_low]                            */
+/*                                                                           */
+/*    Outputs   : Search fail/success [status]                               */
+/*                Address of the Time Tag High entry found [saddr]           */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function searches the first message in the Monitor Buffer with a  */
+/*    time tag equal or later than the given one. As the monitor entries are */
+/*    stored in time order, the buffer is searched binary from the oldest to */
+/*    the latest entry, so only a few entries per probe have to be read.     */
+/*                                                                           */
+/*****************************************************************************/
+
+static short api_bm_stack_find_ttag(TY_API_DEV *p_api_dev, L_WORD ttag_high, L_WORD ttag_low, L_WORD *saddr)
+{
+  L_WORD buf_start, buf_size, start, count, fill;
+  L_WORD low, high, mid, msg, found, msg_high, msg_low;
+  L_WORD volatile *ptr;
+
+  buf_start = p_api_dev->glb_mem.biu[ p_api_dev->biu ].base.bm_buf;
+  buf_size  = p_api_dev->glb_mem.biu[ p_api_dev->biu ].size.bm_buf;
+
+  fill = api_io_bm_read_mbfp(p_api_dev, p_api_dev->biu);
+
+  if( (fill < buf_start) || (fill >= buf_start + buf_size) )
+    return API_ERR;
+
+  if(p_api_dev->bm_status[p_api_dev->biu] == API_BUSY)
+  {
+      UsbSynchronizeLWord(p_api_dev, fill, In);
+  }
+
+  /* The buffer is cleared on BM init, so an updated entry at the fill
+     pointer means the buffer has wrapped around and the fill pointer
+     points to the oldest entry */
+  ptr = (L_WORD*)API_GLB_MEM_ADDR_ABS(fill);
+
+  if( (BSWAP32(*ptr) & 0xF0000000L) != 0L)
+  {
+    start = fill;
+    count = buf_size / 4;
+  }
+  else
+  {
+    start = buf_start;
+    count = (fill - buf_start) / 4;
+  }
+
+  /* The result is always the first message with a time tag equal or later
+     than the requested one found so far. Messages in front of [low] are
+     earlier, messages in [high, found) do not exist. */
+  low   = 0;
+  high  = count;
+  found = count;
+
+  while(low < high)
+  {
+    mid = low + (high - low) / 2;
+    msg = api_bm_stack_ttag_probe(p_api_dev, start, count, mid, high, &msg_high, &msg_low);
+
+    if(msg == high)
+    {
+      /* No message start in [mid, high) */
+      high = mid;
+    }
+    else if( (msg_high < ttag_high) || ( (msg_high == ttag_high) && (msg_low < ttag_low) ) )
+    {
+      low = msg + 1;
+    }
+    else
+    {
+      found = msg;
+      high  = mid;
+    }
+  }
+
+  if(found == count)
+    return API_ERR;
+
+  *saddr = start + (found * 4);
+  if(*saddr >= buf_start + buf_size)
+    *saddr -= buf_size;
+
+  return API_OK;
+
+} /* end: api_bm_stack_find_ttag */
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BM                   Submodule : API_BM_STACK_ENTRY_FIND   */
@@ -1325,6 +1538,23 @@ L_WORD api_bm_stack_entry_find(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_STACK_ENT
     WORD etw      = (WORD)in->etw;
     WORD etm      = (WORD)in->etm;
 
+    if(spec & API_BM_SEARCH_TTAG)
+    {
+        /* The time tag to find is given in etw (Time Tag High) and etm (Time Tag Low).
+           The search always covers all valid entries, so mode and offset are not used */
+        if(api_bm_stack_find_ttag(p_api_dev, in->etw, in->etm, &addr) == API_OK)
+        {
+            out->fnd = 1;
+            out->eptr = addr;
+
+            /* Set pointer to Global Memory and read entry */
+            ptr = (L_WORD*)API_GLB_MEM_ADDR_ABS(addr &0xFFFFFFFC);
+            out->entry = BSWAP32(*ptr);
+        }
+
+        return 0;
+    }
+
     switch(mode)
     {
     case API_BM_STACK_STP:
@@ -1567,7 +1797,7 @@ L_WORD api_bm_copy_rec_dat(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_COPY_REC_DAT_
 
         if(p_api_dev->bm_status[p_api_dev->biu] == API_BUSY)
         {
-            UsbSynchronizeMonitorDataBuffer(p_api_dev, p_api_dev->biu, In);
+            UsbSynchronizeMonitorDataBufferNewData(p_api_dev, p_api_dev->biu);
         }
 
         /* Copy Data from Global to Shared RAM */
@@ -2059,6 +2289,278 @@ L_WORD api_bm_rt_act_read(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_RT_ACT_READ_IN
 } /* end: api_bm_rt_act_read */
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_RT_SA_ACT_SNAPSHOT */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : First Remote Terminal Address [rt_first]                   */
+/*                Number of Remote Terminals [rt_count]                      */
+/*                Subaddress Type [sa_type]                                  */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BM_RT_SA_ACT_SNAPSHOT' instruction to   */
+/*    read the transfer/error counter locations of all subaddresses of a     */
+/*    range of RTs from the BM Activity and Filter page in one command.      */
+/*    The counters are returned as (cc,ec) pairs ordered by RT and SA,       */
+/*    followed by the 16 bit status words packed two per lword.             */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bm_rt_sa_act_snapshot(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_INPUT * in, TY_MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_OUTPUT * out )
+{
+    L_WORD  count = 0;
+    L_WORD  cc, ec, et;
+    L_WORD *status;
+    L_WORD  ack_size;
+    BYTE    rt, sa;
+
+    if( (in->rt_count == 0) || (in->rt_first >= MAX_API_RT) || (in->rt_count > (MAX_API_RT - in->rt_first)) )
+        return API_ERR_INVALID_RT;
+
+    if( in->sa_type > API_RT_SA_TYPE_ALL )
+        return API_ERR_INVALID_RT_SA_TYPE;
+
+    ack_size = MIL_COM_LS_BM_RT_SA_ACT_SNAPSHOT_ACK_SIZE(in->rt_count * MAX_API_RT_MC_SA);
+
+    if( ack_size > in->cmd.ulExpectedAckSize )
+        return API_ERR_WRONG_ACK_SIZE;
+
+    if(p_api_dev->bm_status[p_api_dev->biu] == API_BUSY)
+    {
+        if( in->rt_count == MAX_API_RT )
+        {
+            UsbSynchronizeMonitorActivityFilteringPage(p_api_dev, p_api_dev->biu, In);
+        }
+        else
+        {
+            for(rt = (BYTE)in->rt_first; rt < in->rt_first + in->rt_count; rt++)
+            {
+                UsbSynchronizeMonitorActivityPageOfRT(p_api_dev, p_api_dev->biu, rt, In);
+            }
+        }
+    }
+
+    out->count = in->rt_count * MAX_API_RT_MC_SA;
+    status     = &out->data[2 * out->count];
+
+    for(rt = (BYTE)in->rt_first; rt < in->rt_first + in->rt_count; rt++)
+    {
+        for(sa = 0; sa < MAX_API_RT_MC_SA; sa++)
+        {
+            api_bm_rt_sa_act_read_internal( p_api_dev, rt, sa, (BYTE)in->sa_type, &et, &cc, &ec );
+
+            out->data[2 * count]     = cc;
+            out->data[2 * count + 1] = ec;
+
+            if( count & 1 )
+                status[count / 2] |= (et & 0xFFFF) << 16;
+            else
+                status[count / 2]  = (et & 0xFFFF);
+
+            count++;
+        }
+    }
+
+    out->xAck.ulSize = ack_size;
+
+    return 0;
+} /* end: api_bm_rt_sa_act_snapshot */
+
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_STAT               */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Statistics control [con]                                   */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BM_STAT_CONTROL' instruction to         */
+/*    enable, disable or reset the on-target bus statistics of the BM.       */
+/*    The statistics are evaluated from the BM buffer on each Monitor        */
+/*    Buffer Full interrupt, so the BM interrupt mode is set to buffer full  */
+/*    on BM start while the statistics are enabled.                          */
+/*    The interrupt handler evaluates the statistics with the BIU statistics */
+/*    lock held, so they are only set up, reset and freed under this lock.   */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_bm_stat_init(TY_API_DEV *p_api_dev, struct ty_api_bm_stat *p_stat, short biu)
+{
+    memset(p_stat, 0, sizeof(struct ty_api_bm_stat));
+
+    p_stat->rt2 = 0xFF;
+    p_stat->pos = api_io_bm_read_mbfp(p_api_dev, biu);
+}
+
+void api_bm_stat_reset(TY_API_DEV *p_api_dev, short biu)
+{
+    ai_tsw_os_lock_aquire(p_api_dev->bm_stat_lock[ biu ]);
+
+    if( p_api_dev->bm_stat[ biu ] != NULL )
+        api_bm_stat_init(p_api_dev, p_api_dev->bm_stat[ biu ], biu);
+
+    ai_tsw_os_lock_release(p_api_dev->bm_stat_lock[ biu ]);
+}
+
+void api_bm_stat_free(TY_API_DEV *p_api_dev, short biu)
+{
+    struct ty_api_bm_stat *p_stat;
+
+    ai_tsw_os_lock_aquire(p_api_dev->bm_stat_lock[ biu ]);
+
+    p_stat = p_api_dev->bm_stat[ biu ];
+    p_api_dev->bm_stat[ biu ] = NULL;
+
+    ai_tsw_os_lock_release(p_api_dev->bm_stat_lock[ biu ]);
+
+    /* the interrupt handler can no longer see the statistics */
+    if( p_stat != NULL )
+        FREE(p_stat);
+}
+
+L_WORD api_bm_stat_control(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_STAT_CONTROL_INPUT * in, TY_MIL_COM_ACK * out )
+{
+    struct ty_api_bm_stat *p_stat;
+
+    if( API_DEVICE_MODE_IS_SIMULATOR(p_api_dev->drv_mode[p_api_dev->biu]) || ul_StreamIsHS(p_api_dev, p_api_dev->biu) )
+        return API_ERR_BM_NOT_AVAILABLE;
+
+    switch( in->con )
+    {
+    case API_BM_STAT_DIS:
+        api_bm_stat_free(p_api_dev, p_api_dev->biu);
+        break;
+
+    case API_BM_STAT_ENA:
+        if( p_api_dev->bm_stat[ p_api_dev->biu ] != NULL )
+            break;
+
+        p_stat = (struct ty_api_bm_stat *) MALLOC(sizeof(struct ty_api_bm_stat));
+
+        if( p_stat == NULL )
+            return API_ERR_MALLOC_FAILED;
+
+        /* publish the statistics only once they are set up */
+        ai_tsw_os_lock_aquire(p_api_dev->bm_stat_lock[ p_api_dev->biu ]);
+        api_bm_stat_init(p_api_dev, p_stat, p_api_dev->biu);
+        p_api_dev->bm_stat[ p_api_dev->biu ] = p_stat;
+        ai_tsw_os_lock_release(p_api_dev->bm_stat_lock[ p_api_dev->biu ]);
+
+        if( p_api_dev->bm_status[ p_api_dev->biu ] == API_BUSY )
+            api_io_bm_imod_set(p_api_dev, API_SCB_IMOD_BUF_FULL);
+        break;
+
+    case API_BM_STAT_RESET:
+        api_bm_stat_reset(p_api_dev, p_api_dev->biu);
+        break;
+
+    default:
+        return API_ERR_INVALID_CON;
+    }
+
+    return 0;
+} /* end: api_bm_stat_control */
+
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_STAT_READ          */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : First Remote Terminal Address [rt_first]                   */
+/*                Number of Remote Terminals [rt_count]                      */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BM_STAT_READ' instruction to read the   */
+/*    on-target bus statistics. The global counters, the gap, interval and   */
+/*    response time statistics are returned with each call, the per RT/SA    */
+/*    message and error counters for the given range of RTs.                 */
+/*    The statistics are evaluated by the interrupt handler on each Monitor  */
+/*    Buffer Full interrupt and on BM halt. A read starting with RT 0 takes  */
+/*    a snapshot of them. All calls return this snapshot, so the chunks of   */
+/*    one read are consistent.                                               */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_bm_stat_time_read(struct ty_api_bm_stat_time *p_time, TY_MIL_COM_LS_BM_STAT_TIME *p_out)
+{
+    p_out->count = p_time->cnt;
+    p_out->min   = p_time->min;
+    p_out->max   = p_time->max;
+    p_out->mean  = p_time->cnt ? (AiUInt32)(p_time->sum / p_time->cnt) : 0;
+}
+
+L_WORD api_bm_stat_read(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_STAT_READ_INPUT * in, TY_MIL_COM_LS_BM_STAT_READ_OUTPUT * out )
+{
+    struct ty_api_bm_stat *p_stat;
+    L_WORD ack_size;
+    L_WORD rt, sa, i;
+    L_WORD *data;
+
+    if( (in->rt_count == 0) || (in->rt_count > MIL_COM_LS_BM_STAT_MAX_RT) || (in->rt_first >= MAX_API_RT) || (in->rt_count > (MAX_API_RT - in->rt_first)) )
+        return API_ERR_INVALID_RT;
+
+    ack_size = MIL_COM_LS_BM_STAT_READ_ACK_SIZE(in->rt_count * MAX_API_RT_MC_SA);
+
+    if( ack_size > in->cmd.ulExpectedAckSize )
+        return API_ERR_WRONG_ACK_SIZE;
+
+    p_stat = p_api_dev->bm_stat[ p_api_dev->biu ];
+
+    if( p_stat == NULL )
+        return API_ERR_BM_NOT_AVAILABLE;
+
+    if( in->rt_first == 0 )
+    {
+        ai_tsw_os_lock_aquire(p_api_dev->bm_stat_lock[ p_api_dev->biu ]);
+        memcpy(&p_stat->snap, &p_stat->val, sizeof(struct ty_api_bm_stat_values));
+        ai_tsw_os_lock_release(p_api_dev->bm_stat_lock[ p_api_dev->biu ]);
+    }
+
+    out->msg_cnt = p_stat->snap.msg_cnt;
+    out->err_cnt = p_stat->snap.err_cnt;
+
+    for( i = 0; i < 16; i++ )
+        out->err_hist[ i ] = p_stat->snap.err_hist[ i ];
+
+    api_bm_stat_time_read(&p_stat->snap.gap,      &out->gap);
+    api_bm_stat_time_read(&p_stat->snap.interval, &out->interval);
+
+    for( rt = 0; rt < MAX_API_RT; rt++ )
+        api_bm_stat_time_read(&p_stat->snap.resp[ rt ], &out->resp[ rt ]);
+
+    out->count = in->rt_count * MAX_API_RT_MC_SA;
+    data       = out->data;
+
+    for( rt = in->rt_first; rt < in->rt_first + in->rt_count; rt++ )
+    {
+        for( sa = 0; sa < MAX_API_RT_MC_SA; sa++ )
+        {
+            for( i = 0; i < 4; i++ )
+                *data++ = p_stat->snap.sa_cnt[ rt ][ sa ][ i ];
+        }
+    }
+
+    out->xAck.ulSize = ack_size;
+
+    return 0;
+} /* end: api_bm_stat_read */
+
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_BM                   Submodule : API_BM_INI_MSG_FLT_REC    */
@@ -2290,6 +2792,61 @@ L_WORD api_bm_dyntag_mon_read(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DYNTAG_MON
 }
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_BM                   Submodule : API_BM_DYNTAG_READ_BULK   */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : First Dytag Monitor ID of a range or 0 [id_first]          */
+/*                Number of Dytag Monitors [count]                           */
+/*                Dytag Monitor ID list, if id_first is 0 [id]               */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'API_BM_DYNTAG_MON_READ_BULK' instruction to */
+/*    read the stale/bad/good counters of a range or a list of Dytag         */
+/*    Monitors with one command. The states are returned in request order.   */
+/*                                                                           */
+/*****************************************************************************/
+
+L_WORD api_bm_dyntag_mon_read_bulk(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_INPUT * in, TY_MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_OUTPUT * out )
+{
+    L_WORD ack_size;
+    L_WORD id, i;
+
+    if( (in->count == 0) || (in->count > MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_MAX) )
+        return API_ERR_INVALID_ID;
+
+    if( (in->id_first != 0) && ((in->id_first > MAX_API_BM_DYNTAG_MON_ID) || (in->count > (MAX_API_BM_DYNTAG_MON_ID + 1 - in->id_first))) )
+        return API_ERR_INVALID_ID;
+
+    ack_size = MIL_COM_LS_BM_DYNTAG_MON_READ_BULK_ACK_SIZE(in->count);
+
+    if( ack_size > in->cmd.ulExpectedAckSize )
+        return API_ERR_WRONG_ACK_SIZE;
+
+    for( i = 0; i < in->count; i++ )
+    {
+        id = in->id_first ? (in->id_first + i) : in->id[ i ];
+
+        if( (id == 0) || (id > MAX_API_BM_DYNTAG_MON_ID) )
+            return API_ERR_INVALID_ID;
+
+        out->state[ i ].stale_cnt = p_api_dev->bm_ls_dyntagm_set[ p_api_dev->biu ].dyntag[ id - 1 ].stale_cnt;
+        out->state[ i ].bad_cnt   = p_api_dev->bm_ls_dyntagm_set[ p_api_dev->biu ].dyntag[ id - 1 ].bad_cnt;
+        out->state[ i ].good_cnt  = p_api_dev->bm_ls_dyntagm_set[ p_api_dev->biu ].dyntag[ id - 1 ].good_cnt;
+    }
+
+    out->count       = in->count;
+    out->xAck.ulSize = ack_size;
+
+    return API_OK;
+}
+
+
 
 
 NAMESPACE1553_END
@@ -125,6 +125,13 @@ L_WORD ul_ApiDataQueueMemAddr(TY_API_DEV *p_api_dev, L_WORD id, short biu)
       return data_queue_offset;
   }
 
+  if( id == API_DATA_QUEUE_ID_XFER_EVENT )
+  {
+      /* The transfer event queue follows the 11MB Data Queue Area */
+      data_queue_offset += (11 * API_DATA_QUEUE_SIZE_LS);
+      return data_queue_offset;
+  }
+
   switch(p_api_dev->uc_DeviceType )
   {
     case TYPE_ACX3910_2:
@@ -169,6 +176,8 @@ static AiUInt8 api_data_queue_open_get_biu(L_WORD ucId)
     /* Milscope */
     else if (ucId == API_DATA_QUEUE_ID_MIL_SCOPE)      ucBiu = 0;
     else if (ucId == API_DATA_QUEUE_ID_GENERIC_ACQ)    ucBiu = 0;
+    /* BC/RT transfer events of all BIUs */
+    else if (ucId == API_DATA_QUEUE_ID_XFER_EVENT)     ucBiu = 0;
 
     return ucBiu;
 }
@@ -214,6 +223,11 @@ L_WORD api_data_queue_open(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DATAQUEUE_OPE
 
     biu = api_data_queue_open_get_biu(in->id);
 
+    /* The transfer event queue needs shared memory beyond the recording queues */
+    if( (in->id == API_DATA_QUEUE_ID_XFER_EVENT)
+     && ((ul_ApiDataQueueMemAddr(p_api_dev, in->id, biu) + API_DATA_QUEUE_SIZE_LS) > p_api_dev->SharedRAMSize) )
+        return API_ERR_DQUEUE_ASP_SIZE_NOT_IN_RANGE;
+
     /* Set offset to Queue Control structure in SHARED */
     p_api_dev->dataqueue_header_offsets[in->id] = ul_ApiDataQueueMemAddr(p_api_dev, (BYTE)in->id, biu);
 
@@ -221,6 +235,9 @@ L_WORD api_data_queue_open(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DATAQUEUE_OPE
 
     memset( (void*)pDataQueueHeader, 0, sizeof(TY_API_DATA_QUEUE_HEADER));
 
+    /* A new queue records unfiltered until a filter is set */
+    memset( &p_api_dev->dataqueue_filter[in->id], 0, sizeof(TY_API_DATA_QUEUE_FILTER));
+
     pDataQueueHeader->status     = 0L;
     pDataQueueHeader->data_start = p_api_dev->dataqueue_header_offsets[in->id] + API_DATA_QUEUE_DATA_OFFSET;
     pDataQueueHeader->data_size  = out->dataqueue_size;
@@ -287,6 +304,7 @@ L_WORD api_data_queue_control(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DATAQUEUE_
 #endif    
     L_WORD tmpl;
     TY_API_DATA_QUEUE_HEADER * pDataQueueHeader;
+    TY_MIL_COM_LS_BM_DATAQUEUE_FILTER_INPUT * pxFilterIn;
 
     if( in->id > API_MAX_DATA_QUEUE_ID )
         /* ID out of range */
@@ -294,9 +312,9 @@ L_WORD api_data_queue_control(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DATAQUEUE_
 
     if( p_api_dev->dataqueue_header_offsets[in->id] == 0 )
     {
-        if( in->mode == API_DATA_QUEUE_CTRL_START )
+        if( (in->mode == API_DATA_QUEUE_CTRL_START) || (in->mode == API_DATA_QUEUE_CTRL_FILTER) )
         {
-            /* DQ not open and can not be started */
+            /* DQ not open and can not be started or filtered */
             return API_ERR_BUFFER_NOT_ALLOCATED;
         }
         else
@@ -427,6 +445,24 @@ L_WORD api_data_queue_control(TY_API_DEV *p_api_dev, TY_MIL_COM_LS_BM_DATAQUEUE_
         wbflush();
         break;
 
+    case API_DATA_QUEUE_CTRL_FILTER:
+        /* The filter parameters follow the control input */
+        if( in->cmd.ulSize < sizeof(TY_MIL_COM_LS_BM_DATAQUEUE_FILTER_INPUT) )
+            return API_ERR_WRONG_CMD_SIZE;
+
+        /* Filtering is only possible on LS BM recording queues */
+        if( (in->id > API_DATA_QUEUE_ID_BM_REC_BIU8) || uc_ApiDataQueueIsHs(p_api_dev, in->id) )
+            return API_ERR_INVALID_ID;
+
+        pxFilterIn = (TY_MIL_COM_LS_BM_DATAQUEUE_FILTER_INPUT*)in;
+
+        p_api_dev->dataqueue_filter[in->id].rt_mask    = pxFilterIn->rt_mask;
+        p_api_dev->dataqueue_filter[in->id].rx_sa_mask = pxFilterIn->rx_sa_mask;
+        p_api_dev->dataqueue_filter[in->id].tx_sa_mask = pxFilterIn->tx_sa_mask;
+        p_api_dev->dataqueue_filter[in->id].error_mask = pxFilterIn->error_mask;
+        p_api_dev->dataqueue_filter[in->id].enable     = pxFilterIn->enable ? 1 : 0;
+        break;
+
 
     default:
         return API_ERR_INVALID_MODE;
@@ -981,6 +981,8 @@ void api_ini_ls_systag_glb_vars(TY_API_DEV *p_api_dev)
       p_api_dev->ls_systag_setup[ i ].dytag[ j ].mask = 0;
       p_api_dev->ls_systag_setup[ i ].dytag[ j ].init = API_OFF;
       p_api_dev->ls_systag_setup[ i ].dytag[ j ].index = 0;
+      p_api_dev->ls_systag_setup[ i ].dytag[ j ].pass = API_SYSTAG_PASS_NONE;
+      p_api_dev->ls_systag_setup[ i ].dytag[ j ].calc = NULL;
     }
   }
 
@@ -1019,6 +1021,13 @@ void api_ini_startup(TY_API_DEV *p_api_dev)
 
     mil_tasks_info_init(p_api_dev);
 
+    for (i = 0; i < MAX_BIU; i++)
+    {
+        p_api_dev->bc_acyc_queue[i].lock = ai_tsw_os_lock_create();
+        p_api_dev->bm_stat_lock[i] = ai_tsw_os_lock_create();
+        p_api_dev->bc_timing_lock[i] = ai_tsw_os_lock_create();
+    }
+
     if (p_api_dev->targ_com_reg_p != NULL)
     {
         p_api_dev->targ_com_reg_p->ul_OsBit             = 0L;
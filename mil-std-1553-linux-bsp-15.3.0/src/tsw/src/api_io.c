@@ -5061,8 +5061,6 @@ WORD cw1, cw2;
 
 L_WORD api_io_bc_modify_def(TY_API_DEV *p_api_dev, L_WORD id, TY_API_BC_MODIFY_INSTRUCTION * modify, L_WORD * pbi_relative_offset )
 {
-    L_WORD i;
-    L_WORD * fw_modify_descriptor;
     L_WORD hip_base = p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_hip_instr;
     L_WORD hip_size = p_api_dev->glb_mem.biu[p_api_dev->biu].size.bc_hip_instr;
     L_WORD hip_end  = hip_base + hip_size;
@@ -5073,11 +5071,32 @@ L_WORD api_io_bc_modify_def(TY_API_DEV *p_api_dev, L_WORD id, TY_API_BC_MODIFY_I
     if (id < 1)
         return API_ERR_INVALID_ID;
 
+    /* Keep BC frame hot swap lists clear of the descriptors */
+    if (id > p_api_dev->bc_frame_swap[p_api_dev->biu].modify_ids)
+        p_api_dev->bc_frame_swap[p_api_dev->biu].modify_ids = id;
+
 
     /* -- prepare offsets --- */
 
     offset = hip_end - (id * 6*sizeof(L_WORD));
 
+    api_io_bc_modify_write(p_api_dev, offset, modify);
+
+
+    /* -- return pbi offset for use with modify instruction -- */
+
+    *pbi_relative_offset = API_GLB_GLOBREL_TO_PBIREL(offset);
+
+    return 0;
+}
+
+
+/* Writes the firmware modify descriptor at the global RAM offset */
+void api_io_bc_modify_write(TY_API_DEV *p_api_dev, L_WORD offset, TY_API_BC_MODIFY_INSTRUCTION * modify)
+{
+    L_WORD i;
+    L_WORD * fw_modify_descriptor;
+
     fw_modify_descriptor = (L_WORD*)API_GLB_GLOBREL_TO_TSWPTR(offset);
 
     /* -- sync mirror in --- */
@@ -5124,13 +5143,6 @@ L_WORD api_io_bc_modify_def(TY_API_DEV *p_api_dev, L_WORD id, TY_API_BC_MODIFY_I
             UsbSynchronizeLWord(p_api_dev, offset + i, Out);
         }
     }
-
-
-    /* -- return pbi offset for use with modify instruction -- */
-
-    *pbi_relative_offset = API_GLB_GLOBREL_TO_PBIREL(offset);
-
-    return 0;
 }
 
 
@@ -7630,8 +7642,17 @@ static BYTE api_io_bm_msg_flt_copy( TY_API_DEV * p_api_dev, L_WORD volatile * ap
     retval = api_io_bm_msg_flt_copy_format5( p_api_dev, dest_ptr, max_size );
 
   if( retval == API_ERR )
+  {
+    if( p_api_dev->bm_msg_flt_dsp[ p_api_dev->biu ].incr == API_ON )
+    {
+      /* output full => keep the cursor in front of this message for the next call */
+      p_api_dev->bm_msg_flt_dsp[ p_api_dev->biu ].ovfl = API_BM_MSG_FLT_MORE;
+      return API_ON;
+    }
+
     /* overflow => Stop BM */
     api_io_mode_con( p_api_dev, API_BM_MODE, API_OFF );
+  }
 
 
   return API_OFF;
@@ -7749,6 +7770,10 @@ static L_WORD api_io_bm_msg_flt_trigger_dependent( TY_API_DEV *p_api_dev, BYTE m
 /*    Description :                                                           */
 /*    This function handles the 'API_BM_READ_MSG_FLT_REC' instruction to      */
 /*    read the BM Message Filter Recording data of the API1553-DS BM.         */
+/*    Each call continues at the position where the previous call stopped.    */
+/*    With API_BM_MSG_FLT_MODE_INCR a full output area does not stop the BM,  */
+/*    the records that did not fit are returned by the next call and ovfl is  */
+/*    set to API_BM_MSG_FLT_MORE.                                             */
 /*                                                                            */
 /******************************************************************************/
 BYTE api_io_bm_read_msg_flt_rec(TY_API_DEV* p_api_dev, BYTE mode, BYTE con, L_WORD max_size, L_WORD max_msg)
@@ -7773,6 +7798,8 @@ BYTE api_io_bm_read_msg_flt_rec(TY_API_DEV* p_api_dev, BYTE mode, BYTE con, L_WO
     const L_WORD      lBmSize = p_api_dev->glb_mem.biu[wBiu].size.bm_buf;
 
     p_api_dev->bm_msg_flt_dsp[wBiu].ovfl = API_OFF;
+    p_api_dev->bm_msg_flt_dsp[wBiu].incr = (mode & API_BM_MSG_FLT_MODE_INCR) ? API_ON : API_OFF;
+    mode &= ~API_BM_MSG_FLT_MODE_INCR;
 
     if (p_api_dev->bm_status[wBiu] == API_BUSY)
     {
@@ -7915,8 +7942,8 @@ BYTE api_io_bm_read_msg_flt_rec(TY_API_DEV* p_api_dev, BYTE mode, BYTE con, L_WO
         addr = api_io_bm_msg_flt_select_next(p_api_dev, addr);
         api_ptr = (L_WORD*)API_GLB_MEM_ADDR_ABS(addr);
 
-        if (p_api_dev->bm_msg_flt_dsp[wBiu].ovfl == API_ON)
-            /* overflow occured => stop */
+        if (p_api_dev->bm_msg_flt_dsp[wBiu].ovfl != API_OFF)
+            /* overflow or output full => stop */
             break;
 
         if (msg_flag == API_ON)
@@ -9208,6 +9235,8 @@ void api_io_ls_systag_entry_init(TY_API_DEV *p_api_dev, BYTE tag_ix)
   p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].mask = 0;
   p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].init = API_OFF;
   p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].index = 0;
+  p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].pass = API_SYSTAG_PASS_NONE;
+  p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].calc = NULL;
 
 } /* end: api_io_ls_systag_entry_init */
 
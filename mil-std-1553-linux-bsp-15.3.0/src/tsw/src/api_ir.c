@@ -234,6 +234,160 @@ void api_timer0_isr(TY_API_DEV *p_api_dev, L_WORD cpu_cause, L_WORD cpu_stat, EX
 #endif 
 
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_IR                   Submodule : API_IR_SYSTAG_BUF         */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Data buffer copy [p_copy] and its original data [p_orig]   */
+/*                Data buffer in Global Memory [p_glb]                       */
+/*                Range of data words [wfirst, wlast]                        */
+/*                                                                           */
+/*    Outputs   : none                                                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    System Dynamic Data words are calculated on a local copy of the data   */
+/*    buffer. Only the data words used by the tags are read, with 32 bit     */
+/*    accesses. Only the words that changed are written back, a 32 bit pair  */
+/*    with one access if both of its words changed, else the changed word    */
+/*    alone. So a word not changed by the tags is never rewritten with the   */
+/*    value it had when the buffer was loaded.                               */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_ir_systag_buf_load(TY_API_LS_SYSTAG_BUF *p_copy, TY_API_LS_SYSTAG_BUF *p_orig, BYTE *p_glb, WORD wfirst, WORD wlast)
+{
+  AiUInt32 volatile *src_p = (AiUInt32 volatile *)p_glb;
+  WORD i;
+
+  for(i = wfirst / 2; i <= wlast / 2; i++)
+  {
+    p_orig->l[ i ] = src_p[ i ];
+    p_copy->l[ i ] = p_orig->l[ i ];
+  }
+}
+
+static void api_ir_systag_buf_store(TY_API_LS_SYSTAG_BUF *p_copy, TY_API_LS_SYSTAG_BUF *p_orig, BYTE *p_glb, WORD wfirst, WORD wlast)
+{
+  AiUInt32 volatile *dest_p = (AiUInt32 volatile *)p_glb;
+  WORD volatile *dest_w = (WORD volatile *)p_glb;
+  WORD i, k;
+
+  for(i = wfirst / 2; i <= wlast / 2; i++)
+  {
+    if(p_copy->l[ i ] == p_orig->l[ i ])
+      continue;
+
+    k = 2 * i;
+
+    if( (p_copy->w[ k ] != p_orig->w[ k ]) && (p_copy->w[ k + 1 ] != p_orig->w[ k + 1 ]) )
+      dest_p[ i ] = p_copy->l[ i ];
+    else if(p_copy->w[ k ] != p_orig->w[ k ])
+      dest_w[ k ] = p_copy->w[ k ];
+    else
+      dest_w[ k + 1 ] = p_copy->w[ k + 1 ];
+  }
+}
+
+/* Checksum function, also used for API_SYSTAG_RECALC_CHECKSUM */
+static void api_ir_systag_checksum(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD bufw[32], chksum, k;
+  WORD min  = p_tag->min;  /* Source (Start) */
+  WORD max  = p_tag->max;  /* Source (End) */
+  WORD wpos = p_tag->wpos; /* Destination */
+  AiUInt32 lanes, lo, hi;
+
+  if(max < min)
+    return;
+
+  /* Checksum calculation function (Plus, Xor or 1760) */
+  switch(p_tag->step)
+  {
+    case 0:
+
+      /* PLUS */
+      /* Two data words per 32 bit access. The low and high bytes are summed */
+      /* in separate 16 bit lanes, which cannot overflow for 32 data words.  */
+      chksum = 0;
+      lo = 0;
+      hi = 0;
+      k = min;
+
+      if(k & 1)
+      {
+        chksum += BSWAP16(p_buf->w[ k ]);
+        k++;
+      }
+
+      for(; k < max; k += 2)
+      {
+        lanes = p_buf->l[ k / 2 ];
+        lo += lanes & 0x00FF00FFL;
+        hi += (lanes >> 8) & 0x00FF00FFL;
+      }
+
+      if(k == max)
+        chksum += BSWAP16(p_buf->w[ k ]);
+
+      lo = (lo & 0xFFFF) + (lo >> 16);
+      hi = (hi & 0xFFFF) + (hi >> 16);
+
+      /* Weight the byte sums with their position in the physical word */
+      chksum += (WORD)(lo * BSWAP16(0x0001) + hi * BSWAP16(0x0100));
+
+      /* Init Checksum word */
+      p_buf->w[ wpos ] = BSWAP16(chksum);
+      break;
+
+    case 1:
+
+      /* XOR */
+      /* Byte order does not change the result, so no swapping is needed */
+      chksum = 0;
+      lanes = 0;
+      k = min;
+
+      if(k & 1)
+      {
+        chksum ^= p_buf->w[ k ];
+        k++;
+      }
+
+      for(; k < max; k += 2)
+        lanes ^= p_buf->l[ k / 2 ];
+
+      if(k == max)
+        chksum ^= p_buf->w[ k ];
+
+      chksum ^= (WORD)(lanes ^ (lanes >> 16));
+
+      /* Init Checksum word */
+      p_buf->w[ wpos ] = chksum;
+      break;
+
+    case 2: 
+
+      /* 1760 */
+
+      /* Copy buffer data */
+      for(k=0; (k<wpos) && ((min+k)<32); k++)
+        bufw[k] = BSWAP16(p_buf->w[ min + k ]);
+
+      /* Generate C01 checksum */
+      chksum = api_io_c1760_calc_c01_fmt(p_api_dev, (WORD*)bufw, (BYTE)wpos);
+
+      /* Init Checksum word */
+      p_buf->w[ wpos ] = BSWAP16(chksum);
+      break;  
+
+    default:
+      break;
+  }
+}
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_IR                   Submodule : API_IR_SYSTAG             */
@@ -258,98 +412,247 @@ void api_timer0_isr(TY_API_DEV *p_api_dev, L_WORD cpu_cause, L_WORD cpu_stat, EX
 
 void api_ir_calculate_checksum( TY_API_DEV *p_api_dev, short dest_biu, WORD systag_id, L_WORD dbp )
 {
-WORD dw, bufw[32], min, max, step, wpos, chksum, k;
-WORD volatile *src_p;
-WORD volatile *dbp_p;
-  
-  if(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].fct == API_SYSTAG_CHECKSUM)
+  struct ty_api_ls_systag_entry *p_tag = &p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ];
+  TY_API_LS_SYSTAG_BUF copy;
+  TY_API_LS_SYSTAG_BUF orig;
+  BYTE *p_glb;
+
+  if( (p_tag->fct == API_SYSTAG_CHECKSUM) && (p_tag->pass == API_SYSTAG_PASS_CHECKSUM) )
   {
-    if(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].run_mode == API_SYSTAG_RUN_RESUME)
+    if(p_tag->run_mode == API_SYSTAG_RUN_RESUME)
     {
-      step = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].step; /* Checksum calculation function (Plus or Xor) */
-      wpos = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].wpos; /* Destination */
-      min  = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].min;  /* Source (Start) */
-      max  = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ systag_id ].max;  /* Source (End) */
+      p_glb = (BYTE*)API_GLB_MEM_ADDR_ABS(dbp);
 
-      if (max >= min)
-      {
-        chksum = 0;
+      api_ir_systag_buf_load(&copy, &orig, p_glb, p_tag->wfirst, p_tag->wlast);
 
-        /* Destination Pointer */
-        dbp_p = (WORD*)API_GLB_MEM_ADDR_ABS(dbp + 2 * wpos);
+      api_ir_systag_checksum(p_api_dev, p_tag, &copy);
 
-        /* Source Pointer */
-        src_p = (WORD*)API_GLB_MEM_ADDR_ABS(dbp + 2 * min);
+      api_ir_systag_buf_store(&copy, &orig, p_glb, p_tag->wfirst, p_tag->wlast);
+    }
+  }
+  
+} /* end: api_ir_calculate_checksum */
 
-        /* Calculate Checksum */
-        switch(step)
-        {
-          case 0:
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_IR                   Submodule : API_IR_SYSTAG_COMPILE     */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : System Dynamic Data entry [p_tag]                          */
+/*                                                                           */
+/*    Outputs   : none                                                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    The calculation functions below handle one System Dynamic Data word    */
+/*    each. api_ir_systag_compile selects the function, interrupt pass and   */
+/*    used data words of an entry when it is defined, so api_ir_systag does  */
+/*    not have to decode the tag function on every transfer.                 */
+/*                                                                           */
+/*****************************************************************************/
 
-            /* PLUS */
-            do
-            {
-              /* Read physical Value */
-              dw = BSWAP16(*src_p);
+#ifdef CMPL4SIM
+static void api_ir_systag_ramp_inc(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf);
+static void api_ir_systag_ramp_dec(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf);
+static void api_ir_systag_triang_inc(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf);
+static void api_ir_systag_triang_dec(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf);
 
-              /* Build Checksum */
-              chksum += dw;
+/* Next value of an incrementing function below its upper limit */
+static WORD api_ir_systag_step_up(WORD wval, WORD max, WORD step)
+{
+  if( ( (wval + step) > max) || ( (wval + step) < wval) )
+    return max;
 
-              /* next word */
-              src_p++;
-              min++;
-            } while(max >= min);
+  return wval + step;
+}
 
-            /* Init Checksum word */
-            *dbp_p = BSWAP16(chksum);
-            break;
+/* Next value of a decrementing function above its lower limit */
+static WORD api_ir_systag_step_down(WORD wval, WORD min, WORD step)
+{
+  if( ( (wval - step) < min) || ( (wval - step) > wval) )
+    return min;
 
-          case 1:
+  return wval - step;
+}
 
-            /* XOR */
-            do
-            {
-              /* Read physical Value */
-              dw = BSWAP16(*src_p);
+static void api_ir_systag_ramp_inc(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD dw   = BSWAP16(p_buf->w[ p_tag->wpos ]);
+  WORD wval = (dw & p_tag->mask) >> p_tag->bpos;
 
-              /* Build Checksum */
-              chksum ^= dw;
+  if(wval < p_tag->max)
+    wval = api_ir_systag_step_up(wval, p_tag->max, p_tag->step);
+  else
+    wval = p_tag->min;
 
-              /* next word */
-              src_p++;
-              min++;
-            } while(max >= min);
+  dw = (dw & ~p_tag->mask) | ( (wval << p_tag->bpos) & p_tag->mask);
+  p_buf->w[ p_tag->wpos ] = BSWAP16(dw);
+}
 
-            /* Init Checksum word */
-            *dbp_p = BSWAP16(chksum);
-            break;
+static void api_ir_systag_ramp_dec(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD dw   = BSWAP16(p_buf->w[ p_tag->wpos ]);
+  WORD wval = (dw & p_tag->mask) >> p_tag->bpos;
 
-          case 2: 
-            
-            /* 1760 */
-          
-            /* Copy buffer data */
-            for(k=0; (k<wpos) && (k<32); k++) {
-               bufw[k] = BSWAP16(*src_p);
-               /* next word */
-               src_p++;
-            }
+  if(wval > p_tag->min)
+    wval = api_ir_systag_step_down(wval, p_tag->min, p_tag->step);
+  else
+    wval = p_tag->max;
 
-            /* Generate C01 checksum */
-            chksum = api_io_c1760_calc_c01_fmt(p_api_dev, (WORD*)bufw, (BYTE)wpos);
+  dw = (dw & ~p_tag->mask) | ( (wval << p_tag->bpos) & p_tag->mask);
+  p_buf->w[ p_tag->wpos ] = BSWAP16(dw);
+}
 
-            /* Init Checksum word */
-            *dbp_p = BSWAP16(chksum);
-            break;  
+static void api_ir_systag_triang_inc(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD dw   = BSWAP16(p_buf->w[ p_tag->wpos ]);
+  WORD wval = (dw & p_tag->mask) >> p_tag->bpos;
 
-          default:
-            break;
-        }
-      }
+  if(wval < p_tag->max)
+    wval = api_ir_systag_step_up(wval, p_tag->max, p_tag->step);
+  else
+  {
+    /* Switch mode */
+    wval -= p_tag->step;
+    p_tag->fct  = API_SYSTAG_TRIANG_DEC;
+    p_tag->calc = api_ir_systag_triang_dec;
+  }
+
+  dw = (dw & ~p_tag->mask) | ( (wval << p_tag->bpos) & p_tag->mask);
+  p_buf->w[ p_tag->wpos ] = BSWAP16(dw);
+}
+
+static void api_ir_systag_triang_dec(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD dw   = BSWAP16(p_buf->w[ p_tag->wpos ]);
+  WORD wval = (dw & p_tag->mask) >> p_tag->bpos;
+
+  if(wval > p_tag->min)
+    wval = api_ir_systag_step_down(wval, p_tag->min, p_tag->step);
+  else
+  {
+    /* Switch mode */
+    wval += p_tag->step;
+    p_tag->fct  = API_SYSTAG_TRIANG_INC;
+    p_tag->calc = api_ir_systag_triang_inc;
+  }
+
+  dw = (dw & ~p_tag->mask) | ( (wval << p_tag->bpos) & p_tag->mask);
+  p_buf->w[ p_tag->wpos ] = BSWAP16(dw);
+}
+
+static void api_ir_systag_states(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  WORD volatile *src_p;
+  WORD dw;
+
+  /* min: Dataset ID, max: number of states, step: states mode */
+  src_p = (WORD*)API_DATASET_MEM_ADDR_ABS_IR(p_tag->min);
+
+  /* Copy Word from Dataset to Global Memory Buffer */
+  dw = BSWAP16(p_buf->w[ p_tag->wpos ]) & ~p_tag->mask;
+  dw |= ( (BSWAP16(*(src_p + p_tag->index)) << p_tag->bpos) & p_tag->mask);
+  p_buf->w[ p_tag->wpos ] = BSWAP16(dw);
+
+  if( (p_tag->step == 0) || (p_tag->step == 1) )
+  {
+    if(p_tag->index < (p_tag->max - 1) )
+    {
+      /* Increment current index */
+      p_tag->index++;
+    }
+    else if(p_tag->step == 0)
+    {
+      /* Cyclic State mode */
+      /* wrap-around */
+      p_tag->index = 0;
     }
   }
-  
-} /* end: api_ir_calculate_checksum */
+}
+
+static void api_ir_systag_comp(TY_API_DEV *p_api_dev, struct ty_api_ls_systag_entry *p_tag, TY_API_LS_SYSTAG_BUF *p_buf)
+{
+  /* min: Source Wpos, step: Complement Number, wpos: Destination Wpos */
+  WORD dw = BSWAP16(p_buf->w[ p_tag->min ]);
+
+  switch(p_tag->step)
+  {
+    case 1:
+      /* 1's complement */
+      p_buf->w[ p_tag->wpos ] = BSWAP16(~dw);
+      break;
+    case 2:
+      /* 2's complement */
+      p_buf->w[ p_tag->wpos ] = BSWAP16(~dw + 1);
+      break;
+    default:
+      break;
+  }
+}
+
+void api_ir_systag_compile(struct ty_api_ls_systag_entry *p_tag)
+{
+  p_tag->pass   = API_SYSTAG_PASS_WORD;
+  p_tag->wfirst = (BYTE)p_tag->wpos;
+  p_tag->wlast  = (BYTE)p_tag->wpos;
+
+  switch(p_tag->fct)
+  {
+    case API_SYSTAG_RAMP_INC:
+      p_tag->calc = api_ir_systag_ramp_inc;
+      break;
+
+    case API_SYSTAG_RAMP_DEC:
+      p_tag->calc = api_ir_systag_ramp_dec;
+      break;
+
+    case API_SYSTAG_TRIANG_INC:
+      p_tag->calc = api_ir_systag_triang_inc;
+      break;
+
+    case API_SYSTAG_TRIANG_DEC:
+      p_tag->calc = api_ir_systag_triang_dec;
+      break;
+
+    case API_SYSTAG_STATES:
+      p_tag->calc = api_ir_systag_states;
+      break;
+
+    case API_SYSTAG_COMP:
+      p_tag->pass = API_SYSTAG_PASS_COMP;
+      p_tag->calc = api_ir_systag_comp;
+      if(p_tag->min < p_tag->wfirst)
+        p_tag->wfirst = (BYTE)p_tag->min;
+      else if(p_tag->min > p_tag->wlast)
+        p_tag->wlast = (BYTE)p_tag->min;
+      break;
+
+    case API_SYSTAG_CHECKSUM:
+      p_tag->pass = API_SYSTAG_PASS_CHECKSUM;
+      p_tag->calc = api_ir_systag_checksum;
+      if(p_tag->min < p_tag->wfirst)
+        p_tag->wfirst = (BYTE)p_tag->min;
+      if(p_tag->max > p_tag->wlast)
+        p_tag->wlast = (BYTE)p_tag->max;
+      break;
+
+    default:
+      /* Dataset functions are handled without a systag list */
+      p_tag->pass = API_SYSTAG_PASS_NONE;
+      p_tag->calc = NULL;
+      break;
+  }
+
+  /* The calculation works on a copy of the data buffer */
+  if( (p_tag->wpos >= MAX_API_BUF_SIZE / 2) || (p_tag->wlast >= MAX_API_BUF_SIZE / 2) )
+  {
+    p_tag->pass = API_SYSTAG_PASS_NONE;
+    p_tag->calc = NULL;
+  }
+
+} /* end: api_ir_systag_compile */
+#endif 
 
 /*****************************************************************************/
 /*                                                                           */
@@ -376,26 +679,20 @@ WORD volatile *dbp_p;
 #ifdef CMPL4SIM
 void api_ir_systag(TY_API_DEV *p_api_dev, short dest_biu, BYTE bc_rt_mode, WORD xid_rtsa, L_WORD dbp)
 {
-  WORD dw, wval, min, max, step, mask, wpos, bpos, index, dytag_id, cnt,i,j,k;
   WORD dataset_id, current_id, dataset_cnt, dataset_mode;
-  WORD states_cnt, states_mode, states_index;
+  WORD dytag_id, cnt, i, j, k;
+  WORD wfirst, wlast;
   WORD volatile *src_p;
   WORD volatile *dbp_p;
   BYTE *ptr;
-  short cmpl_found;
-  short chksum_found;
-
-  dw = 0;
-  wval = 0;
-  states_cnt = 0;
-  states_mode = 0;
-  states_index = 0;
+  BYTE *p_glb;
+  BYTE pass, pass_found;
+  struct ty_api_ls_systag_entry *p_tag;
+  TY_API_LS_SYSTAG_FUNC calc;
+  TY_API_LS_SYSTAG_BUF copy;
+  TY_API_LS_SYSTAG_BUF orig;
 
-  cmpl_found = 0;
-  chksum_found = 0;
-
-  dbp_p = (WORD*)API_GLB_MEM_ADDR_ABS_IR(0,dest_biu);
-  src_p = (WORD*)API_DATASET_MEM_ADDR_ABS_IR(0);
+  pass_found = API_SYSTAG_PASS_NONE;
 
   if (bc_rt_mode == API_BC_MODE)
   {
@@ -417,8 +714,10 @@ void api_ir_systag(TY_API_DEV *p_api_dev, short dest_biu, BYTE bc_rt_mode, WORD
   if ((cnt != 0) && (ptr != NULL))
   {
     /***************************************/
-    /* Single Word Functions               */
+    /* Used Data Words                     */
     /***************************************/
+    wfirst = MAX_API_BUF_SIZE / 2;
+    wlast  = 0;
 
     for(k=0; k<cnt; k++) 
     {
@@ -429,207 +728,54 @@ void api_ir_systag(TY_API_DEV *p_api_dev, short dest_biu, BYTE bc_rt_mode, WORD
       if (j >= MAX_API_SYS_LS_SYSTAGS)
         break;
 
-      if(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].run_mode == API_SYSTAG_RUN_RESUME)
-      {
-        min = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].min;
-        max = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].max;
-        step = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].step;
-        mask = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].mask;
-        wpos = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].wpos;
-        bpos = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].bpos;
-        index = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].index;
-
-        /* Read physical Word */
-        switch(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].fct)
-        {
-          case API_SYSTAG_TRIANG_INC:
-          case API_SYSTAG_TRIANG_DEC:
-          case API_SYSTAG_RAMP_INC:
-          case API_SYSTAG_RAMP_DEC:
-            dbp_p = (WORD*)API_GLB_MEM_ADDR_ABS_IR(dbp + 2 * wpos, dest_biu);
-            dw = BSWAP16(*dbp_p); /* read value from buffer */
-            wval = (dw & mask) >> bpos;
-            dw = dw & ~mask;
-            break;
-
-          case API_SYSTAG_STATES:
-            dataset_id = min;
-            states_cnt = max;
-            states_mode = step;
-            states_index = index;
-
-            /* Set pointer to Dataset Memory address */
-            src_p = (WORD*)API_DATASET_MEM_ADDR_ABS_IR(dataset_id);
-
-            /* Set pointer to Global Memory address */
-            dbp_p = (WORD*)API_GLB_MEM_ADDR_ABS_IR(dbp + 2 * wpos, dest_biu);
-            dw = BSWAP16(*dbp_p); /* read value from buffer */
-            dw = dw & ~mask;
-            break;
-
-          case API_SYSTAG_COMP:
-            cmpl_found = 1; continue;
-
-          case API_SYSTAG_CHECKSUM:
-            chksum_found = 1; continue;
-
-          default:
-            break;
-        }
-
-        /* Calculation */
-        switch(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].fct)
-        {
-          case API_SYSTAG_RAMP_INC:
-            if(wval < max)
-            {
-              if( ( (wval + step) > max) || ( (wval + step) < wval) )
-                wval = max;
-              else
-                wval += step;
-            }
-            else
-              wval = min;
-            dw |= ( (wval << bpos) &mask);
-            *dbp_p = BSWAP16(dw);
-            break;
-
-          case API_SYSTAG_RAMP_DEC:
-            if(wval > min)
-            {
-              if( ( (wval - step) < min) || ( (wval - step) > wval) )
-                wval = min;
-              else
-                wval -= step;
-            }
-            else
-              wval = max;
-            dw |= ( (wval << bpos) &mask);
-            *dbp_p = BSWAP16(dw);
-            break;
-
-          case API_SYSTAG_TRIANG_INC:
-            if(wval < max)
-            {
-              if( ( (wval + step) > max) || ( (wval + step) < wval) )
-                wval = max;
-              else
-                wval += step;
-            }
-            else
-            {
-              /* Switch mode */
-              wval -= step;
-              p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].fct = API_SYSTAG_TRIANG_DEC;
-            }
-            dw |= ( (wval << bpos) &mask);
-            *dbp_p = BSWAP16(dw);
-            break;
-
-          case API_SYSTAG_TRIANG_DEC:
-            if(wval > min)
-            {
-              if( ( (wval - step) < min) || ( (wval - step) > wval) )
-                wval = min;
-              else
-                wval -= step;
-            }
-            else
-            {
-              /* Switch mode */
-              wval += step;
-              p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].fct = API_SYSTAG_TRIANG_INC;
-            }
-            dw |= ( (wval << bpos) &mask);
-            *dbp_p = BSWAP16(dw);
-            break;
-
-          case API_SYSTAG_STATES:
-            /* Copy Word from Dataset to Global Memory Buffer */
-            dw |= ( (BSWAP16(*(src_p + states_index)) << bpos) & mask); /* create initial value */
-            *dbp_p = BSWAP16(dw);
+      p_tag = &p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ];
 
-            if( (states_mode == 0) || (states_mode == 1) )
-            {
-              if(states_index < (states_cnt - 1) )
-              {
-                /* Increment current index */
-                p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].index++;
-              }
-              else
-              {
-                if(states_mode == 0)
-                {
-                  /* Cyclic State mode */
-                  /* wrap-around */
-                  p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].index = 0;
-                }
-              }
-            }
-            break;
+      if( (p_tag->run_mode == API_SYSTAG_RUN_RESUME) && (p_tag->pass != API_SYSTAG_PASS_NONE) )
+      {
+        pass_found |= p_tag->pass;
 
-          default:
-            break;
-        }
+        if(p_tag->wfirst < wfirst)
+          wfirst = p_tag->wfirst;
+        if(p_tag->wlast > wlast)
+          wlast = p_tag->wlast;
       }
     }
 
-    /**************************/
-    /* Complement Functions   */
-    /**************************/
-    if (cmpl_found) 
+    if (pass_found != API_SYSTAG_PASS_NONE)
     {
-      for(k=0; k<cnt; k++) 
+      /* Copy the used part of the Data Buffer in Global Memory */
+      p_glb = (BYTE*)API_GLB_MEM_ADDR_ABS_IR(dbp, dest_biu);
+      api_ir_systag_buf_load(&copy, &orig, p_glb, wfirst, wlast);
+
+      /****************************************************/
+      /* Single Word, Complement and Checksum Functions   */
+      /****************************************************/
+      for(pass = API_SYSTAG_PASS_WORD; pass <= API_SYSTAG_PASS_CHECKSUM; pass <<= 1)
       {
-        /* Get Systag Index from List */
-        j = *(ptr+k)-1; 
+        if ((pass_found & pass) == 0)
+          continue;
 
-        if(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].fct == API_SYSTAG_COMP)
+        for(k=0; k<cnt; k++) 
         {
-          if(p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].run_mode == API_SYSTAG_RUN_RESUME)
-          {
-            min  = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].min;  /* Source Wpos */
-            step = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].step; /* Complement Number */
-            wpos = p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ].wpos; /* Destination Wpos */
+          /* Get Systag Index from List */
+          j = *(ptr+k)-1; 
 
-            /* Destination Pointer */
-            dbp_p = (WORD*)API_GLB_MEM_ADDR_ABS_IR(dbp + 2 * wpos, dest_biu);
+          if (j >= MAX_API_SYS_LS_SYSTAGS)
+            break;
 
-            /* Source Pointer */
-            src_p = (WORD*)API_GLB_MEM_ADDR_ABS_IR(dbp + 2 * min, dest_biu);
+          p_tag = &p_api_dev->ls_systag_setup[ dest_biu ].dytag[ j ];
 
-            /* Read Source Word and calculate complement */
-            dw = BSWAP16(*src_p);
-            switch(step)
-            {
-              case 1:
-                /* 1's complement */
-                *dbp_p = BSWAP16(~dw);
-                break;
-              case 2:
-                /* 2's complement */
-                *dbp_p = BSWAP16(~dw + 1);
-                break;
-              default:
-                break;
-            }
-          }
+          /* Function selected by api_ir_systag_compile, the entry may be */
+          /* cleared by a command since the passes were collected         */
+          calc = *(TY_API_LS_SYSTAG_FUNC volatile *)&p_tag->calc;
+
+          if( (p_tag->pass == pass) && (p_tag->run_mode == API_SYSTAG_RUN_RESUME) && (calc != NULL) )
+            calc(p_api_dev, p_tag, &copy);
         }
       }
-    } 
 
-    /**************************/
-    /* Checksum Functions     */
-    /**************************/
-    if (chksum_found) 
-    {
-      for(k=0; k<cnt; k++) 
-      {
-        /* Get Systag Index from List */
-        j = *(ptr+k)-1; 
-        api_ir_calculate_checksum( p_api_dev, dest_biu, j, dbp );
-      }
-    } 
+      api_ir_systag_buf_store(&copy, &orig, p_glb, wfirst, wlast);
+    }
   }
   else
   {
@@ -1174,8 +1320,7 @@ L_WORD *p;
   for (i=0; i<32; i++) 
      dataw[i] = 0x0000;
 
-  UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(&p_api_dev->cb_p[dest_biu]->mbfp), In);
-  UsbSynchronizeMonitorDataBuffer(p_api_dev, dest_biu, In);
+  UsbSynchronizeMonitorDataBufferNewData(p_api_dev, dest_biu);
 
   /* Set Start Pointer of message */
   src_p = (L_WORD*)API_GLB_MEM_ADDR_ABS_IR(addr, dest_biu);
@@ -1743,43 +1888,215 @@ void api_ir_bc_srvw(TY_API_DEV *p_api_dev, short dest_biu, BYTE rt_addr, WORD vw
           p_api_dev->bc_srvw_tab[ dest_biu ].t[ API_BC_SRVW_ID_DELETE_TX ].ta[ rt_index ].sa_mid[ sa_index ].xid &= 0x7FFF;
           p_api_dev->bc_srvw_tab[ dest_biu ].t[ API_BC_SRVW_ID_MULTIP_TX ].ta[ rt_index ].sa_mid[ sa_index ].xid &= 0x7FFF;
 
-          instr = MAKE_INSTR(API_BC_INSTR_XFER, 
-                  (ul_ConvertTSWPtrToGRAMPtr(p_api_dev, dest_biu, p_api_dev->glb_mem.biu[ dest_biu ].base.bc_xfer_desc) + 
-                  (xid_srvw *MAX_API_BC_XFER_DESC_SIZE)) );
-          for(i = 0, j = 0; i < p_api_dev->bc_srvw_subframe[ dest_biu ].cnt; i++)
-          {
-            if( (p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &0xFFFFFFFEL) == instr)
-              p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &= 0xFFFFFFFEL;
-             /* disable */
-            if( (p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &1L) == 1L)
-            {
-              *(p_api_dev->bc_lip_instr_p[ dest_biu ] + j) = BSWAP32(p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &0xFFFFFFFEL);
-              j++;
-            }
-          }
-          *(p_api_dev->bc_lip_instr_p[ dest_biu ] + j) = BSWAP32(MAKE_INSTR(API_BC_INSTR_RET, 0) );
-        }
-        else
-          xid_srvw = 0;
-        break;
+          instr = MAKE_INSTR(API_BC_INSTR_XFER, 
+                  (ul_ConvertTSWPtrToGRAMPtr(p_api_dev, dest_biu, p_api_dev->glb_mem.biu[ dest_biu ].base.bc_xfer_desc) + 
+                  (xid_srvw *MAX_API_BC_XFER_DESC_SIZE)) );
+          for(i = 0, j = 0; i < p_api_dev->bc_srvw_subframe[ dest_biu ].cnt; i++)
+          {
+            if( (p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &0xFFFFFFFEL) == instr)
+              p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &= 0xFFFFFFFEL;
+             /* disable */
+            if( (p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &1L) == 1L)
+            {
+              *(p_api_dev->bc_lip_instr_p[ dest_biu ] + j) = BSWAP32(p_api_dev->bc_srvw_subframe[ dest_biu ].instr[ i ] &0xFFFFFFFEL);
+              j++;
+            }
+          }
+          *(p_api_dev->bc_lip_instr_p[ dest_biu ] + j) = BSWAP32(MAKE_INSTR(API_BC_INSTR_RET, 0) );
+        }
+        else
+          xid_srvw = 0;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /* Prepare Status info */
+  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].xid = xid_srvw;
+  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].lvw = vw;
+  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].src++;
+
+  if( p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid )
+  {
+    p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid[ xid ].lvw = vw;
+    p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid[ xid ].src++;
+  }
+
+} /* end: api_ir_bc_srvw */
+#endif 
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_IR                   Submodule : API_IR_BC_TIMING          */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Interrupting transfer or SKIP instruction                  */
+/*                                                                           */
+/*    Outputs   : none                                                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    These functions update the on-target BC schedule timing. The SKIP      */
+/*    behind the first transfer of a Minor Frame starts the frame with the   */
+/*    time tag of this transfer, the interval to the previous frame is       */
+/*    compared with the Minor Frame time. Interrupting transfers are         */
+/*    accounted with their offset from the start of their Minor Frame.       */
+/*    Frames and transfers only count as overrun beyond the Minor Frame time */
+/*    plus the tolerance, which covers the time tag resolution.              */
+/*                                                                           */
+/*****************************************************************************/
+
+#ifdef CMPL4SIM
+static void api_ir_bc_timing_time(struct ty_api_bc_timing_time *p_time, L_WORD value)
+{
+  if( (p_time->cnt == 0) || (value < p_time->min) )
+    p_time->min = value;
+
+  if( value > p_time->max )
+    p_time->max = value;
+
+  p_time->cnt++;
+  p_time->sum += value;
+}
+
+/* Returns the status queue time tag at sqp in us within the hour */
+static L_WORD api_ir_bc_timing_ttag(TY_API_DEV *p_api_dev, short dest_biu, L_WORD sqp)
+{
+  struct ty_api_bc_sq_desc *px_StatusQueue = (struct ty_api_bc_sq_desc *)API_GLB_MEM_ADDR_ABS_IR(sqp, dest_biu);
+  L_WORD ttag;
+
+  UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(&px_StatusQueue->time_tag), In);
+
+  ttag = BSWAP32(px_StatusQueue->time_tag);
+
+  return (((ttag >> 26) & 0x3F) * 60 + ((ttag >> 20) & 0x3F)) * 1000000UL + (ttag & 0xFFFFF);
+}
+
+/* Returns the status queue entry of the last execution of transfer xid */
+static L_WORD api_ir_bc_timing_sqp(TY_API_DEV *p_api_dev, short dest_biu, L_WORD xid)
+{
+  L_WORD addr, index, ctrl, qsize, cur, sqp;
+
+  addr  = ul_ConvertGRAMPtrToTSWPtr(p_api_dev, dest_biu, (*p_api_dev->bc_xfer_desc_p[ dest_biu ])[ xid ].bhd_ptr & BSWAP32(0x03fffffful) );
+  index = (addr - p_api_dev->glb_mem.biu[ dest_biu ].base.bc_bh_area) / MAX_API_BC_BH_DESC_SIZE;
+  sqp   = ul_ConvertGRAMPtrToTSWPtr(p_api_dev, dest_biu, (*p_api_dev->bc_bh_desc_p[ dest_biu ])[ index ].sq_addr);
+
+  UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(&((*p_api_dev->bc_bh_desc_p[ dest_biu ])[ index ].bh_ctrl)), In);
+  ctrl = BSWAP32((*p_api_dev->bc_bh_desc_p[ dest_biu ])[ index ].bh_ctrl);
+
+  if( ((ctrl >> 12) & 0x3) == API_BC_BH_STS_QSIZE_SQ )
+  {
+    qsize = (ctrl >> 14) & 0xF;
+    qsize = (qsize == 0) ? 1 : (1 << qsize);
+    cur   = ctrl & 0xFF;
+
+    /* The index already points to the next entry unless the host controls the queue */
+    if( ((ctrl >> 28) & 0x3) != API_BC_BH_BQM_HOST )
+      cur = (cur == 0) ? (qsize - 1) : (cur - 1);
+
+    sqp += cur * MAX_API_BC_SQ_DESC_SIZE;
+  }
+
+  return sqp;
+}
+
+static void api_ir_bc_timing_frame_eval(TY_API_DEV *p_api_dev, struct ty_api_bc_timing *timing, short dest_biu, L_WORD w2)
+{
+  struct ty_api_bc_timing_list *list;
+  L_WORD offs, lo, hi, pos, start, interval;
+
+  if( w2 < p_api_dev->glb_mem.biu[ dest_biu ].base.bc_hip_instr )
+    return;
+
+  /* The markers are sorted by their position in the list */
+  list = &timing->list[ 0 ];
+  offs = (w2 - p_api_dev->glb_mem.biu[ dest_biu ].base.bc_hip_instr) / 4;
+  lo   = 0;
+  hi   = list->cnt;
+
+  while(lo < hi)
+  {
+    pos = (lo + hi) / 2;
+
+    if(list->marker[ pos ].offs < offs)
+      lo = pos + 1;
+    else
+      hi = pos;
+  }
+
+  if( (lo >= list->cnt) || (list->marker[ lo ].offs != offs) )
+    return;
 
-      default:
-        break;
-    }
+  pos = lo;
+
+  if(list->marker[ pos ].xid == 0)
+  {
+    timing->frame_valid = API_OFF;
+    timing->frame_pos   = pos;
+    return;
   }
 
-  /* Prepare Status info */
-  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].xid = xid_srvw;
-  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].lvw = vw;
-  p_api_dev->bc_srvw_rt_dsp[ dest_biu ].rt[ rt_addr ].src++;
+  start = api_ir_bc_timing_ttag(p_api_dev, dest_biu, api_ir_bc_timing_sqp(p_api_dev, dest_biu, list->marker[ pos ].xid) );
 
-  if( p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid )
+  if( (timing->frame_valid == API_ON) && (pos == ((timing->frame_pos + 1) % list->cnt)) )
   {
-    p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid[ xid ].lvw = vw;
-    p_api_dev->bc_srvw_xid_dsp[ dest_biu ].px_Xid[ xid ].src++;
+    interval = (start + API_BC_TIMING_HOUR_US - timing->frame_start) % API_BC_TIMING_HOUR_US;
+
+    api_ir_bc_timing_time(&timing->interval, interval);
+
+    if( (p_api_dev->bc_setup[ dest_biu ].smod != API_BC_XFER_RUN_EXT) && (interval > p_api_dev->bc_setup[ dest_biu ].ftime + timing->tolerance) )
+      timing->frame_overrun++;
   }
 
-} /* end: api_ir_bc_srvw */
+  timing->frame_valid = API_ON;
+  timing->frame_pos   = pos;
+  timing->frame_start = start;
+
+  api_ir_bc_timing_time(&timing->xfer[ list->marker[ pos ].xid ].offset, 0);
+}
+
+static void api_ir_bc_timing_frame(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w2)
+{
+  /* The monitor may be reset or freed by a command at any time */
+  ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ dest_biu ]);
+
+  if(p_api_dev->bc_timing[ dest_biu ] != NULL)
+    api_ir_bc_timing_frame_eval(p_api_dev, p_api_dev->bc_timing[ dest_biu ], dest_biu, w2);
+
+  ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ dest_biu ]);
+}
+
+static void api_ir_bc_timing_xfer_eval(TY_API_DEV *p_api_dev, struct ty_api_bc_timing *timing, short dest_biu, L_WORD xid, L_WORD sqp)
+{
+  L_WORD offset;
+
+  if( (timing->frame_valid != API_ON) || (sqp == 0) || (xid >= timing->xfer_cnt) || (timing->list[ 0 ].cnt == 0) )
+    return;
+
+  /* The first transfer of the next Minor Frame interrupts before its SKIP, it is accounted by the SKIP */
+  if( xid == timing->list[ 0 ].marker[ (timing->frame_pos + 1) % timing->list[ 0 ].cnt ].xid )
+    return;
+
+  offset = (api_ir_bc_timing_ttag(p_api_dev, dest_biu, sqp) + API_BC_TIMING_HOUR_US - timing->frame_start) % API_BC_TIMING_HOUR_US;
+
+  api_ir_bc_timing_time(&timing->xfer[ xid ].offset, offset);
+
+  if( (p_api_dev->bc_setup[ dest_biu ].smod != API_BC_XFER_RUN_EXT) && (offset > p_api_dev->bc_setup[ dest_biu ].ftime + timing->tolerance) )
+    timing->xfer[ xid ].overrun++;
+}
+
+static void api_ir_bc_timing_xfer(TY_API_DEV *p_api_dev, short dest_biu, L_WORD xid, L_WORD sqp)
+{
+  ai_tsw_os_lock_aquire(p_api_dev->bc_timing_lock[ dest_biu ]);
+
+  if(p_api_dev->bc_timing[ dest_biu ] != NULL)
+    api_ir_bc_timing_xfer_eval(p_api_dev, p_api_dev->bc_timing[ dest_biu ], dest_biu, xid, sqp);
+
+  ai_tsw_os_lock_release(p_api_dev->bc_timing_lock[ dest_biu ]);
+}
 #endif 
 
 /*****************************************************************************/
@@ -1903,6 +2220,10 @@ void api_ir_bc(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
             /* Set lld according to data buffer queue index */
             db_id += current_buffer_index;
 
+            api_ir_data_queue_xfer_event(p_api_dev, dest_biu, API_DATA_QUEUE_XFER_EVENT_BC, w1, xid, sqp);
+
+            api_ir_bc_timing_xfer(p_api_dev, dest_biu, xid, sqp);
+
             /* 25.05.00: System Dynamic Data */
             bc_dytag_i = p_api_dev->bc_setup[ dest_biu ].bc_systag[ xid ].id;
             if(bc_dytag_i != 0)
@@ -2139,6 +2460,8 @@ void api_ir_bc_skip(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
         p_api_dev->bc_dbc_stop_xfctrl_save[ dest_biu ] = 0;
         p_api_dev->bc_dbc_stop_xfswm_save[ dest_biu ] = 0;
         p_api_dev->bc_status[ dest_biu ] = API_HALT;
+        api_bc_acyc_queue_reset(p_api_dev, dest_biu);
+        api_bc_frame_swap_reset(p_api_dev, dest_biu);
       }
       else if(p_api_dev->bc_setup[dest_biu].bc_triggered_inst == w2)
       {
@@ -2152,6 +2475,13 @@ void api_ir_bc_skip(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
               p_api_dev->bc_status[dest_biu] = API_BUSY;
           }
       }
+      else
+      {
+          /* End of a queued acyclic burst or start of a swapped Major Frame */
+          api_bc_acyc_queue_skip(p_api_dev, dest_biu, w2);
+          api_bc_frame_swap_skip(p_api_dev, dest_biu, w2);
+          api_ir_bc_timing_frame(p_api_dev, dest_biu, w2);
+      }
 
       /* Call Application Specified Interrupt Handler */
       /* ... tbd ... */
@@ -2328,6 +2658,8 @@ void api_ir_rt(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
           /* Set lld according to data buffer queue index */
           db_id += current_buffer_index;
 
+          api_ir_data_queue_xfer_event(p_api_dev, dest_biu, API_DATA_QUEUE_XFER_EVENT_RT, w1, (rt << 8) | (sa_ty << 5) | sa, sqp);
+
   #ifdef _CMPL4S1I1553
           /* Event Detection */
           if( (rt < MAX_API_RT) && (sa < MAX_API_RT_MC_SA) && ( (sa_ty == API_RT_SA_TYPE_RCV) || (sa_ty == API_RT_SA_TYPE_XMT) ) )
@@ -2502,6 +2834,9 @@ void api_ir_bm(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
       {
          /* MBF */
         /* Monitor Buffer Full Interrupt */
+          /* Bus statistics */
+          api_ir_bm_stat(p_api_dev, dest_biu);
+
           pDataQueueHeader = API_DATAQUEUE_HEADER(map_biu_to_dq_id[dest_biu]);
 
           if (pDataQueueHeader->status & API_DATA_QUEUE_STATUS_START)
@@ -2547,6 +2882,176 @@ void api_ir_bm(TY_API_DEV *p_api_dev, short dest_biu, L_WORD w1, L_WORD w2)
   }
 
 } /* end: api_ir_bm */
+
+
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_IR                   Submodule : API_IR_BM_STAT            */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Destination BIU [dest_biu]                                 */
+/*                                                                           */
+/*    Outputs   : none                                                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function evaluates the BM buffer entries written since the last   */
+/*    call and updates the on-target bus statistics. It is called on each    */
+/*    Monitor Buffer Full interrupt and before the statistics are read.      */
+/*    A message is accounted when the start of the next message is found.   */
+/*                                                                           */
+/*****************************************************************************/
+
+static void api_ir_bm_stat_time(struct ty_api_bm_stat_time *p_time, L_WORD value)
+{
+  if( (p_time->cnt == 0) || (value < p_time->min) )
+    p_time->min = value;
+
+  if( value > p_time->max )
+    p_time->max = value;
+
+  p_time->cnt++;
+  p_time->sum += value;
+}
+
+static void api_ir_bm_stat_msg_end(struct ty_api_bm_stat *p_stat)
+{
+  L_WORD rt, sa, ix, i;
+
+  if(p_stat->cw_valid)
+  {
+    rt = (p_stat->cw >> 11) & 0x1F;
+    sa = (p_stat->cw >> 5) & 0x1F;
+    ix = ((p_stat->cw >> 10) & 0x1) ? 2 : 0;
+
+    p_stat->val.msg_cnt++;
+    p_stat->val.sa_cnt[ rt ][ sa ][ ix ]++;
+
+    if(p_stat->err)
+    {
+      p_stat->val.err_cnt++;
+      p_stat->val.sa_cnt[ rt ][ sa ][ ix + 1 ]++;
+
+      for(i = 0; i < 16; i++)
+        if( (p_stat->err >> i) & 0x1)
+          p_stat->val.err_hist[ i ]++;
+    }
+  }
+
+  p_stat->cw_valid = API_OFF;
+  p_stat->rt2      = 0xFF;
+  p_stat->sw_cnt   = 0;
+  p_stat->err      = 0;
+}
+
+static void api_ir_bm_stat_entry(struct ty_api_bm_stat *p_stat, L_WORD entry)
+{
+  L_WORD type = entry >> 28;
+  L_WORD data = entry & 0x3FFFFFF;
+  L_WORD gap  = (entry & API_BM_ENTRY_GAP_MASK) >> 16;
+  AiUInt64 start;
+
+  if(type == API_BM_ENTRY_TTAG_HIGH)
+  {
+    /* start of the next message */
+    api_ir_bm_stat_msg_end(p_stat);
+    p_stat->sync    = API_ON;
+    p_stat->ttag_hi = data;
+    return;
+  }
+
+  if(p_stat->sync == API_OFF)
+    /* drop entries of a message whose start is not available */
+    return;
+
+  if(type == API_BM_ENTRY_TTAG_LOW)
+  {
+    /* days, hours and minutes of the time tag high entry, seconds and us of the time tag low entry */
+    start = ((p_stat->ttag_hi >> 11) & 0x1FF) * 24 + ((p_stat->ttag_hi >> 6) & 0x1F);
+    start = start * 60 + (p_stat->ttag_hi & 0x3F);
+    start = start * 60 + ((data >> 20) & 0x3F);
+    start = start * 1000000 + (data & 0xFFFFF);
+
+    if( p_stat->prev_valid && (start > p_stat->prev_start) && ((start - p_stat->prev_start) <= 0xFFFFFFFFUL) )
+      api_ir_bm_stat_time(&p_stat->val.interval, (L_WORD)(start - p_stat->prev_start));
+
+    p_stat->prev_start = start;
+    p_stat->prev_valid = API_ON;
+  }
+  else if(type == API_BM_ENTRY_ERROR)
+  {
+    p_stat->err |= data;
+  }
+  /* bit 2 of the entry type is the bus flag */
+  else if( (type & 0xB) == API_BM_ENTRY_CW1)
+  {
+    if(p_stat->cw_valid)
+      /* no time tag in front of this message */
+      api_ir_bm_stat_msg_end(p_stat);
+
+    p_stat->cw       = entry & 0xFFFF;
+    p_stat->cw_valid = API_ON;
+
+    api_ir_bm_stat_time(&p_stat->val.gap, gap);
+  }
+  else if( (type & 0xB) == API_BM_ENTRY_CW2)
+  {
+    p_stat->rt2 = (BYTE)((entry >> 11) & 0x1F);
+  }
+  else if( ((type & 0xB) == API_BM_ENTRY_SW) && p_stat->cw_valid)
+  {
+    /* in RT-RT transfers the transmitting RT responds first */
+    if( (p_stat->sw_cnt == 0) && (p_stat->rt2 != 0xFF) )
+      api_ir_bm_stat_time(&p_stat->val.resp[ p_stat->rt2 ], gap);
+    else
+      api_ir_bm_stat_time(&p_stat->val.resp[ (p_stat->cw >> 11) & 0x1F ], gap);
+
+    p_stat->sw_cnt++;
+  }
+}
+
+static void api_ir_bm_stat_eval(TY_API_DEV *p_api_dev, struct ty_api_bm_stat *p_stat, short dest_biu)
+{
+  L_WORD buf_start, buf_end, fill, size;
+
+  buf_start = p_api_dev->glb_mem.biu[ dest_biu ].base.bm_buf;
+  buf_end   = buf_start + p_api_dev->glb_mem.biu[ dest_biu ].size.bm_buf;
+
+  fill = api_io_bm_read_mbfp(p_api_dev, dest_biu);
+
+  if( (fill < buf_start) || (fill >= buf_end) || (p_stat->pos < buf_start) || (p_stat->pos >= buf_end) )
+    return;
+
+  while(p_stat->pos != fill)
+  {
+    /* evaluate up to the fill pointer or the end of the buffer */
+    size = (fill > p_stat->pos) ? (fill - p_stat->pos) : (buf_end - p_stat->pos);
+
+    if(p_api_dev->bm_status[ dest_biu ] == API_BUSY)
+    {
+      UsbSynchronizeMemoryArea(p_api_dev, p_stat->pos, size, In);
+    }
+
+    for( ; size >= sizeof(L_WORD); size -= sizeof(L_WORD), p_stat->pos += sizeof(L_WORD))
+      api_ir_bm_stat_entry(p_stat, BSWAP32(*(L_WORD volatile *)API_GLB_MEM_ADDR_ABS_IR(p_stat->pos, dest_biu)));
+
+    if(p_stat->pos >= buf_end)
+      p_stat->pos = buf_start;
+  }
+}
+
+void api_ir_bm_stat(TY_API_DEV *p_api_dev, short dest_biu)
+{
+  /* The statistics may be reset or freed by a command at any time */
+  ai_tsw_os_lock_aquire(p_api_dev->bm_stat_lock[ dest_biu ]);
+
+  if(p_api_dev->bm_stat[ dest_biu ] != NULL)
+    api_ir_bm_stat_eval(p_api_dev, p_api_dev->bm_stat[ dest_biu ], dest_biu);
+
+  ai_tsw_os_lock_release(p_api_dev->bm_stat_lock[ dest_biu ]);
+
+} /* end: api_ir_bm_stat */
 #endif 
 
 
@@ -3832,7 +4337,7 @@ static L_WORD data_queue_copy(TY_API_DEV *p_api_dev, L_WORD id, L_WORD bm_copy_s
 
     if (p_api_dev->bm_status[pDataQueueHeader->biu] == API_BUSY)
     {
-        UsbSynchronizeMonitorDataBuffer(p_api_dev, pDataQueueHeader->biu, In);
+        UsbSynchronizeMonitorDataBufferNewData(p_api_dev, pDataQueueHeader->biu);
     }
     
     /* -- Get shared RAM data queue limits--- */
@@ -3908,6 +4413,136 @@ static L_WORD data_queue_copy(TY_API_DEV *p_api_dev, L_WORD id, L_WORD bm_copy_s
 }
 
 
+/* Returns != 0 if the command word addresses an RT and SA/MC enabled in the filter */
+static L_WORD data_queue_filter_cw_match(TY_API_DATA_QUEUE_FILTER *pxFilter, L_WORD cw)
+{
+    L_WORD rt = (cw >> 11) & 0x1F;
+    L_WORD sa = (cw >>  5) & 0x1F;
+
+    if (!((pxFilter->rt_mask >> rt) & 0x1))
+        return 0;
+
+    if ((cw >> 10) & 0x1)
+        return (pxFilter->tx_sa_mask >> sa) & 0x1;
+    else
+        return (pxFilter->rx_sa_mask >> sa) & 0x1;
+}
+
+
+/* Copies one complete message from the monitor buffer into the data queue.
+   Returns != 0 and copies nothing if the data queue can not hold the message. */
+static L_WORD data_queue_copy_message(TY_API_DEV *p_api_dev, TY_API_DATA_QUEUE_HEADER *pDataQueueHeader,
+                                      L_WORD bm_start, L_WORD bm_size, L_WORD msg_start, L_WORD msg_size,
+                                      L_WORD * data_queue_put)
+{
+    L_WORD i;
+
+    if (msg_size > mil_tsw_buffer_producer_free_bytes(BM_ENTRY_SIZE, pDataQueueHeader->data_size, *data_queue_put, pDataQueueHeader->get))
+        return 1;
+
+    for (i = 0; i < msg_size; i += BM_ENTRY_SIZE)
+    {
+        *(L_WORD volatile *)API_SHARED_MEM_ADDR_ABS(*data_queue_put) =
+            *(L_WORD volatile *)API_GLB_PBIREL_TO_TSWPTR_BIU(msg_start, pDataQueueHeader->biu);
+
+        mil_tsw_buffer_increment_offset(&msg_start, BM_ENTRY_SIZE, bm_start, bm_size);
+        mil_tsw_buffer_increment_offset(data_queue_put, BM_ENTRY_SIZE, pDataQueueHeader->data_start, pDataQueueHeader->data_size);
+    }
+
+    return 0;
+}
+
+
+/* Copies the messages between bm_get and bm_put which pass the queue filter.
+   Messages start with a time tag high entry. Entries in front of the first one are dropped.
+   The last message is kept in the monitor buffer while the BM is running because it may
+   not be complete yet. bm_get is advanced behind each message that was processed.
+   Returns != 0 on data queue overflow. */
+static L_WORD data_queue_copy_filtered(TY_API_DEV *p_api_dev, L_WORD id, L_WORD bm_start, L_WORD bm_size,
+                                       L_WORD bm_put, L_WORD * bm_get, L_WORD * data_queue_put)
+{
+    TY_API_DATA_QUEUE_HEADER *pDataQueueHeader;
+    TY_API_DATA_QUEUE_FILTER *pxFilter;
+
+    L_WORD bm_available_bytes;
+    L_WORD bm_offset;
+    L_WORD msg_start = 0;
+    L_WORD msg_size  = 0;
+    L_WORD msg_open  = 0;
+    L_WORD cw_match  = 0;
+    L_WORD errors    = 0;
+    L_WORD entry;
+    L_WORD type;
+    L_WORD i;
+
+    pDataQueueHeader = API_DATAQUEUE_HEADER(id);
+    pxFilter         = &p_api_dev->dataqueue_filter[id];
+
+    if (p_api_dev->bm_status[pDataQueueHeader->biu] == API_BUSY)
+    {
+        UsbSynchronizeMonitorDataBufferNewData(p_api_dev, pDataQueueHeader->biu);
+    }
+
+    bm_available_bytes = mil_tsw_buffer_consumer_available_bytes(bm_size, bm_put, *bm_get);
+    bm_offset          = *bm_get;
+
+    for (i = 0; i < bm_available_bytes; i += BM_ENTRY_SIZE)
+    {
+        entry = BSWAP32(*(L_WORD volatile *)API_GLB_PBIREL_TO_TSWPTR_BIU(bm_offset, pDataQueueHeader->biu));
+        type  = entry >> 28;
+
+        if (type == API_BM_ENTRY_TTAG_HIGH)
+        {
+            if (msg_open)
+            {
+                if (cw_match && (!pxFilter->error_mask || (errors & pxFilter->error_mask)))
+                {
+                    if (data_queue_copy_message(p_api_dev, pDataQueueHeader, bm_start, bm_size, msg_start, msg_size, data_queue_put))
+                        return 1;
+                }
+
+                *bm_get = bm_offset;
+            }
+
+            msg_open  = 1;
+            msg_start = bm_offset;
+            msg_size  = 0;
+            cw_match  = 0;
+            errors    = 0;
+        }
+        else if (msg_open)
+        {
+            /* bit 2 of the entry type is the bus flag */
+            if (((type & 0xB) == API_BM_ENTRY_CW1) || ((type & 0xB) == API_BM_ENTRY_CW2))
+                cw_match |= data_queue_filter_cw_match(pxFilter, entry & 0xFFFF);
+            else if (type == API_BM_ENTRY_ERROR)
+                errors |= entry & 0x3FFFFFF;
+        }
+
+        mil_tsw_buffer_increment_offset(&bm_offset, BM_ENTRY_SIZE, bm_start, bm_size);
+        msg_size += BM_ENTRY_SIZE;
+
+        if (!msg_open)
+            /* drop entries of a message whose start is not available */
+            *bm_get = bm_offset;
+    }
+
+    if (msg_open && (p_api_dev->bm_status[pDataQueueHeader->biu] != API_BUSY))
+    {
+        /* BM stopped, so the last message is complete */
+        if (cw_match && (!pxFilter->error_mask || (errors & pxFilter->error_mask)))
+        {
+            if (data_queue_copy_message(p_api_dev, pDataQueueHeader, bm_start, bm_size, msg_start, msg_size, data_queue_put))
+                return 1;
+        }
+
+        *bm_get = bm_offset;
+    }
+
+    return 0;
+}
+
+
 
 
 
@@ -3926,6 +4561,10 @@ void api_ir_data_queue(TY_API_DEV *p_api_dev, AiUInt8 id)
     L_WORD msw_overflow_bitpos;
 
 
+    /* The transfer event queue is fed by the BC and RT interrupt handlers */
+    if( id == API_DATA_QUEUE_ID_XFER_EVENT )
+        return;
+
     pDataQueueHeader = API_DATAQUEUE_HEADER(id);
 
     if( !is_recording_possible(p_api_dev, id) )
@@ -3972,6 +4611,20 @@ void api_ir_data_queue(TY_API_DEV *p_api_dev, AiUInt8 id)
     /* -- Copy chunks --- */
     data_queue_put = data_queue_get_put(p_api_dev, id);
 
+    if (p_api_dev->dataqueue_filter[id].enable && !is_hs_queue(p_api_dev, pDataQueueHeader))
+    {
+        /* -- Copy filtered messages only --- */
+        size = data_queue_copy_filtered(p_api_dev, id, bm_start, bm_size, bm_put, &bm_get, &data_queue_put);
+
+        (*p_api_dev->cb_p[ pDataQueueHeader->biu ]).bm_get = bm_get;
+
+        if (size)
+            goto OVERLFOW;
+
+        bm_chunk_1 = 0;
+        bm_chunk_2 = 0;
+    }
+
     if (bm_chunk_1)
     {
         size = data_queue_copy(p_api_dev, id, bm_get, bm_chunk_1, &data_queue_put);
@@ -4199,6 +4852,82 @@ OVERLFOW_GENERIC_ACQ:
 
 } /* end: api_ir_data_queue_generic_acq */
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_IR               Submodule : API_IR_DATA_QUEUE_XFER_EVENT  */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Event type BC or RT [type]                                 */
+/*                Interrupt Status LogList Entry [w1]                        */
+/*                Transfer ID or RT/SA Type/SA [id]                          */
+/*                Status Queue Entry of the transfer [sqp]                   */
+/*                                                                           */
+/*    Outputs   : none                                                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function appends one BC transfer or RT subaddress event to the    */
+/*    transfer event data queue, if the queue is started. Each event holds   */
+/*    a header (type, BIU, interrupt cause, ID), the status words, the       */
+/*    status queue control word with the error bits and the time tag.        */
+/*                                                                           */
+/*****************************************************************************/
+
+void api_ir_data_queue_xfer_event(TY_API_DEV *p_api_dev, short dest_biu, L_WORD type, L_WORD w1, L_WORD id, L_WORD sqp)
+{
+    TY_API_DATA_QUEUE_HEADER *pDataQueueHeader;
+    struct ty_api_rt_sq_desc *px_StatusQueue;
+    L_WORD package[API_DATA_QUEUE_XFER_EVENT_SIZE / BM_ENTRY_SIZE];
+    L_WORD data_queue_put;
+    L_WORD i;
+    L_WORD volatile *data_queue_write_pointer;
+
+    if( p_api_dev->dataqueue_header_offsets[API_DATA_QUEUE_ID_XFER_EVENT] == 0 )
+        /* DQ not open */
+        return;
+
+    pDataQueueHeader = API_DATAQUEUE_HEADER(API_DATA_QUEUE_ID_XFER_EVENT);
+
+    if( (pDataQueueHeader->status & (API_DATA_QUEUE_STATUS_START | API_DATA_QUEUE_STATUS_ERROR)) != API_DATA_QUEUE_STATUS_START )
+        return;
+
+    if( sqp == 0 )
+        return;
+
+    data_queue_put = (L_WORD)pDataQueueHeader->put;
+
+    if( mil_tsw_buffer_producer_free_bytes(BM_ENTRY_SIZE, pDataQueueHeader->data_size, data_queue_put, pDataQueueHeader->get) < API_DATA_QUEUE_XFER_EVENT_SIZE )
+    {
+        pDataQueueHeader->status |= API_DATA_QUEUE_STATUS_OVERFLOW;
+        return;
+    }
+
+    /* BC and RT status queue entries share the same layout */
+    px_StatusQueue = (struct ty_api_rt_sq_desc *)API_GLB_MEM_ADDR_ABS_IR(sqp, dest_biu);
+
+    UsbSynchronizeMemoryArea(p_api_dev, API_GLB_MEM_ADDR_REL(px_StatusQueue), sizeof(struct ty_api_rt_sq_desc), In);
+
+    package[0] = (type << 28) | ((dest_biu & 0xFL) << 24) | (((w1 >> 22) & 0x1FL) << 16) | (id & 0xFFFFL);
+    package[1] = BSWAP32(px_StatusQueue->lcw_lsw);
+    package[2] = BSWAP32(px_StatusQueue->sq_ctrl);
+    package[3] = BSWAP32(px_StatusQueue->time_tag);
+
+    for( i=0; i<(API_DATA_QUEUE_XFER_EVENT_SIZE / BM_ENTRY_SIZE); i++ )
+    {
+        data_queue_write_pointer = (L_WORD volatile *)API_SHARED_MEM_ADDR_ABS(data_queue_put);
+
+        *data_queue_write_pointer = package[i];
+
+        mil_tsw_buffer_increment_offset(&data_queue_put, BM_ENTRY_SIZE, pDataQueueHeader->data_start, pDataQueueHeader->data_size);
+    }
+
+    wbflush();
+
+    pDataQueueHeader->put = data_queue_put;
+
+} /* end: api_ir_data_queue_xfer_event */
+
 #ifdef _CMPL4DTS
 
 /*****************************************************************************/
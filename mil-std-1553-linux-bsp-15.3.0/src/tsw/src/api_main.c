@@ -3224,6 +3224,43 @@ void api_main_free_allocated_memory( TY_API_DEV * p_api_dev )
     }
 
 
+    /* Free BM bus statistics */
+    for( i=0; i<MAX_BIU; i++ )
+    {
+        api_bm_stat_free( p_api_dev, i );
+
+        if( p_api_dev->bm_stat_lock[i] != NULL )
+        {
+            ai_tsw_os_lock_free( p_api_dev->bm_stat_lock[i] );
+            p_api_dev->bm_stat_lock[i] = NULL;
+        }
+    }
+
+
+    /* Free BC schedule timing monitor */
+    for( i=0; i<MAX_BIU; i++ )
+    {
+        api_bc_timing_free( p_api_dev, i );
+
+        if( p_api_dev->bc_timing_lock[i] != NULL )
+        {
+            ai_tsw_os_lock_free( p_api_dev->bc_timing_lock[i] );
+            p_api_dev->bc_timing_lock[i] = NULL;
+        }
+    }
+
+
+    /* Free BC acyclic queue locks */
+    for( i=0; i<MAX_BIU; i++ )
+    {
+        if( p_api_dev->bc_acyc_queue[i].lock != NULL )
+        {
+            ai_tsw_os_lock_free( p_api_dev->bc_acyc_queue[i].lock );
+            p_api_dev->bc_acyc_queue[i].lock = NULL;
+        }
+    }
+
+
     /* Free BC service request vector word descriptor  */
     for( i=0; i<MAX_BIU; i++ )
     {
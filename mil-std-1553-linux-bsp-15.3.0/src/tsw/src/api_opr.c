@@ -213,6 +213,9 @@ static void api_opr_struct_get_table( L_WORD command, TY_MIL_COM_TABLE_ENTRY **
         case MIL_COM_BM_LS_DQUEUE_OFFSET:
             api_ls_bm_dataqueue_command_table( table, size );
             break;
+        case MIL_COM_BM_LS_STAT_OFFSET:
+            api_ls_bm_stat_command_table( table, size );
+            break;
         case MIL_COM_BUF_LS_OFFSET:
             api_ls_buf_command_table( table, size );
             break;
@@ -28,6 +28,7 @@ TY_MIL_COM_TABLE_ENTRY axTargetLsRtCommands[] = {
   {MIL_COM_LS_RT_SA_ERR_CON, (TY_MIL_COM_FUNC_PTR)api_rt_sa_err_con,      "api_rt_sa_err_con",     sizeof(TY_MIL_COM_LS_RT_SA_ERR_CON_INPUT),sizeof(TY_MIL_COM_ACK)  },
   {MIL_COM_LS_RT_SA_ERR_GET, (TY_MIL_COM_FUNC_PTR)api_rt_sa_err_get,      "api_rt_sa_err_get",     sizeof(TY_MIL_COM_LS_RT_SA_ERR_GET_INPUT),sizeof(TY_MIL_COM_LS_RT_SA_ERR_GET_OUTPUT)},
   {MIL_COM_LS_RT_DYTAG_DEF,  (TY_MIL_COM_FUNC_PTR)api_rt_dytag_def,       "api_rt_dytag_def",      sizeof(TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT), sizeof(TY_MIL_COM_ACK)  },
+  {MIL_COM_LS_RT_DYTAG_DEF_LIST,(TY_MIL_COM_FUNC_PTR)api_rt_dytag_def_list,"api_rt_dytag_def_list", MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE, sizeof(TY_MIL_COM_ACK)  },
   {MIL_COM_LS_RT_DYTAG_GET,  (TY_MIL_COM_FUNC_PTR)api_rt_dytag_get,       "api_rt_dytag_get",      sizeof(TY_MIL_COM_LS_RT_DYTAG_GET_INPUT), sizeof(TY_MIL_COM_LS_RT_DYTAG_GET_OUTPUT)  },
   {MIL_COM_LS_RT_START,      (TY_MIL_COM_FUNC_PTR)api_rt_start,           "api_rt_start",          sizeof(TY_MIL_COM),                       sizeof(TY_MIL_COM_ACK)  },
   {MIL_COM_LS_RT_HALT,       (TY_MIL_COM_FUNC_PTR)api_rt_halt,            "api_rt_halt",           sizeof(TY_MIL_COM),                       sizeof(TY_MIL_COM_ACK)  },
@@ -861,17 +862,9 @@ L_WORD api_rt_sa_err_get( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_SA_ERR_GET_INP
 /*    Description :                                                          */
 /*                                                                           */
 /*****************************************************************************/
-L_WORD api_rt_dytag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT  * in, TY_MIL_COM_ACK * out )
+static void api_rt_dytag_def_hid( TY_API_DEV *p_api_dev, WORD rt_hid, WORD con, WORD mode, AiUInt32 *tag_fct,
+                                  AiUInt32 *min, AiUInt32 *max, AiUInt32 *step, AiUInt32 *wpos )
 {
-  L_WORD ret_val = 0;
-  WORD   rt_hid  = (WORD)in->rt_hid;
-  WORD   con     = (WORD)in->con;
-
-  if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_RT_EVENT_QUEUE))
-      return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
-
-  if(rt_hid < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.rt_eq_area)
-  {
     if(con == API_RT_DYTAG_ENA)
     {
       /* Enable Dynamic Data Function */
@@ -885,27 +878,27 @@ L_WORD api_rt_dytag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT
         /* Init Event Queue Descriptor */
         api_io_rt_dytag_def(p_api_dev, 
                             rt_hid, 
-                            (WORD)in->mode, 
-                            (WORD)in->tag_fct[0], 
-                            (WORD)in->min[0],
-                            (WORD)in->max[0],
-                            (WORD)in->step[0], 
-                            (WORD)in->wpos[0], 
-                            (WORD)in->tag_fct[1],
-                            (WORD)in->min[1], 
-                            (WORD)in->max[1], 
-                            (WORD)in->step[1], 
-                            (WORD)in->wpos[1], 
-                            (WORD)in->tag_fct[2], 
-                            (WORD)in->min[2], 
-                            (WORD)in->max[2], 
-                            (WORD)in->step[2], 
-                            (WORD)in->wpos[2], 
-                            (WORD)in->tag_fct[3], 
-                            (WORD)in->min[3], 
-                            (WORD)in->max[3], 
-                            (WORD)in->step[3], 
-                            (WORD)in->wpos[3]);
+                            mode, 
+                            (WORD)tag_fct[0], 
+                            (WORD)min[0],
+                            (WORD)max[0],
+                            (WORD)step[0], 
+                            (WORD)wpos[0], 
+                            (WORD)tag_fct[1],
+                            (WORD)min[1], 
+                            (WORD)max[1], 
+                            (WORD)step[1], 
+                            (WORD)wpos[1], 
+                            (WORD)tag_fct[2], 
+                            (WORD)min[2], 
+                            (WORD)max[2], 
+                            (WORD)step[2], 
+                            (WORD)wpos[2], 
+                            (WORD)tag_fct[3], 
+                            (WORD)min[3], 
+                            (WORD)max[3], 
+                            (WORD)step[3], 
+                            (WORD)wpos[3]);
       }
     }
     else
@@ -922,7 +915,19 @@ L_WORD api_rt_dytag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT
         api_io_rt_eq_ini(p_api_dev, rt_hid);
       }
     }
-  }
+}
+
+L_WORD api_rt_dytag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT  * in, TY_MIL_COM_ACK * out )
+{
+  L_WORD ret_val = 0;
+  WORD   rt_hid  = (WORD)in->rt_hid;
+  WORD   con     = (WORD)in->con;
+
+  if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_RT_EVENT_QUEUE))
+      return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
+
+  if(rt_hid < p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.rt_eq_area)
+    api_rt_dytag_def_hid(p_api_dev, rt_hid, con, (WORD)in->mode, in->tag_fct, in->min, in->max, in->step, in->wpos);
   else
     ret_val = API_ERR_INVALID_HID;
 
@@ -930,6 +935,53 @@ L_WORD api_rt_dytag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_INPUT
 
 } /* end: api_rt_dytag_def */
 
+/*****************************************************************************/
+/*                                                                           */
+/*   Module : API_RT                   Submodule : API_RT_DYTAG_DEF_LIST     */
+/*                                                                           */
+/*---------------------------------------------------------------------------*/
+/*    Descriptions                                                           */
+/*    ------------                                                           */
+/*    Inputs    : Number of definitions [cnt]                                */
+/*                Dynamic tagging definitions [entry]                        */
+/*                                                                           */
+/*    Outputs   : Instruction acknowledge type [ackfl]                       */
+/*                                                                           */
+/*    Description :                                                          */
+/*    This function handles the 'MIL_COM_LS_RT_DYTAG_DEF_LIST' instruction.  */
+/*    It applies a list of RT dynamic tagging definitions in one command.    */
+/*    All buffer header ids are checked before the first entry is applied.   */
+/*                                                                           */
+/*****************************************************************************/
+L_WORD api_rt_dytag_def_list( TY_API_DEV *p_api_dev, TY_MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT * in, TY_MIL_COM_ACK * out )
+{
+  TY_MIL_COM_LS_RT_DYTAG_DEF_ENTRY *entry;
+  L_WORD i;
+
+  if (!mil_fw_is_cmd_supported(p_api_dev, MIL_FW_CMD_RT_EVENT_QUEUE))
+      return API_ERR_CMD_NOT_SUPPORTED_BY_FW;
+
+  if ((in->cnt == 0) || (in->cnt > MIL_COM_LS_RT_DYTAG_DEF_LIST_MAX))
+      return API_ERR_PARAM2_NOT_IN_RANGE;
+
+  if (in->cmd.ulSize < (MIL_COM_LS_RT_DYTAG_DEF_LIST_INPUT_MINIMUM_SIZE + in->cnt * sizeof(TY_MIL_COM_LS_RT_DYTAG_DEF_ENTRY)))
+      return API_ERR_WRONG_CMD_SIZE;
+
+  for (i = 0; i < in->cnt; i++)
+    if (in->entry[i].rt_hid >= p_api_dev->glb_mem.biu[ p_api_dev->biu ].count.rt_eq_area)
+      return API_ERR_INVALID_HID;
+
+  for (i = 0; i < in->cnt; i++)
+  {
+    entry = &in->entry[i];
+    api_rt_dytag_def_hid(p_api_dev, (WORD)entry->rt_hid, (WORD)entry->con, (WORD)entry->mode,
+                         entry->tag_fct, entry->min, entry->max, entry->step, entry->wpos);
+  }
+
+  return 0;
+
+} /* end: api_rt_dytag_def_list */
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Module : API_RT                   Submodule : API_RT_DYTAG_DEF_GET      */
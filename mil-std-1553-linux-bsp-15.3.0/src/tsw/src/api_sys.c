@@ -1093,7 +1093,9 @@ L_WORD api_sys_ls_systag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_SYS_SYSTAG_DEF_I
     switch(con & 0x01)
     {
       case API_SYSTAG_DIS:
-        api_io_ls_systag_entry_init(p_api_dev, tag_ix);
+        /* Unlink the tag from the transfer before the entry is cleared, */
+        /* the interrupt handler uses the entries of all linked tags     */
+        p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].mode = API_SYSTAG_DIS;
         if(bcrt_mode == API_BC_MODE)
           api_io_bc_systag_con(p_api_dev, tag_ix, (WORD) (xid_rtsa & MAX_API_BC_XFER_MASK) );
         else if(bcrt_mode == API_RT_MODE)
@@ -1102,6 +1104,7 @@ L_WORD api_sys_ls_systag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_SYS_SYSTAG_DEF_I
         {
           ret_val = API_ERR_INVALID_MODE;
         }
+        api_io_ls_systag_entry_init(p_api_dev, tag_ix);
         break;
 
       case API_SYSTAG_ENA:
@@ -1201,6 +1204,9 @@ L_WORD api_sys_ls_systag_def( TY_API_DEV *p_api_dev, TY_MIL_COM_SYS_SYSTAG_DEF_I
             break;
           }
 
+          /* Select the interrupt calculation once instead of on every transfer */
+          api_ir_systag_compile(&p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ]);
+
           p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].mode = API_SYSTAG_ENA;
           p_api_dev->ls_systag_setup[ p_api_dev->biu ].dytag[ tag_ix ].run_mode = API_SYSTAG_RUN_RESUME;
 
@@ -72,6 +72,234 @@ AiBoolean IntersectMemoryInterval(size_t FirstIntervalStart, size_t FirstInterva
                                 size_t RemainingStartIntervals[2], size_t RemainingIntervalSizes[2]);
 
 
+/* Maximum number of memory areas one transfer adds to a synchronization plan */
+#define USB_SYNC_PLAN_AREAS_PER_TRANSFER 5
+
+/* Number of memory areas one RT buffer adds to a synchronization plan */
+#define USB_SYNC_PLAN_AREAS_PER_RT_BUFFER 4
+
+/* Number of memory areas the BC adds to a synchronization plan besides its transfers */
+#define USB_SYNC_PLAN_BC_FIXED_AREAS 6
+
+/* Number of memory areas the RT adds to a synchronization plan besides its buffers */
+#define USB_SYNC_PLAN_RT_FIXED_AREAS 3
+
+/* Number of memory areas a synchronization plan can hold without heap allocation */
+#define USB_SYNC_PLAN_LOCAL_AREAS 8
+
+/* Areas of an inbound plan that are separated by at most this many bytes are read with one transfer */
+#define USB_SYNC_PLAN_MERGE_GAP 0x800
+
+
+/* One memory area of a synchronization plan */
+typedef struct ty_usb_sync_area
+{
+    size_t Offset;
+    size_t Size;
+} TY_USB_SYNC_AREA;
+
+
+/* A synchronization plan collects memory areas that have to be synchronized.
+   On execution the areas are sorted by address and merged, so that the
+   whole plan is transferred with as few USB transactions as possible. */
+typedef struct ty_usb_sync_plan
+{
+    TY_USB_SYNC_AREA* p_Areas;
+    AiUInt32 ul_Capacity;
+    AiUInt32 ul_Count;
+    AiBoolean b_Allocated;
+    enum SYNCH_DIRECTION direction;
+    TY_USB_SYNC_AREA LocalAreas[USB_SYNC_PLAN_LOCAL_AREAS];
+} TY_USB_SYNC_PLAN;
+
+
+/* Initializes a synchronization plan
+   Parameters: TY_USB_SYNC_PLAN* - the plan to initialize
+               AiUInt32 - number of areas the plan shall hold, so that it is executed only once.
+                          If memory for this can not be allocated, a smaller local buffer is used.
+               enum SYNCH_DIRECTION - direction to synchronize */
+static void UsbSyncPlanInit(TY_USB_SYNC_PLAN* p_Plan, AiUInt32 ul_MaxAreas, enum SYNCH_DIRECTION direction)
+{
+    p_Plan->p_Areas     = p_Plan->LocalAreas;
+    p_Plan->ul_Capacity = USB_SYNC_PLAN_LOCAL_AREAS;
+    p_Plan->ul_Count    = 0;
+    p_Plan->b_Allocated = AiFalse;
+    p_Plan->direction   = direction;
+
+    if (ul_MaxAreas > USB_SYNC_PLAN_LOCAL_AREAS)
+    {
+        TY_USB_SYNC_AREA* p_Areas = ai_tsw_os_malloc(ul_MaxAreas * sizeof(TY_USB_SYNC_AREA));
+
+        if (p_Areas)
+        {
+            p_Plan->p_Areas     = p_Areas;
+            p_Plan->ul_Capacity = ul_MaxAreas;
+            p_Plan->b_Allocated = AiTrue;
+        }
+    }
+}
+
+
+/* Synchronizes all areas collected in a plan and empties it afterwards.
+   For inbound synchronization areas closer than USB_SYNC_PLAN_MERGE_GAP are read with one transfer.
+   Outbound areas are only merged if they overlap or touch, as gaps may hold data that the
+   board has modified since the mirror was last updated.
+   Parameters: TY_API_DEV - pointer to target vars structure
+               TY_USB_SYNC_PLAN* - the plan to execute
+   Return: return 0, if synch was successful */
+static AiInt32 UsbSyncPlanExecute(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan)
+{
+    AiInt32 Status = API_OK;
+    TY_USB_SYNC_AREA Area;
+    size_t MergeGap;
+    size_t Start;
+    size_t End;
+    AiUInt32 Gap;
+    AiUInt32 i;
+    AiUInt32 j;
+
+    if (p_Plan->ul_Count == 0)
+    {
+        return API_OK;
+    }
+
+    /* Sort areas by offset. Plans of big transfer lists hold thousands of areas, so a shell sort is used */
+    for (Gap = p_Plan->ul_Count / 2; Gap > 0; Gap /= 2)
+    {
+        for (i = Gap; i < p_Plan->ul_Count; i++)
+        {
+            Area = p_Plan->p_Areas[i];
+
+            for (j = i; j >= Gap && p_Plan->p_Areas[j - Gap].Offset > Area.Offset; j -= Gap)
+            {
+                p_Plan->p_Areas[j] = p_Plan->p_Areas[j - Gap];
+            }
+
+            p_Plan->p_Areas[j] = Area;
+        }
+    }
+
+    MergeGap = (p_Plan->direction == In) ? USB_SYNC_PLAN_MERGE_GAP : 0;
+
+    Start = p_Plan->p_Areas[0].Offset;
+    End   = Start + p_Plan->p_Areas[0].Size;
+
+    for (i = 1; i < p_Plan->ul_Count; i++)
+    {
+        if (p_Plan->p_Areas[i].Offset <= End + MergeGap)
+        {
+            if (p_Plan->p_Areas[i].Offset + p_Plan->p_Areas[i].Size > End)
+            {
+                End = p_Plan->p_Areas[i].Offset + p_Plan->p_Areas[i].Size;
+            }
+            continue;
+        }
+
+        Status = UsbSynchronizeMemoryArea(p_api_dev, Start, End - Start, p_Plan->direction);
+        if (Status)
+        {
+            break;
+        }
+
+        Start = p_Plan->p_Areas[i].Offset;
+        End   = Start + p_Plan->p_Areas[i].Size;
+    }
+
+    if (Status == API_OK)
+    {
+        Status = UsbSynchronizeMemoryArea(p_api_dev, Start, End - Start, p_Plan->direction);
+    }
+
+    p_Plan->ul_Count = 0;
+
+    return Status;
+}
+
+
+/* Adds a memory area to a synchronization plan.
+   A full plan is executed before the area is added. This only happens if the plan
+   could not be allocated with the size it was initialized for.
+   Parameters: TY_API_DEV - pointer to target vars structure
+               TY_USB_SYNC_PLAN* - the plan to add area to
+               size_t - relative global memory offset of area
+               size_t - size of area in bytes
+   Return: return 0 on success */
+static AiInt32 UsbSyncPlanAddArea(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, size_t Offset, size_t Size)
+{
+    AiInt32 Status;
+
+    if (Size == 0)
+    {
+        return API_OK;
+    }
+
+    if (p_Plan->ul_Count == p_Plan->ul_Capacity)
+    {
+        Status = UsbSyncPlanExecute(p_api_dev, p_Plan);
+        if (Status)
+        {
+            return Status;
+        }
+    }
+
+    p_Plan->p_Areas[p_Plan->ul_Count].Offset = Offset;
+    p_Plan->p_Areas[p_Plan->ul_Count].Size   = Size;
+    p_Plan->ul_Count++;
+
+    return API_OK;
+}
+
+
+/* Executes the remaining areas of a plan and releases the plan.
+   If building the plan failed, the areas collected before the failure are synchronized anyway,
+   just like the areas of preceding transfers were synchronized when each was handled separately.
+   Parameters: TY_API_DEV - pointer to target vars structure
+               TY_USB_SYNC_PLAN* - the plan to finish
+               AiInt32 - status of building the plan
+   Return: return 0, if plan building and synch were successful */
+static AiInt32 UsbSyncPlanFinish(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, AiInt32 Status)
+{
+    AiInt32 ExecuteStatus;
+
+    ExecuteStatus = UsbSyncPlanExecute(p_api_dev, p_Plan);
+
+    if (Status == API_OK)
+    {
+        Status = ExecuteStatus;
+    }
+
+    if (p_Plan->b_Allocated)
+    {
+        ai_tsw_os_free(p_Plan->p_Areas);
+    }
+
+    p_Plan->p_Areas     = NULL;
+    p_Plan->ul_Capacity = 0;
+    p_Plan->ul_Count    = 0;
+    p_Plan->b_Allocated = AiFalse;
+
+    return Status;
+}
+
+
+static AiUInt32 UsbTransferListLength(TY_API_DEV* p_api_dev, short biu);
+static AiUInt32 UsbRTBufferListLength(TY_API_DEV* p_api_dev, short biu);
+static AiInt32 UsbSyncPlanAddTransfers(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short biu);
+static AiInt32 UsbSyncPlanAddTransfer(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                      PTRANSFER_CONTEXT p_TransferContext, AiBoolean b_IncludeBufferData);
+static AiInt32 UsbSyncPlanAddInstructionLists(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+static AiInt32 UsbSyncPlanAddAcyclicInstructionList(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+static AiInt32 UsbSyncPlanAddBCMiscBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+static AiInt32 UsbSyncPlanAddBCSystemControlBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+static AiInt32 UsbSyncPlanAddRTBuffers(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short biu);
+static AiInt32 UsbSyncPlanAddRTBuffer(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                      PRT_BUFFER_CONTEXT p_BufferContext);
+static AiInt32 UsbSyncPlanAddRTSubAddressDescriptorArea(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                                        short uc_Biu);
+static AiInt32 UsbSyncPlanAddRTDescriptorArea(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+static AiInt32 UsbSyncPlanAddRTSystemControlBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu);
+
+
 /* Synchronizes one longword between global memory and its mirror */
 AiInt32 UsbSynchronizeLWord(TY_API_DEV* p_api_dev, size_t offset, enum SYNCH_DIRECTION direction)
 {
@@ -117,36 +345,57 @@ unsigned int UsbSynchAndReadLWord(TY_API_DEV* p_api_dev, void* p_AbsoluteMirrorA
 
 
 
-/* Synchronizes the BC relative data between global memory and its mirror */
+/* Synchronizes the BC relative data between global memory and its mirror.
+   All areas are collected in one plan, so that they are transferred in as few transactions as possible */
 AiInt32 UsbSynchronizeBC(TY_API_DEV* p_api_dev, short uc_Biu, enum SYNCH_DIRECTION direction)
 {
     AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+    AiUInt32 ul_MaxAreas;
 
-    Status = UsbSynchronizeTransfers(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+    ul_MaxAreas = UsbTransferListLength(p_api_dev, uc_Biu) * USB_SYNC_PLAN_AREAS_PER_TRANSFER
+                + USB_SYNC_PLAN_BC_FIXED_AREAS;
 
-    Status = UsbSynchronizeInstructionLists(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+    UsbSyncPlanInit(&Plan, ul_MaxAreas, direction);
 
-    Status = UsbSynchronizeBCMiscBlock(p_api_dev, uc_Biu, direction);
-    if(Status)
+    do
     {
-        return Status;
-    }
+        Status = UsbSyncPlanAddTransfers(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
 
-    Status = UsbSynchronizeBCSystemControlBlock(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+        Status = UsbSyncPlanAddInstructionLists(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
 
-    return Status;
+        Status = UsbSyncPlanAddBCMiscBlock(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
+
+        Status = UsbSyncPlanAddBCSystemControlBlock(p_api_dev, &Plan, uc_Biu);
+
+    } while(0);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
+}
+
+
+/* Adds the RT area of the System Control Block of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddRTSystemControlBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
+{
+    size_t RelativeOffset;
+    size_t Size;
+
+    RelativeOffset = p_api_dev->glb_mem.biu[uc_Biu].cb_addr + 0x4C;
+    Size = 8;
+
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeOffset, Size);
 }
 
 
@@ -156,54 +405,59 @@ AiInt32 UsbSynchronizeRTSystemControlBlock(TY_API_DEV* p_api_dev, short uc_Biu,
                                             enum SYNCH_DIRECTION direction)
 {
     AiInt32 Status;
-    size_t RelativeOffset;
-    size_t Size;
+    TY_USB_SYNC_PLAN Plan;
 
-    RelativeOffset = p_api_dev->glb_mem.biu[uc_Biu].cb_addr + 0x4C;
-    Size = 8;
+    UsbSyncPlanInit(&Plan, 0, direction);
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeOffset, Size, direction);
+    Status = UsbSyncPlanAddRTSystemControlBlock(p_api_dev, &Plan, uc_Biu);
 
-    return Status;
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
-/* Synchronizes the RT relative data between global memory and its mirror */
+/* Synchronizes the RT relative data between global memory and its mirror.
+   All areas are collected in one plan, so that they are transferred in as few transactions as possible */
 AiInt32 UsbSynchronizeRT(TY_API_DEV* p_api_dev, short uc_Biu, enum SYNCH_DIRECTION direction)
 {
     AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+    AiUInt32 ul_MaxAreas;
 
-    Status = UsbSynchronizeRTBuffers(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+    ul_MaxAreas = UsbRTBufferListLength(p_api_dev, uc_Biu) * USB_SYNC_PLAN_AREAS_PER_RT_BUFFER
+                + USB_SYNC_PLAN_RT_FIXED_AREAS;
 
-    Status = UsbSynchronizeRTSubAddressDescriptorArea(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+    UsbSyncPlanInit(&Plan, ul_MaxAreas, direction);
 
-    Status = UsbSynchronizeRTDescriptorArea(p_api_dev, uc_Biu, direction);
-    if(Status)
+    do
     {
-        return Status;
-    }
+        Status = UsbSyncPlanAddRTBuffers(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
 
-    Status = UsbSynchronizeRTSystemControlBlock(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+        Status = UsbSyncPlanAddRTSubAddressDescriptorArea(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
 
-    return Status;
+        Status = UsbSyncPlanAddRTDescriptorArea(p_api_dev, &Plan, uc_Biu);
+        if(Status)
+        {
+            break;
+        }
+
+        Status = UsbSyncPlanAddRTSystemControlBlock(p_api_dev, &Plan, uc_Biu);
+
+    } while(0);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
-/* Synchronizes instruction lists of a specific BIU between global memory and its mirror */
-AiInt32 UsbSynchronizeInstructionLists(TY_API_DEV* p_api_dev, short uc_Biu, 
-                                        enum SYNCH_DIRECTION direction)
+/* Adds the instruction lists of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddInstructionLists(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
 {
     AiInt32 Status;
     size_t RelativeInstructionListOffset;
@@ -213,8 +467,7 @@ AiInt32 UsbSynchronizeInstructionLists(TY_API_DEV* p_api_dev, short uc_Biu,
     RelativeInstructionListOffset = p_api_dev->glb_mem.biu[uc_Biu].base.bc_hip_instr;
     InstructionListSize = p_api_dev->glb_mem.biu[uc_Biu].size.bc_hip_instr;
    
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeInstructionListOffset, InstructionListSize, 
-                                      direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeInstructionListOffset, InstructionListSize);
     if(Status)
     {
         return Status;
@@ -224,28 +477,34 @@ AiInt32 UsbSynchronizeInstructionLists(TY_API_DEV* p_api_dev, short uc_Biu,
     RelativeInstructionListOffset = p_api_dev->glb_mem.biu[uc_Biu].base.bc_lip_instr;
     InstructionListSize = p_api_dev->glb_mem.biu[uc_Biu].size.bc_lip_instr;
  
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeInstructionListOffset, InstructionListSize, 
-                                      direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeInstructionListOffset, InstructionListSize);
     if(Status)
     {
         return Status;
     }
 
     /* Synchronize acyclic priority instruction list */
-    Status = UsbSynchronizeAcyclicInstructionList(p_api_dev, uc_Biu, direction);
-    if(Status)
-    {
-        return Status;
-    }
+    return UsbSyncPlanAddAcyclicInstructionList(p_api_dev, p_Plan, uc_Biu);
+}
 
-    return Status;
 
+/* Synchronizes instruction lists of a specific BIU between global memory and its mirror */
+AiInt32 UsbSynchronizeInstructionLists(TY_API_DEV* p_api_dev, short uc_Biu, 
+                                        enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddInstructionLists(p_api_dev, &Plan, uc_Biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
-/* Synchronizes BC data area of System Control Block between global memory and its mirror */
-AiInt32 UsbSynchronizeBCSystemControlBlock(TY_API_DEV* p_api_dev, short uc_Biu, 
-                                            enum SYNCH_DIRECTION direction)
+/* Adds the BC data area of System Control Block of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddBCSystemControlBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
 {
     AiInt32 Status;
     size_t RelativeGlobalMemoryOffset;
@@ -255,7 +514,7 @@ AiInt32 UsbSynchronizeBCSystemControlBlock(TY_API_DEV* p_api_dev, short uc_Biu,
     RelativeGlobalMemoryOffset = p_api_dev->glb_mem.biu[uc_Biu].cb_addr + 0x30;
     Size = 24;
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeGlobalMemoryOffset, Size, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeGlobalMemoryOffset, Size);
 
     if(Status)
     {
@@ -266,14 +525,22 @@ AiInt32 UsbSynchronizeBCSystemControlBlock(TY_API_DEV* p_api_dev, short uc_Biu,
     RelativeGlobalMemoryOffset = p_api_dev->glb_mem.biu[uc_Biu].cb_addr + 0x54;
     Size = 8;
     
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeGlobalMemoryOffset, Size, direction);
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeGlobalMemoryOffset, Size);
+}
 
-    if(Status)
-    {
-        return Status;
-    }
 
-    return Status;
+/* Synchronizes BC data area of System Control Block between global memory and its mirror */
+AiInt32 UsbSynchronizeBCSystemControlBlock(TY_API_DEV* p_api_dev, short uc_Biu, 
+                                            enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddBCSystemControlBlock(p_api_dev, &Plan, uc_Biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
@@ -298,40 +565,61 @@ AiInt32 UsbSynchronizeMemoryArea(TY_API_DEV* p_api_dev, size_t offset, size_t si
 }
 
 
-/* Synchronizes acyclic instruction list of a specific BIU between global memory and its mirror */
-AiInt32 UsbSynchronizeAcyclicInstructionList(TY_API_DEV* p_api_dev, short uc_Biu, 
-                                              enum SYNCH_DIRECTION direction)
+/* Adds the acyclic instruction list of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddAcyclicInstructionList(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
 {
-    AiInt32 Status;
     size_t RelativeListOffset;
     size_t ListSize;
 
     RelativeListOffset = p_api_dev->glb_mem.biu[uc_Biu].base.bc_acyc_instr;
     ListSize = p_api_dev->glb_mem.biu[uc_Biu].size.bc_acyc_instr;
-    
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeListOffset, ListSize, direction);
 
-    return Status;
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeListOffset, ListSize);
+}
+
+
+/* Synchronizes acyclic instruction list of a specific BIU between global memory and its mirror */
+AiInt32 UsbSynchronizeAcyclicInstructionList(TY_API_DEV* p_api_dev, short uc_Biu, 
+                                              enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddAcyclicInstructionList(p_api_dev, &Plan, uc_Biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
 
 
-/* Synchronizes the RT descriptor area of a specific BIU between global memory and its mirror */
-AiInt32 UsbSynchronizeRTDescriptorArea(TY_API_DEV* p_api_dev, short uc_Biu, 
-                                        enum SYNCH_DIRECTION direction)
+/* Adds the RT descriptor area of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddRTDescriptorArea(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
 {
-    AiInt32 Status;
     size_t RelativeRTDescriptorOffset;
     size_t RTDescriptorSize;
 
     RelativeRTDescriptorOffset = p_api_dev->glb_mem.biu[uc_Biu].rt_desc_addr;
     RTDescriptorSize = MAX_API_RT_DESC_SIZE * MAX_API_RT;
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeRTDescriptorOffset, RTDescriptorSize, 
-                                      direction);
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeRTDescriptorOffset, RTDescriptorSize);
+}
 
-    return Status;
+
+/* Synchronizes the RT descriptor area of a specific BIU between global memory and its mirror */
+AiInt32 UsbSynchronizeRTDescriptorArea(TY_API_DEV* p_api_dev, short uc_Biu, 
+                                        enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddRTDescriptorArea(p_api_dev, &Plan, uc_Biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
@@ -357,22 +645,33 @@ AiInt32 UsbSynchronizeRTDescriptor(TY_API_DEV* p_api_dev, short uc_Biu, unsigned
 }
 
 
+/* Adds the RT subaddress descriptor area of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddRTSubAddressDescriptorArea(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                                        short uc_Biu)
+{
+    size_t RelativeRTSubAddressDescriptorOffset;
+    size_t RTSubAddressDescriptorSize;
+
+    RelativeRTSubAddressDescriptorOffset = p_api_dev->glb_mem.biu[uc_Biu].base.rt_sa_desc;
+    RTSubAddressDescriptorSize = p_api_dev->glb_mem.biu[uc_Biu].size.rt_sa_desc;
+
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeRTSubAddressDescriptorOffset, RTSubAddressDescriptorSize);
+}
+
+
 /* Synchronizes the RT subaddress descriptor area of a specific BIU 
    between global memory and its mirror*/
 AiInt32 UsbSynchronizeRTSubAddressDescriptorArea(TY_API_DEV* p_api_dev, short uc_Biu, 
                                                   enum SYNCH_DIRECTION direction)
 {
     AiInt32 Status;
-    size_t RelativeRTSubAddressDescriptorOffset;
-    size_t RTSubAddressDescriptorSize;
+    TY_USB_SYNC_PLAN Plan;
 
-    RelativeRTSubAddressDescriptorOffset = p_api_dev->glb_mem.biu[uc_Biu].base.rt_sa_desc;
-    RTSubAddressDescriptorSize = p_api_dev->glb_mem.biu[uc_Biu].size.rt_sa_desc;
+    UsbSyncPlanInit(&Plan, 0, direction);
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeRTSubAddressDescriptorOffset, 
-                                      RTSubAddressDescriptorSize, direction);
+    Status = UsbSyncPlanAddRTSubAddressDescriptorArea(p_api_dev, &Plan, uc_Biu);
 
-    return Status;
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
@@ -426,6 +725,71 @@ AiInt32 UsbSynchronizeMonitorDataBuffer(TY_API_DEV* p_api_dev, short uc_Biu,
 }
 
 
+/* Restarts the incremental monitor data buffer synchronization of a specific BIU
+   at the start of its monitor buffer */
+void UsbMonitorDataBufferSyncReset(TY_API_DEV* p_api_dev, short uc_Biu)
+{
+    p_api_dev->UsbMonitorSyncOffset[uc_Biu] = p_api_dev->glb_mem.biu[uc_Biu].base.bm_buf;
+}
+
+
+/* Synchronizes the monitor data written since the last call from global memory into its mirror */
+AiInt32 UsbSynchronizeMonitorDataBufferNewData(TY_API_DEV* p_api_dev, short uc_Biu)
+{
+    AiInt32 Status;
+    size_t BufferStart;
+    size_t BufferEnd;
+    size_t SyncOffset;
+    size_t FillOffset;
+
+    BufferStart = p_api_dev->glb_mem.biu[uc_Biu].base.bm_buf;
+    BufferEnd   = BufferStart + p_api_dev->glb_mem.biu[uc_Biu].size.bm_buf;
+
+    /* Everything in front of the monitor fill pointer is final,
+       so only the part between the last synchronized offset and the fill pointer has to be read */
+    Status = UsbSynchronizeLWord(p_api_dev, API_GLB_MEM_ADDR_REL(&p_api_dev->cb_p[uc_Biu]->mbfp), In);
+    if(Status)
+    {
+        return Status;
+    }
+
+    FillOffset = ul_ConvertGRAMPtrToTSWPtr(p_api_dev, uc_Biu, (*p_api_dev->cb_p[uc_Biu]).mbfp);
+    SyncOffset = p_api_dev->UsbMonitorSyncOffset[uc_Biu];
+
+    if(FillOffset < BufferStart || FillOffset >= BufferEnd)
+    {
+        /* Unexpected fill pointer, fall back to synchronizing the complete buffer */
+        return UsbSynchronizeMonitorDataBuffer(p_api_dev, uc_Biu, In);
+    }
+
+    if(SyncOffset < BufferStart || SyncOffset >= BufferEnd)
+    {
+        SyncOffset = BufferStart;
+    }
+
+    if(FillOffset >= SyncOffset)
+    {
+        Status = UsbSynchronizeMemoryArea(p_api_dev, SyncOffset, FillOffset - SyncOffset, In);
+    }
+    else
+    {
+        /* Monitor wrapped around since last synchronization, read up to buffer end and from buffer start */
+        Status = UsbSynchronizeMemoryArea(p_api_dev, SyncOffset, BufferEnd - SyncOffset, In);
+        if(Status == API_OK)
+        {
+            Status = UsbSynchronizeMemoryArea(p_api_dev, BufferStart, FillOffset - BufferStart, In);
+        }
+    }
+
+    if(Status == API_OK)
+    {
+        p_api_dev->UsbMonitorSyncOffset[uc_Biu] = FillOffset;
+    }
+
+    return Status;
+}
+
+
 /* Synchronizes the monitor activity/filtering page of a specific BIU */
 AiInt32 UsbSynchronizeMonitorActivityFilteringPage(TY_API_DEV* p_api_dev, short uc_Biu, 
                                                    enum SYNCH_DIRECTION direction)
@@ -1344,22 +1708,31 @@ AiBoolean IntersectMemoryInterval(size_t FirstIntervalStart, size_t FirstInterva
 }
 
 
-/* Synchronizes the BC misc block of a specific BIU between global memory and its mirror */
-AiInt32 UsbSynchronizeBCMiscBlock(TY_API_DEV* p_api_dev, short uc_Biu, 
-                                   enum SYNCH_DIRECTION direction)
+/* Adds the BC misc block of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddBCMiscBlock(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short uc_Biu)
 {
-    AiInt32 Status;
     size_t RelativeBCMiscBlockOffset;
     size_t BCMiscBlockSize;
 
     RelativeBCMiscBlockOffset = p_api_dev->glb_mem.biu[uc_Biu].cb_addr + 0x100;
     BCMiscBlockSize = 0x300;
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeBCMiscBlockOffset, BCMiscBlockSize,
-                                      direction);
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeBCMiscBlockOffset, BCMiscBlockSize);
+}
 
 
-    return Status;
+/* Synchronizes the BC misc block of a specific BIU between global memory and its mirror */
+AiInt32 UsbSynchronizeBCMiscBlock(TY_API_DEV* p_api_dev, short uc_Biu, 
+                                   enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddBCMiscBlock(p_api_dev, &Plan, uc_Biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
@@ -1381,8 +1754,27 @@ AiInt32 UsbSynchronizeBCMiscBlock(TY_API_DEV* p_api_dev, short uc_Biu,
 *****************************************************************************/
 
 
-/* Synchronizes all transfers, that are in the transfer list, between global memory and its mirror */
-AiInt32 UsbSynchronizeTransfers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIRECTION direction)
+/* Returns the number of transfers in the transfer list of a specific BIU */
+static AiUInt32 UsbTransferListLength(TY_API_DEV* p_api_dev, short biu)
+{
+    AiUInt32 ul_Length = 0;
+    PTRANSFER_CONTEXT current_transfer;
+
+    ai_tsw_os_lock_aquire(p_api_dev->TransferListLock[biu]);
+
+    ai_list_for_each_entry(current_transfer, &(p_api_dev->TransferList[biu]), TRANSFER_CONTEXT, list)
+    {
+        ul_Length++;
+    }
+
+    ai_tsw_os_lock_release(p_api_dev->TransferListLock[biu]);
+
+    return ul_Length;
+}
+
+
+/* Adds all transfers of the transfer list of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddTransfers(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short biu)
 {
     AiInt32 Status = API_OK;
     PTRANSFER_CONTEXT current_transfer;
@@ -1391,7 +1783,7 @@ AiInt32 UsbSynchronizeTransfers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIR
 
     ai_list_for_each_entry(current_transfer, &(p_api_dev->TransferList[biu]), TRANSFER_CONTEXT, list)
     {
-        Status = UsbSynchronizeTransfer(p_api_dev, current_transfer, AiTrue, direction);
+        Status = UsbSyncPlanAddTransfer(p_api_dev, p_Plan, current_transfer, AiTrue);
 
         if( Status != API_OK )
             break;
@@ -1403,9 +1795,41 @@ AiInt32 UsbSynchronizeTransfers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIR
 }
 
 
-/* Synchronizes all RT buffers of the buffer list of a specific BIU
-between global memory and its mirror */
-AiInt32 UsbSynchronizeRTBuffers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIRECTION direction)
+/* Synchronizes all transfers, that are in the transfer list, between global memory and its mirror */
+AiInt32 UsbSynchronizeTransfers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, UsbTransferListLength(p_api_dev, biu) * USB_SYNC_PLAN_AREAS_PER_TRANSFER, direction);
+
+    Status = UsbSyncPlanAddTransfers(p_api_dev, &Plan, biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
+}
+
+
+/* Returns the number of RT buffers in the buffer list of a specific BIU */
+static AiUInt32 UsbRTBufferListLength(TY_API_DEV* p_api_dev, short biu)
+{
+    AiUInt32 ul_Length = 0;
+    PRT_BUFFER_CONTEXT current_buffer;
+
+    ai_tsw_os_lock_aquire(p_api_dev->RTBufferListLock[biu]);
+
+    ai_list_for_each_entry(current_buffer, &(p_api_dev->RTBufferList[biu]), RT_BUFFER_CONTEXT, list)
+    {
+        ul_Length++;
+    }
+
+    ai_tsw_os_lock_release(p_api_dev->RTBufferListLock[biu]);
+
+    return ul_Length;
+}
+
+
+/* Adds all RT buffers of the buffer list of a specific BIU to a synchronization plan */
+static AiInt32 UsbSyncPlanAddRTBuffers(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan, short biu)
 {
     AiInt32 Status = API_OK;
     PRT_BUFFER_CONTEXT current_buffer;
@@ -1414,7 +1838,7 @@ AiInt32 UsbSynchronizeRTBuffers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIR
 
     ai_list_for_each_entry(current_buffer, &(p_api_dev->RTBufferList[biu]), RT_BUFFER_CONTEXT, list)
     {
-        Status = UsbSynchronizeRTBuffer(p_api_dev, current_buffer, direction);
+        Status = UsbSyncPlanAddRTBuffer(p_api_dev, p_Plan, current_buffer);
 
         if (Status != API_OK)
             break;
@@ -1426,8 +1850,39 @@ AiInt32 UsbSynchronizeRTBuffers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIR
 }
 
 
-/* Synchronizes one specific transfer between global memory and its mirror */
-AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_TransferContext, AiBoolean b_IncludeBufferData, enum SYNCH_DIRECTION direction)
+/* Synchronizes all RT buffers of the buffer list of a specific BIU
+between global memory and its mirror */
+AiInt32 UsbSynchronizeRTBuffers(TY_API_DEV* p_api_dev, short biu, enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, UsbRTBufferListLength(p_api_dev, biu) * USB_SYNC_PLAN_AREAS_PER_RT_BUFFER, direction);
+
+    Status = UsbSyncPlanAddRTBuffers(p_api_dev, &Plan, biu);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
+}
+
+
+/* Checks that the buffer header pointer of a transfer lies within the BC buffer header area,
+   so that a corrupt mirror does not lead to synchronization of arbitrary memory */
+static AiBoolean UsbTransferBufferHeaderValid(TY_API_DEV* p_api_dev, struct ty_api_bc_xfer_desc* p_TransferDescriptor)
+{
+    if ((p_TransferDescriptor->bhd_ptr <  p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area)
+     || (p_TransferDescriptor->bhd_ptr >(p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area + p_api_dev->glb_mem.biu[p_api_dev->biu].size.bc_bh_area)))
+    {
+        /*@TODO: Remove if mirror is stable */
+        return AiFalse;
+    }
+
+    return AiTrue;
+}
+
+
+/* Adds all memory areas of one specific transfer to a synchronization plan */
+static AiInt32 UsbSyncPlanAddTransfer(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                      PTRANSFER_CONTEXT p_TransferContext, AiBoolean b_IncludeBufferData)
 {
     AiInt32 Status = API_ERR;
     struct ty_api_bc_bh_desc* p_BufferHeader;
@@ -1440,10 +1895,8 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
 
     p_TransferDescriptor     = p_TransferContext->p_TransferDescriptor;
 
-    if ((p_TransferDescriptor->bhd_ptr <  p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area)
-     || (p_TransferDescriptor->bhd_ptr >(p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area + p_api_dev->glb_mem.biu[p_api_dev->biu].size.bc_bh_area)))
+    if (!UsbTransferBufferHeaderValid(p_api_dev, p_TransferDescriptor))
     {
-        /*@TODO: Remove if mirror is stable */
         return API_ERR;
     }
 
@@ -1454,7 +1907,7 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
     us_NumBuffers = 1 << uc_QueueSize;
 
     /* Synchronize Event queue */
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->eq_addr, MAX_API_BC_EQ_DESC_SIZE, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->eq_addr, MAX_API_BC_EQ_DESC_SIZE);
 
     if( Status != API_OK )
     {
@@ -1474,7 +1927,7 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
         StatusQueueSize = MAX_API_BC_SQ_DESC_SIZE;
     }
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->sq_addr, StatusQueueSize, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->sq_addr, StatusQueueSize);
 
     if (Status)
     {
@@ -1483,7 +1936,7 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
 
 
     /* Synchronize Buffer header */
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_TransferDescriptor->bhd_ptr, MAX_API_BC_BH_DESC_SIZE, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_TransferDescriptor->bhd_ptr, MAX_API_BC_BH_DESC_SIZE);
 
     if (Status)
     {
@@ -1493,7 +1946,7 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
     /* Synchronize transfer descriptor */
     RelativeTransferDescriptorOffset = API_GLB_MEM_ADDR_REL(p_TransferDescriptor);
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeTransferDescriptorOffset, MAX_API_BC_XFER_DESC_SIZE, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeTransferDescriptorOffset, MAX_API_BC_XFER_DESC_SIZE);
 
     if (Status)
     {
@@ -1502,28 +1955,35 @@ AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_Transf
 
     if (b_IncludeBufferData)
     {
-        Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->bp_addr, us_NumBuffers * MAX_API_BUF_SIZE, direction);
-
-        if (Status)
-        {
-            return Status;
-        }
+        Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->bp_addr, us_NumBuffers * MAX_API_BUF_SIZE);
     }
 
+    return Status;
+}
 
-    if ((p_TransferDescriptor->bhd_ptr <  p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area)
-     || (p_TransferDescriptor->bhd_ptr >(p_api_dev->glb_mem.biu[p_api_dev->biu].base.bc_bh_area + p_api_dev->glb_mem.biu[p_api_dev->biu].size.bc_bh_area)))
+
+/* Synchronizes one specific transfer between global memory and its mirror */
+AiInt32 UsbSynchronizeTransfer(TY_API_DEV* p_api_dev, PTRANSFER_CONTEXT p_TransferContext, AiBoolean b_IncludeBufferData, enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    if (!UsbTransferBufferHeaderValid(p_api_dev, p_TransferContext->p_TransferDescriptor))
     {
-        /*@TODO: Remove if mirror is stable */
         return API_ERR;
     }
 
-    return Status;
+    UsbSyncPlanInit(&Plan, USB_SYNC_PLAN_AREAS_PER_TRANSFER, direction);
+
+    Status = UsbSyncPlanAddTransfer(p_api_dev, &Plan, p_TransferContext, b_IncludeBufferData);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 
-/* Synchronizes one RT buffer between global memory and its mirror */
-AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_BufferContext, enum SYNCH_DIRECTION direction)
+/* Adds all memory areas of one RT buffer to a synchronization plan */
+static AiInt32 UsbSyncPlanAddRTBuffer(TY_API_DEV* p_api_dev, TY_USB_SYNC_PLAN* p_Plan,
+                                      PRT_BUFFER_CONTEXT p_BufferContext)
 {
     AiInt32 Status = API_ERR;
     struct ty_api_rt_bh_desc* p_BufferHeader;
@@ -1539,7 +1999,7 @@ AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_Buffe
     us_NumBuffers = 1 << uc_QueueSize;
 
     /* Synchronize the buffer data */
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->bp_addr, us_NumBuffers * MAX_API_BUF_SIZE, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->bp_addr, us_NumBuffers * MAX_API_BUF_SIZE);
 
     if (Status)
     {
@@ -1547,7 +2007,7 @@ AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_Buffe
     }
 
     /* Synchronize the Event queue */
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->eq_addr, MAX_API_RT_EQ_DESC_SIZE, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->eq_addr, MAX_API_RT_EQ_DESC_SIZE);
 
     if (Status)
     {
@@ -1566,7 +2026,7 @@ AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_Buffe
         StatusQueueSize = MAX_API_BC_SQ_DESC_SIZE;
     }
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, p_BufferHeader->sq_addr, StatusQueueSize, direction);
+    Status = UsbSyncPlanAddArea(p_api_dev, p_Plan, p_BufferHeader->sq_addr, StatusQueueSize);
 
     if (Status)
     {
@@ -1576,14 +2036,21 @@ AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_Buffe
     /* Synchronize the buffer header */
     RelativeBufferHeaderOffset = API_GLB_MEM_ADDR_REL(p_BufferHeader);
 
-    Status = UsbSynchronizeMemoryArea(p_api_dev, RelativeBufferHeaderOffset, MAX_API_BC_BH_DESC_SIZE, direction);
+    return UsbSyncPlanAddArea(p_api_dev, p_Plan, RelativeBufferHeaderOffset, MAX_API_BC_BH_DESC_SIZE);
+}
 
-    if (Status)
-    {
-        return Status;
-    }
 
-    return Status;
+/* Synchronizes one RT buffer between global memory and its mirror */
+AiInt32 UsbSynchronizeRTBuffer(TY_API_DEV* p_api_dev, PRT_BUFFER_CONTEXT p_BufferContext, enum SYNCH_DIRECTION direction)
+{
+    AiInt32 Status;
+    TY_USB_SYNC_PLAN Plan;
+
+    UsbSyncPlanInit(&Plan, 0, direction);
+
+    Status = UsbSyncPlanAddRTBuffer(p_api_dev, &Plan, p_BufferContext);
+
+    return UsbSyncPlanFinish(p_api_dev, &Plan, Status);
 }
 
 